@@ -1234,6 +1234,113 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer uses.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Run the command queue on the rendering thread (default)
+ *    "auto"     - Use one thread per CPU core
+ *    "N"        - Use N threads
+ *
+ *  When more than one thread is used, the render target is split into
+ *  horizontal tiles and every thread replays the queued commands clipped to
+ *  the tiles it picks up, so commands are still applied in order within each
+ *  tile. This mostly helps fill and blit heavy frames on large surfaces.
+ *  Batches containing lines or scaled copies are still drawn on the rendering
+ *  thread, since clipping those to a tile would leave seams.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS  "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling how much memory the software renderer may use to keep rotated copies.
+ *
+ *  SDL_RenderCopyEx() scales, modulates and rotates the texture into a new surface
+ *  on every call. The software renderer keeps the most recently used results, so
+ *  drawing the same texture with the same source rect, size, angle, flip, blend
+ *  mode and modulation again is just a blit. Updating or destroying the texture
+ *  drops its entries.
+ *
+ *  The value is the budget in kilobytes, "0" disables the cache. The default is "4096".
+ *
+ *  This hint is checked when the renderer is created.
+ *
+ *  \sa SDL_RenderGetCopyExCacheStats()
+ */
+#define SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE  "SDL_RENDER_SOFTWARE_TRANSFORM_CACHE"
+
+/**
+ *  \brief  A variable controlling whether the software renderer draws at the logical size.
+ *
+ *  By default a logical size set with SDL_RenderSetLogicalSize() is handled by
+ *  scaling every command to the window resolution, so every copy is a scaled blit.
+ *  With this hint the software renderer draws into a surface of the logical size
+ *  instead, and scales it into the window once per SDL_RenderPresent(), using the
+ *  filtering SDL_HINT_RENDER_SCALE_QUALITY asked for when the logical size was set.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Scale every command to the window resolution (default)
+ *    "1"       - Draw at the logical size and scale the result when presenting
+ *
+ *  In this mode SDL_RenderGetScale() reports 1.0, nothing is drawn at more detail
+ *  than the logical size, the letterbox bars stay black, and SDL_RenderReadPixels()
+ *  reads the logical output. Mouse and touch events are still mapped to logical
+ *  coordinates.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_LOGICAL_PRESENT  "SDL_RENDER_SOFTWARE_LOGICAL_PRESENT"
+
+/**
+ *  \brief  A variable controlling how many threads large surface operations use.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Run everything on the calling thread (default)
+ *    "auto"     - Use one thread per CPU core
+ *    "N"        - Use N threads
+ *
+ *  When more than one thread is used, blits, pixel format conversions and
+ *  fills bigger than SDL_HINT_BLIT_THREAD_THRESHOLD are split into horizontal
+ *  bands that are processed in parallel, with the calling thread taking bands
+ *  too. Scaled blits and blits within the same pixels always run on the
+ *  calling thread, as do operations started while another thread is using
+ *  the worker threads.
+ *
+ *  This includes YUV to RGB conversions, which also covers YUV textures on
+ *  the software renderer, and conversions between planar and packed YUV
+ *  formats. Their bands start on even rows when the chroma is subsampled
+ *  vertically.
+ *
+ *  This hint can be changed at any time, the worker threads are started on
+ *  the next large operation and stopped in SDL_Quit().
+ */
+#define SDL_HINT_BLIT_THREADS  "SDL_BLIT_THREADS"
+
+/**
+ *  \brief  A variable setting how many pixels an operation needs to be split across threads.
+ *
+ *  Blits, conversions and fills covering fewer pixels than this are run on the
+ *  calling thread, since waking the worker threads would cost more than it
+ *  saves. The default is 262144, a 512x512 area.
+ *
+ *  This hint only has an effect when SDL_HINT_BLIT_THREADS is more than 1.
+ */
+#define SDL_HINT_BLIT_THREAD_THRESHOLD  "SDL_BLIT_THREAD_THRESHOLD"
+
+/**
+ *  \brief  A variable setting how many bytes a fill needs to bypass the CPU cache.
+ *
+ *  SDL_FillRect() and SDL_FillRects() calls filling at least this many bytes
+ *  in total write the pixels with non-temporal stores where the CPU supports
+ *  them, so clearing a large surface doesn't evict everything else from the
+ *  cache. Smaller fills use regular stores and leave the pixels in the cache
+ *  for whatever draws into them next. The default is 16777216 (16 MB).
+ */
+#define SDL_HINT_FILL_STREAM_THRESHOLD  "SDL_FILL_STREAM_THRESHOLD"
+
 
 /**
  *  \brief  A variable controlling whether SDL logs all events pushed onto its internal queue.
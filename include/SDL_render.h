@@ -137,6 +137,40 @@ typedef struct SDL_Renderer SDL_Renderer;
 struct SDL_Texture;
 typedef struct SDL_Texture SDL_Texture;
 
+/**
+ *  \brief A block of rendering calls recorded for replay
+ *
+ *  \sa SDL_RenderBeginRecording()
+ */
+struct SDL_RenderCommandList;
+typedef struct SDL_RenderCommandList SDL_RenderCommandList;
+
+/**
+ *  \brief Rendering work counters, see SDL_RenderGetStats()
+ *
+ *  Commands are counted as the backend sees them, after consecutive copies
+ *  have been merged.
+ */
+typedef struct SDL_RenderStats
+{
+    Uint64 viewport_commands;       /**< Viewport changes */
+    Uint64 cliprect_commands;       /**< Clip rectangle changes */
+    Uint64 drawcolor_commands;      /**< Draw color changes */
+    Uint64 clear_commands;          /**< SDL_RenderClear() calls */
+    Uint64 point_commands;          /**< Point batches */
+    Uint64 line_commands;           /**< Line batches */
+    Uint64 fillrect_commands;       /**< Filled rectangle batches */
+    Uint64 copy_commands;           /**< Texture copy batches */
+    Uint64 copyex_commands;         /**< Rotated or flipped texture copies */
+    Uint64 vertex_bytes;            /**< Vertex data sent to the backend */
+    Uint64 flushes;                 /**< Command queue flushes that ran commands */
+    Uint64 texture_uploads;         /**< Texture updates and unlocks */
+    Uint64 texture_upload_bytes;    /**< Pixel data in those uploads */
+    Uint64 target_switches;         /**< Render target changes */
+    Uint64 run_queue_us;            /**< Microseconds spent running command queues */
+    Uint64 present_us;              /**< Microseconds spent presenting */
+} SDL_RenderStats;
+
 
 /* Function prototypes */
 
@@ -1014,6 +1048,48 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyF(SDL_Renderer * renderer,
                                             const SDL_Rect * srcrect,
                                             const SDL_FRect * dstrect);
 
+/**
+ *  \brief Copy several portions of the same texture to the current rendering target.
+ *
+ *  This is the same as calling SDL_RenderCopy() once for each destination
+ *  rectangle, but the copies are queued together.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param srcrects An array of count source rectangles, or NULL to copy the
+ *                  entire texture each time.
+ *  \param dstrects An array of count destination rectangles.
+ *  \param count    The number of copies.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopies(SDL_Renderer * renderer,
+                                             SDL_Texture * texture,
+                                             const SDL_Rect * srcrects,
+                                             const SDL_Rect * dstrects,
+                                             int count);
+
+/**
+ *  \brief Copy several portions of the same texture to the current rendering target.
+ *
+ *  This is the same as calling SDL_RenderCopyF() once for each destination
+ *  rectangle, but the copies are queued together.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param srcrects An array of count source rectangles, or NULL to copy the
+ *                  entire texture each time.
+ *  \param dstrects An array of count destination rectangles.
+ *  \param count    The number of copies.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopiesF(SDL_Renderer * renderer,
+                                              SDL_Texture * texture,
+                                              const SDL_Rect * srcrects,
+                                              const SDL_FRect * dstrects,
+                                              int count);
+
 /**
  *  \brief Copy a portion of the source texture to the current rendering target, rotating it by angle around the given center
  *
@@ -1103,6 +1179,63 @@ extern DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer * renderer);
  */
 extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
 
+/**
+ *  \brief Start recording rendering calls into a command list.
+ *
+ *  Anything queued so far is flushed first. Until SDL_RenderEndRecording()
+ *  is called, drawing calls are recorded instead of drawn, and flushes,
+ *  including the one in SDL_RenderPresent(), are deferred. The render
+ *  target can't be changed while recording.
+ *
+ *  \param renderer The renderer to record
+ *
+ *  \return 0 on success, or -1 on error
+ *
+ *  \sa SDL_RenderEndRecording()
+ *  \sa SDL_RenderReplay()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderBeginRecording(SDL_Renderer * renderer);
+
+/**
+ *  \brief Stop recording and return the recorded rendering calls.
+ *
+ *  The list keeps the viewport, clip rectangle, scale and texture color,
+ *  alpha and blend modes that were in effect when each call was made.
+ *  Textures are sampled when the list is replayed.
+ *
+ *  \param renderer The renderer being recorded
+ *
+ *  \return The recorded command list, or NULL on error, including when the
+ *          render target was destroyed while recording. Free it with
+ *          SDL_DestroyRenderCommandList().
+ *
+ *  \sa SDL_RenderBeginRecording()
+ */
+extern DECLSPEC SDL_RenderCommandList *SDLCALL SDL_RenderEndRecording(SDL_Renderer * renderer);
+
+/**
+ *  \brief Queue the rendering calls of a recorded command list again.
+ *
+ *  The commands and their vertex data are copied into the renderer's queue
+ *  as they were recorded, without going through the individual calls.
+ *
+ *  \param renderer The renderer the list was recorded with
+ *  \param list     The command list to replay
+ *
+ *  \return 0 on success, or -1 on error, for example if a texture used by
+ *          the list has been destroyed.
+ */
+extern DECLSPEC int SDLCALL SDL_RenderReplay(SDL_Renderer * renderer, SDL_RenderCommandList * list);
+
+/**
+ *  \brief Free a command list returned by SDL_RenderEndRecording().
+ *
+ *  This may be called after the renderer has been destroyed.
+ *
+ *  \param list The command list to free
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyRenderCommandList(SDL_RenderCommandList * list);
+
 
 /**
  *  \brief Bind the texture to the current OpenGL/ES/ES2 context for use with
@@ -1147,6 +1280,34 @@ extern DECLSPEC void *SDLCALL SDL_RenderGetMetalLayer(SDL_Renderer * renderer);
  */
 extern DECLSPEC void *SDLCALL SDL_RenderGetMetalCommandEncoder(SDL_Renderer * renderer);
 
+/**
+ *  \brief Get the hit and miss counts of the renderer's cache of rotated copies
+ *
+ *  The software renderer keeps the results of SDL_RenderCopyEx() around, see
+ *  SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE. Other renderers report zero.
+ *
+ *  \param renderer The renderer to query
+ *  \param hits     A pointer filled in with the number of copies served from the cache, may be NULL
+ *  \param misses   A pointer filled in with the number of copies that had to be transformed, may be NULL
+ *
+ *  \return 0 on success, or -1 if the renderer is invalid
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetCopyExCacheStats(SDL_Renderer * renderer, Uint64 *hits, Uint64 *misses);
+
+/**
+ *  \brief Get the rendering work counters of a renderer
+ *
+ *  A frame ends with SDL_RenderPresent(). Work done while recording with
+ *  SDL_RenderBeginRecording() is counted when the list is replayed.
+ *
+ *  \param renderer The renderer to query
+ *  \param frame    A pointer filled in with the counters of the last presented frame, may be NULL
+ *  \param total    A pointer filled in with the counters of all presented frames, may be NULL
+ *
+ *  \return 0 on success, or -1 if the renderer is invalid
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats *frame, SDL_RenderStats *total);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
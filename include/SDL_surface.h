@@ -235,6 +235,72 @@ extern DECLSPEC int SDLCALL SDL_SaveBMP_RW
 extern DECLSPEC int SDLCALL SDL_SetSurfaceRLE(SDL_Surface * surface,
                                               int flag);
 
+/**
+ *  \brief RLE encode a surface now instead of on its first blit.
+ *
+ *  The surface is encoded with its current colorkey and blend mode for
+ *  blitting onto surfaces of the given format, and RLE acceleration is
+ *  enabled on it. Blits onto surfaces of that format then use the encoding
+ *  as is.
+ *
+ *  This can be called from a loading thread, as long as no other thread uses
+ *  the surface at the same time.
+ *
+ *  \param surface The surface to encode
+ *  \param format The SDL_PixelFormatEnum of the surfaces it will be blitted onto
+ *
+ *  \return 0 on success, or -1 if the surface can't be RLE encoded for that format
+ *
+ *  \sa SDL_SaveRLE_RW()
+ */
+extern DECLSPEC int SDLCALL SDL_PrepareSurfaceRLE(SDL_Surface * surface,
+                                                  Uint32 format);
+
+/**
+ *  Save the RLE encoding of a surface to a data stream.
+ *
+ *  The surface must be RLE encoded, either by a blit or by
+ *  SDL_PrepareSurfaceRLE(). The encoding can only be loaded on machines with
+ *  the same byte order.
+ *
+ *  If \c freedst is non-zero, the stream will be closed after being written.
+ *
+ *  \return 0 if successful or -1 if there was an error.
+ */
+extern DECLSPEC int SDLCALL SDL_SaveRLE_RW
+    (SDL_Surface * surface, SDL_RWops * dst, int freedst);
+
+/**
+ *  Save the RLE encoding of a surface to a file.
+ *
+ *  Convenience macro.
+ */
+#define SDL_SaveRLE(surface, file) \
+        SDL_SaveRLE_RW(surface, SDL_RWFromFile(file, "wb"), 1)
+
+/**
+ *  Load an RLE encoded surface saved with SDL_SaveRLE_RW().
+ *
+ *  The surface is ready to be blitted onto surfaces of the format it was
+ *  encoded for without encoding it again, and has the colorkey, blend mode
+ *  and palette it was saved with.
+ *
+ *  If \c freesrc is non-zero, the stream will be closed after being read.
+ *
+ *  The new surface should be freed with SDL_FreeSurface().
+ *
+ *  \return the new surface, or NULL if there was an error.
+ */
+extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadRLE_RW(SDL_RWops * src,
+                                                    int freesrc);
+
+/**
+ *  Load an RLE encoded surface from a file.
+ *
+ *  Convenience macro.
+ */
+#define SDL_LoadRLE(file)   SDL_LoadRLE_RW(SDL_RWFromFile(file, "rb"), 1)
+
 /**
  *  \brief Sets the color key (transparent pixel) in a blittable surface.
  *
@@ -409,6 +475,36 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
                                               Uint32 dst_format,
                                               void * dst, int dst_pitch);
 
+/**
+ *  \brief Premultiply the alpha on a block of pixels
+ *
+ *  The color of each pixel is scaled by its alpha, as expected by
+ *  ::SDL_BLENDMODE_BLEND_PREMULTIPLIED. The source and destination may be
+ *  the same buffer when the formats and pitches are the same, otherwise
+ *  this is an error.
+ *
+ *  \return 0 on success, or -1 if there was an error
+ *
+ *  \sa SDL_PremultiplySurfaceAlpha()
+ */
+extern DECLSPEC int SDLCALL SDL_PremultiplyAlpha(int width, int height,
+                                                 Uint32 src_format,
+                                                 const void * src, int src_pitch,
+                                                 Uint32 dst_format,
+                                                 void * dst, int dst_pitch);
+
+/**
+ *  \brief Premultiply the alpha of a surface in place, and blend it with
+ *         ::SDL_BLENDMODE_BLEND_PREMULTIPLIED from now on.
+ *
+ *  This is meant to be done once when the surface is loaded, blitting it
+ *  afterwards saves the multiply by alpha on every blit.
+ *
+ *  \return 0 on success, or -1 if the surface has no alpha channel or there
+ *          was an error
+ */
+extern DECLSPEC int SDLCALL SDL_PremultiplySurfaceAlpha(SDL_Surface * surface);
+
 /**
  *  Performs a fast fill of the given rectangle with \c color.
  *
@@ -510,6 +606,17 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ *  \brief Perform a bilinear scaling between two surfaces of the same 32-bit
+ *         pixel format.
+ *
+ *  \note Unlike SDL_SoftStretch(), this function is thread-safe.
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                            const SDL_Rect * srcrect,
+                                            SDL_Surface * dst,
+                                            const SDL_Rect * dstrect);
+
 #define SDL_BlitScaled SDL_UpperBlitScaled
 
 /**
@@ -528,6 +635,45 @@ extern DECLSPEC int SDLCALL SDL_LowerBlitScaled
     (SDL_Surface * src, SDL_Rect * srcrect,
     SDL_Surface * dst, SDL_Rect * dstrect);
 
+/**
+ *  \brief Get the hit and miss counts of the blit function cache
+ *
+ *  Blit functions are chosen again whenever a surface is blitted to a new
+ *  destination or its blit mapping is invalidated, and the choices are cached
+ *  by source and destination format, blit flags and CPU features across all
+ *  surfaces.
+ *
+ *  \param hits   A pointer filled in with the number of choices served from the cache, may be NULL
+ *  \param misses A pointer filled in with the number of choices that had to be made, may be NULL
+ */
+extern DECLSPEC void SDLCALL SDL_GetBlitCacheStats(Uint64 *hits, Uint64 *misses);
+
+/**
+ *  \brief Set the amount of memory kept for recycling surface pixels
+ *
+ *  When the limit is non-zero, freeing a surface created by SDL keeps its
+ *  pixels and pixel format in a pool, and creating a surface with the same
+ *  size and format reuses them instead of allocating new ones. Least recently
+ *  freed buffers are released first when the pool grows past the limit.
+ *
+ *  \param limit The maximum number of bytes of pixels kept in the pool, or 0 to disable the pool and release everything in it (the default)
+ *
+ *  \sa SDL_TrimSurfacePool()
+ */
+extern DECLSPEC void SDLCALL SDL_SetSurfacePoolLimit(size_t limit);
+
+/**
+ *  \brief Release pooled surface pixels until the pool holds at most \c size bytes
+ *
+ *  The limit set with SDL_SetSurfacePoolLimit() is left unchanged.
+ */
+extern DECLSPEC void SDLCALL SDL_TrimSurfacePool(size_t size);
+
+/**
+ *  \brief Get the number of bytes of pixels currently held in the surface pool
+ */
+extern DECLSPEC size_t SDLCALL SDL_GetSurfacePoolSize(void);
+
 /**
  *  \brief Set the YUV conversion mode
  */
@@ -42,6 +42,7 @@
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "video/SDL_blit.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -417,6 +418,10 @@ SDL_Quit(void)
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
+    /* Surface functions work without initializing video, so this is separate */
+    SDL_QuitBands();
+    SDL_SetSurfacePoolLimit(0);
+
 #if !SDL_TIMERS_DISABLED
     SDL_TicksQuit();
 #endif
@@ -116,6 +116,33 @@
 #define SDL_HAVE_YUV                    !SDL_LEAN_AND_MEAN
 #endif
 
+/* Intrinsics for instruction sets SDL isn't compiled for by default, like AVX2.
+   Functions using them are marked with SDL_TARGETING("avx2") and may only be
+   called after checking the CPU with SDL_HasAVX2() and friends. */
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && \
+    ((defined(__GNUC__) && (__GNUC__ >= 5)) || defined(__clang__)) && \
+    (defined(__i386__) || defined(__x86_64__))
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#define SDL_AVX2_INTRINSICS 1
+#define SDL_AVX512F_INTRINSICS 1
+#elif defined(_MSC_VER) && (_MSC_VER >= 1800) && (defined(_M_IX86) || defined(_M_X64)) && !defined(__clang__)
+#define SDL_TARGETING(x)
+#define SDL_AVX2_INTRINSICS 1
+#define SDL_AVX512F_INTRINSICS (_MSC_VER >= 1911)
+#else
+#define SDL_TARGETING(x)
+#define SDL_AVX2_INTRINSICS 0
+#define SDL_AVX512F_INTRINSICS 0
+#endif
+
+/* SSE2 intrinsics are available wherever the compiler targets SSE2 and
+   SDL_cpuinfo.h includes <emmintrin.h>, check SDL_HasSSE2() before use. */
+#if defined(__SSE2__) && !defined(SDL_DISABLE_EMMINTRIN_H)
+#define SDL_SSE2_INTRINSICS 1
+#else
+#define SDL_SSE2_INTRINSICS 0
+#endif
+
 #include "SDL_log.h"
 
 #endif /* SDL_internal_h_ */
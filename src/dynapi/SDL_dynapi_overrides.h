@@ -765,3 +765,21 @@
 #define SDL_trunc SDL_trunc_REAL
 #define SDL_truncf SDL_truncf_REAL
 #define SDL_GetPreferredLocales SDL_GetPreferredLocales_REAL
+#define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_RenderGetCopyExCacheStats SDL_RenderGetCopyExCacheStats_REAL
+#define SDL_RenderBeginRecording SDL_RenderBeginRecording_REAL
+#define SDL_RenderEndRecording SDL_RenderEndRecording_REAL
+#define SDL_RenderReplay SDL_RenderReplay_REAL
+#define SDL_DestroyRenderCommandList SDL_DestroyRenderCommandList_REAL
+#define SDL_RenderGetStats SDL_RenderGetStats_REAL
+#define SDL_RenderCopies SDL_RenderCopies_REAL
+#define SDL_RenderCopiesF SDL_RenderCopiesF_REAL
+#define SDL_GetBlitCacheStats SDL_GetBlitCacheStats_REAL
+#define SDL_SetSurfacePoolLimit SDL_SetSurfacePoolLimit_REAL
+#define SDL_TrimSurfacePool SDL_TrimSurfacePool_REAL
+#define SDL_GetSurfacePoolSize SDL_GetSurfacePoolSize_REAL
+#define SDL_PrepareSurfaceRLE SDL_PrepareSurfaceRLE_REAL
+#define SDL_SaveRLE_RW SDL_SaveRLE_RW_REAL
+#define SDL_LoadRLE_RW SDL_LoadRLE_RW_REAL
+#define SDL_PremultiplyAlpha SDL_PremultiplyAlpha_REAL
+#define SDL_PremultiplySurfaceAlpha SDL_PremultiplySurfaceAlpha_REAL
@@ -824,3 +824,21 @@ SDL_DYNAPI_PROC(void,SDL_Metal_GetDrawableSize,(SDL_Window *a, int *b, int *c),(
 SDL_DYNAPI_PROC(double,SDL_trunc,(double a),(a),return)
 SDL_DYNAPI_PROC(float,SDL_truncf,(float a),(a),return)
 SDL_DYNAPI_PROC(SDL_Locale *,SDL_GetPreferredLocales,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_SoftStretchLinear,(SDL_Surface *a, const SDL_Rect *b, SDL_Surface *c, const SDL_Rect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetCopyExCacheStats,(SDL_Renderer *a, Uint64 *b, Uint64 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_RenderBeginRecording,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RenderCommandList*,SDL_RenderEndRecording,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderReplay,(SDL_Renderer *a, SDL_RenderCommandList *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRenderCommandList,(SDL_RenderCommandList *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_RenderGetStats,(SDL_Renderer *a, SDL_RenderStats *b, SDL_RenderStats *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_RenderCopies,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_Rect *d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_RenderCopiesF,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(void,SDL_GetBlitCacheStats,(Uint64 *a, Uint64 *b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_SetSurfacePoolLimit,(size_t a),(a),)
+SDL_DYNAPI_PROC(void,SDL_TrimSurfacePool,(size_t a),(a),)
+SDL_DYNAPI_PROC(size_t,SDL_GetSurfacePoolSize,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_PrepareSurfaceRLE,(SDL_Surface *a, Uint32 b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SaveRLE_RW,(SDL_Surface *a, SDL_RWops *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadRLE_RW,(SDL_RWops *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_PremultiplyAlpha,(int a, int b, Uint32 c, const void *d, int e, Uint32 f, void *g, int h),(a,b,c,d,e,f,g,h),return)
+SDL_DYNAPI_PROC(int,SDL_PremultiplySurfaceAlpha,(SDL_Surface *a),(a),return)
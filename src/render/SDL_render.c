@@ -25,6 +25,7 @@
 #include "SDL_assert.h"
 #include "SDL_hints.h"
 #include "SDL_render.h"
+#include "SDL_timer.h"
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
@@ -79,6 +80,10 @@
     SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_DST_COLOR, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
                           SDL_BLENDFACTOR_DST_ALPHA, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)
 
+#define SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL \
+    SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
+                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)
+
 #if !SDL_RENDER_DISABLED
 static const SDL_RenderDriver *render_drivers[] = {
 #if SDL_VIDEO_RENDER_D3D
@@ -205,9 +210,51 @@ DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+static void
+DiscardRenderCommands(SDL_Renderer *renderer)
+{
+    /* Move the whole render command queue to the unused pool so we can reuse them next time. */
+    if (renderer->render_commands_tail != NULL) {
+        renderer->render_commands_tail->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = renderer->render_commands;
+        renderer->render_commands_tail = NULL;
+        renderer->render_commands = NULL;
+    }
+    renderer->vertex_data_used = 0;
+    renderer->render_command_generation++;
+    renderer->color_queued = SDL_FALSE;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+}
+
+static void
+CountRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderStats *stats = &renderer->stats;
+    const SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT: stats->viewport_commands++; break;
+            case SDL_RENDERCMD_SETCLIPRECT: stats->cliprect_commands++; break;
+            case SDL_RENDERCMD_SETDRAWCOLOR: stats->drawcolor_commands++; break;
+            case SDL_RENDERCMD_CLEAR: stats->clear_commands++; break;
+            case SDL_RENDERCMD_DRAW_POINTS: stats->point_commands++; break;
+            case SDL_RENDERCMD_DRAW_LINES: stats->line_commands++; break;
+            case SDL_RENDERCMD_FILL_RECTS: stats->fillrect_commands++; break;
+            case SDL_RENDERCMD_COPY: stats->copy_commands++; break;
+            case SDL_RENDERCMD_COPY_EX: stats->copyex_commands++; break;
+            case SDL_RENDERCMD_NO_OP: break;
+        }
+    }
+    stats->vertex_bytes += renderer->vertex_data_used;
+    stats->flushes++;
+}
+
 static int
 FlushRenderCommands(SDL_Renderer *renderer)
 {
+    Uint64 start;
     int retval;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
@@ -217,22 +264,18 @@ FlushRenderCommands(SDL_Renderer *renderer)
         return 0;
     }
 
+    if (renderer->recording) {  /* the queue is being recorded, not drawn. */
+        return 0;
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
+    CountRenderCommands(renderer);
 
+    start = SDL_GetPerformanceCounter();
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    renderer->stats.run_queue_us += SDL_GetPerformanceCounter() - start;
 
-    /* Move the whole render command queue to the unused pool so we can reuse them next time. */
-    if (renderer->render_commands_tail != NULL) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        renderer->render_commands_pool = renderer->render_commands;
-        renderer->render_commands_tail = NULL;
-        renderer->render_commands = NULL;
-    }
-    renderer->vertex_data_used = 0;
-    renderer->render_command_generation++;
-    renderer->color_queued = SDL_FALSE;
-    renderer->viewport_queued = SDL_FALSE;
-    renderer->cliprect_queued = SDL_FALSE;
+    DiscardRenderCommands(renderer);
     return retval;
 }
 
@@ -247,6 +290,30 @@ FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
     return 0;
 }
 
+static void
+CountTextureUpload(SDL_Texture *texture, const SDL_Rect *rect)
+{
+    SDL_RenderStats *stats = &texture->renderer->stats;
+    const size_t pixels = (size_t) rect->w * rect->h;
+
+    stats->texture_uploads++;
+    switch (texture->format) {
+        case SDL_PIXELFORMAT_YV12:
+        case SDL_PIXELFORMAT_IYUV:
+        case SDL_PIXELFORMAT_NV12:
+        case SDL_PIXELFORMAT_NV21:
+            stats->texture_upload_bytes += pixels + 2 * (size_t) ((rect->w + 1) / 2) * ((rect->h + 1) / 2);
+            break;
+        case SDL_PIXELFORMAT_P010:
+        case SDL_PIXELFORMAT_P016:
+            stats->texture_upload_bytes += 2 * (pixels + 2 * (size_t) ((rect->w + 1) / 2) * ((rect->h + 1) / 2));
+            break;
+        default:
+            stats->texture_upload_bytes += pixels * SDL_BYTESPERPIXEL(texture->format);
+            break;
+    }
+}
+
 static SDL_INLINE int
 FlushRenderCommandsIfNotBatching(SDL_Renderer *renderer)
 {
@@ -322,6 +389,256 @@ AllocateRenderCommand(SDL_Renderer *renderer)
     return retval;
 }
 
+int
+SDL_RenderBeginRecording(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (renderer->recording) {
+        return SDL_SetError("Renderer is already recording");
+    }
+
+    /* Start from an empty queue so the list holds only the recorded calls,
+       with the viewport, clip rect and draw color queued again as needed. */
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+    renderer->recording = SDL_TRUE;
+    return 0;
+}
+
+static int
+AddCommandListTexture(SDL_RenderCommandList *list, SDL_Texture *texture)
+{
+    SDL_Texture **textures;
+    int i;
+
+    for (i = list->num_textures; i--; ) {
+        if (list->textures[i] == texture) {
+            return 0;
+        }
+    }
+
+    textures = (SDL_Texture **) SDL_realloc(list->textures, (list->num_textures + 1) * sizeof (*textures));
+    if (!textures) {
+        return SDL_OutOfMemory();
+    }
+    textures[list->num_textures++] = texture;
+    list->textures = textures;
+    return 0;
+}
+
+SDL_RenderCommandList *
+SDL_RenderEndRecording(SDL_Renderer * renderer)
+{
+    SDL_RenderCommandList *list;
+    SDL_RenderCommand *cmd;
+    size_t i;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!renderer->recording) {
+        SDL_SetError("Renderer is not recording");
+        return NULL;
+    }
+    renderer->recording = SDL_FALSE;
+
+    if (renderer->recording_target_lost) {
+        renderer->recording_target_lost = SDL_FALSE;
+        DiscardRenderCommands(renderer);
+        SDL_SetError("The render target was destroyed while recording");
+        return NULL;
+    }
+
+    list = (SDL_RenderCommandList *) SDL_calloc(1, sizeof (*list));
+    if (!list) {
+        SDL_OutOfMemory();
+        goto failed;
+    }
+    list->valid = SDL_TRUE;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        if (cmd->command != SDL_RENDERCMD_NO_OP) {
+            ++list->num_commands;
+        }
+    }
+    if (list->num_commands) {
+        list->commands = (SDL_RenderCommand *) SDL_malloc(list->num_commands * sizeof (*list->commands));
+        if (!list->commands) {
+            SDL_OutOfMemory();
+            goto failed;
+        }
+    }
+    if (renderer->vertex_data_used) {
+        list->vertex_data = SDL_malloc(renderer->vertex_data_used);
+        if (!list->vertex_data) {
+            SDL_OutOfMemory();
+            goto failed;
+        }
+        SDL_memcpy(list->vertex_data, renderer->vertex_data, renderer->vertex_data_used);
+        list->vertex_data_used = renderer->vertex_data_used;
+    }
+
+    i = 0;
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        if (cmd->command == SDL_RENDERCMD_NO_OP) {
+            continue;
+        }
+        if ((cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX) &&
+            AddCommandListTexture(list, cmd->data.draw.texture) < 0) {
+            goto failed;
+        }
+        list->commands[i] = *cmd;
+        list->commands[i].next = NULL;
+        ++i;
+    }
+
+    for (i = 0; i < (size_t) list->num_textures; ++i) {
+        ++list->textures[i]->refcount;
+    }
+
+    list->renderer = renderer;
+    list->next = renderer->command_lists;
+    if (list->next) {
+        list->next->prev = list;
+    }
+    renderer->command_lists = list;
+
+    DiscardRenderCommands(renderer);
+    return list;
+
+failed:
+    if (list) {
+        SDL_free(list->textures);
+        SDL_free(list->vertex_data);
+        SDL_free(list->commands);
+        SDL_free(list);
+    }
+    DiscardRenderCommands(renderer);
+    return NULL;
+}
+
+int
+SDL_RenderReplay(SDL_Renderer * renderer, SDL_RenderCommandList * list)
+{
+    size_t base = 0;
+    size_t i;
+    int j;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!list) {
+        return SDL_InvalidParamError("list");
+    }
+    if (list->renderer != renderer) {
+        return SDL_SetError("Command list was not recorded with this renderer");
+    }
+    if (!list->valid) {
+        return SDL_SetError("Command list uses a texture that was destroyed");
+    }
+
+    if (list->vertex_data_used) {
+        void *vertices = SDL_AllocateRenderVertices(renderer, list->vertex_data_used, SDL_RENDER_COMMAND_LIST_ALIGNMENT, &base);
+        if (!vertices) {
+            return -1;
+        }
+        SDL_memcpy(vertices, list->vertex_data, list->vertex_data_used);
+    }
+
+    for (i = 0; i < list->num_commands; ++i) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (cmd == NULL) {
+            return -1;
+        }
+        *cmd = list->commands[i];
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                cmd->data.viewport.first += base;
+                break;
+            case SDL_RENDERCMD_SETDRAWCOLOR:
+            case SDL_RENDERCMD_CLEAR:
+                cmd->data.color.first += base;
+                break;
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+                cmd->data.draw.first += base;
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (j = 0; j < list->num_textures; ++j) {
+        list->textures[j]->last_command_generation = renderer->render_command_generation;
+    }
+
+    /* The list left its own state behind, queue ours again before the next draw */
+    renderer->color_queued = SDL_FALSE;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
+static void
+ReleaseCommandListTextures(SDL_RenderCommandList *list)
+{
+    int i;
+
+    for (i = 0; i < list->num_textures; ++i) {
+        --list->textures[i]->refcount;
+    }
+    SDL_free(list->textures);
+    list->textures = NULL;
+    list->num_textures = 0;
+}
+
+/* Invalidates the command lists using this texture, which is being destroyed */
+static void
+InvalidateCommandLists(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    SDL_RenderCommandList *list;
+    int i;
+
+    for (list = renderer->command_lists; list && texture->refcount > 0; list = list->next) {
+        for (i = 0; i < list->num_textures; ++i) {
+            if (list->textures[i] == texture) {
+                ReleaseCommandListTextures(list);
+                list->valid = SDL_FALSE;
+                break;
+            }
+        }
+    }
+}
+
+void
+SDL_DestroyRenderCommandList(SDL_RenderCommandList * list)
+{
+    if (!list) {
+        return;
+    }
+
+    if (list->renderer) {
+        ReleaseCommandListTextures(list);
+        if (list->next) {
+            list->next->prev = list->prev;
+        }
+        if (list->prev) {
+            list->prev->next = list->next;
+        } else {
+            list->renderer->command_lists = list->next;
+        }
+    }
+
+    SDL_free(list->textures);
+    SDL_free(list->vertex_data);
+    SDL_free(list->commands);
+    SDL_free(list);
+}
+
 static int
 QueueCmdSetViewport(SDL_Renderer *renderer)
 {
@@ -515,15 +832,70 @@ PrepQueueCmdDrawTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_
     return cmd;
 }
 
+/* Returns the queued copy that a copy of this texture can be merged into, or NULL */
+static SDL_RenderCommand *
+GetCoalescableCopy(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    SDL_RenderCommand *last;
+
+    if (!renderer->coalesce_copies) {
+        return NULL;
+    }
+
+    /* Queue any state change first, it lands between the two copies */
+    if (PrepQueueCmdDraw(renderer, texture->r, texture->g, texture->b, texture->a) < 0) {
+        return NULL;
+    }
+
+    last = renderer->render_commands_tail;
+    if (last == NULL || last->command != SDL_RENDERCMD_COPY ||
+        last->data.draw.texture != texture ||
+        last->data.draw.blend != texture->blendMode ||
+        last->data.draw.r != texture->r || last->data.draw.g != texture->g ||
+        last->data.draw.b != texture->b || last->data.draw.a != texture->a) {
+        return NULL;
+    }
+    return last;
+}
+
 static int
-QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture * texture, const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+QueueCmdCopies(SDL_Renderer *renderer, SDL_Texture * texture, const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count)
 {
-    SDL_RenderCommand *cmd = PrepQueueCmdDrawTexture(renderer, texture, SDL_RENDERCMD_COPY);
-    int retval = -1;
+    SDL_RenderCommand *last;
+    SDL_RenderCommand *cmd;
+    size_t vertex_end;
+    int i, retval = -1;
+
+    if (count > 1 && renderer->QueueCopies == NULL) {
+        /* Queue them one at a time, they're merged again if the backend can */
+        for (i = 0; i < count; ++i) {
+            retval = QueueCmdCopies(renderer, texture, &srcrects[i], &dstrects[i], 1);
+            if (retval < 0) {
+                break;
+            }
+        }
+        return retval;
+    }
+
+    last = GetCoalescableCopy(renderer, texture);
+    vertex_end = renderer->vertex_data_used;
+    cmd = PrepQueueCmdDrawTexture(renderer, texture, SDL_RENDERCMD_COPY);
     if (cmd != NULL) {
-        retval = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
+        if (count > 1) {
+            retval = renderer->QueueCopies(renderer, cmd, texture, srcrects, dstrects, count);
+        } else {
+            retval = renderer->QueueCopy(renderer, cmd, texture, srcrects, dstrects);
+        }
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (last != NULL && cmd->data.draw.first == vertex_end) {
+            /* The vertices follow the last copy's, so extend that command
+               and give this one back to the pool. */
+            last->data.draw.count += cmd->data.draw.count;
+            last->next = NULL;
+            renderer->render_commands_tail = last;
+            cmd->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = cmd;
         }
     }
     return retval;
@@ -548,6 +920,7 @@ QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture * texture,
 
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
+static int SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture);
 
 int
 SDL_GetNumRenderDrivers(void)
@@ -581,6 +954,15 @@ static void GetWindowViewportValues(SDL_Renderer *renderer, int *logical_w, int
     *logical_h = renderer->target ? renderer->logical_h_backup : renderer->logical_h;
     *viewport = renderer->target ? renderer->viewport_backup : renderer->viewport;
     *scale = renderer->target ? renderer->scale_backup : renderer->scale;
+    if (renderer->logical_presentation) {
+        /* The logical output is scaled into the logical viewport when presenting */
+        viewport->x = renderer->logical_viewport.x + (int)(viewport->x * renderer->logical_scale.x);
+        viewport->y = renderer->logical_viewport.y + (int)(viewport->y * renderer->logical_scale.y);
+        viewport->w = (int)(viewport->w * renderer->logical_scale.x);
+        viewport->h = (int)(viewport->h * renderer->logical_scale.y);
+        scale->x *= renderer->logical_scale.x;
+        scale->y *= renderer->logical_scale.y;
+    }
     SDL_UnlockMutex(renderer->target_mutex);
 }
 
@@ -600,7 +982,7 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
                 /* Make sure we're operating on the default render target */
                 SDL_Texture *saved_target = SDL_GetRenderTarget(renderer);
                 if (saved_target) {
-                    SDL_SetRenderTarget(renderer, NULL);
+                    SetRenderTarget(renderer, NULL);
                 }
 
                 if (renderer->logical_w) {
@@ -631,7 +1013,7 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
                 }
 
                 if (saved_target) {
-                    SDL_SetRenderTarget(renderer, saved_target);
+                    SetRenderTarget(renderer, saved_target);
                 }
             } else if (event->window.event == SDL_WINDOWEVENT_HIDDEN) {
                 renderer->hidden = SDL_TRUE;
@@ -1434,17 +1816,17 @@ SDL_UpdateTextureYUV(SDL_Texture * texture, const SDL_Rect * rect,
                      const void *pixels, int pitch)
 {
     SDL_Texture *native = texture->native;
-    SDL_Rect full_rect;
+    SDL_Rect dirty_rect;
 
     if (SDL_SW_UpdateYUVTexture(texture->yuv, rect, pixels, pitch) < 0) {
         return -1;
     }
 
-    full_rect.x = 0;
-    full_rect.y = 0;
-    full_rect.w = texture->w;
-    full_rect.h = texture->h;
-    rect = &full_rect;
+    /* Only the rows that changed are converted again */
+    if (!SDL_SW_GetYUVTextureDirtyRows(texture->yuv, &dirty_rect)) {
+        return 0;
+    }
+    rect = &dirty_rect;
 
     if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
         /* We can lock the texture and copy to it */
@@ -1553,6 +1935,7 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        CountTextureUpload(texture, rect);
         return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1565,17 +1948,17 @@ SDL_UpdateTextureYUVPlanar(SDL_Texture * texture, const SDL_Rect * rect,
                            const Uint8 *Vplane, int Vpitch)
 {
     SDL_Texture *native = texture->native;
-    SDL_Rect full_rect;
+    SDL_Rect dirty_rect;
 
     if (SDL_SW_UpdateYUVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch) < 0) {
         return -1;
     }
 
-    full_rect.x = 0;
-    full_rect.y = 0;
-    full_rect.w = texture->w;
-    full_rect.h = texture->h;
-    rect = &full_rect;
+    /* Only the rows that changed are converted again */
+    if (!SDL_SW_GetYUVTextureDirtyRows(texture->yuv, &dirty_rect)) {
+        return 0;
+    }
+    rect = &dirty_rect;
 
     if (!rect->w || !rect->h) {
         return 0;  /* nothing to do. */
@@ -1668,6 +2051,7 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
+            CountTextureUpload(texture, rect);
             return renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -1735,6 +2119,7 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        texture->locked_rect = *rect;  /* counted as uploaded when unlocked */
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1785,10 +2170,10 @@ SDL_UnlockTextureYUV(SDL_Texture * texture)
     int native_pitch = 0;
     SDL_Rect rect;
 
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = texture->w;
-    rect.h = texture->h;
+    /* Only the rows that were locked are converted again */
+    if (!SDL_SW_GetYUVTextureDirtyRows(texture->yuv, &rect)) {
+        return;
+    }
 
     if (SDL_LockTexture(native, &rect, &native_pixels, &native_pitch) < 0) {
         return;
@@ -1837,6 +2222,7 @@ SDL_UnlockTexture(SDL_Texture * texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        CountTextureUpload(texture, &texture->locked_rect);
         renderer->UnlockTexture(renderer, texture);
     }
 
@@ -1853,17 +2239,9 @@ SDL_RenderTargetSupported(SDL_Renderer *renderer)
     return (renderer->info.flags & SDL_RENDERER_TARGETTEXTURE) != 0;
 }
 
-int
-SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
+static int
+SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
 {
-    if (!SDL_RenderTargetSupported(renderer)) {
-        return SDL_Unsupported();
-    }
-    if (texture == renderer->target) {
-        /* Nothing to do! */
-        return 0;
-    }
-
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
     /* texture == NULL is valid and means reset the target to the window */
@@ -1898,6 +2276,7 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         SDL_UnlockMutex(renderer->target_mutex);
         return -1;
     }
+    renderer->stats.target_switches++;
 
     if (texture) {
         renderer->viewport.x = 0;
@@ -1932,6 +2311,22 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
     return FlushRenderCommandsIfNotBatching(renderer);
 }
 
+int
+SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    if (!SDL_RenderTargetSupported(renderer)) {
+        return SDL_Unsupported();
+    }
+    if (texture == renderer->target) {
+        /* Nothing to do! */
+        return 0;
+    }
+    if (renderer->recording) {
+        return SDL_SetError("Can't change the render target while recording");
+    }
+    return SetRenderTarget(renderer, texture);
+}
+
 SDL_Texture *
 SDL_GetRenderTarget(SDL_Renderer *renderer)
 {
@@ -1991,12 +2386,13 @@ UpdateLogicalSize(SDL_Renderer *renderer)
         viewport.x = (w - viewport.w) / 2;
         viewport.h = (int)SDL_ceil(renderer->logical_h * scale);
         viewport.y = (h - viewport.h) / 2;
-
-        SDL_RenderSetViewport(renderer, &viewport);
     } else if (SDL_fabs(want_aspect-real_aspect) < 0.0001) {
         /* The aspect ratios are the same, just scale appropriately */
         scale = (float)w / renderer->logical_w;
-        SDL_RenderSetViewport(renderer, NULL);
+        viewport.x = 0;
+        viewport.y = 0;
+        viewport.w = w;
+        viewport.h = h;
     } else if (want_aspect > real_aspect) {
         if (scale_policy == 1) {
             /* We want a wider aspect ratio than is available - 
@@ -2008,7 +2404,6 @@ UpdateLogicalSize(SDL_Renderer *renderer)
             viewport.h = h;
             viewport.w = (int)SDL_ceil(renderer->logical_w * scale);
             viewport.x = (w - viewport.w) / 2;
-            SDL_RenderSetViewport(renderer, &viewport);
         } else {
             /* We want a wider aspect ratio than is available - letterbox it */
             scale = (float)w / renderer->logical_w;
@@ -2016,7 +2411,6 @@ UpdateLogicalSize(SDL_Renderer *renderer)
             viewport.w = w;
             viewport.h = (int)SDL_ceil(renderer->logical_h * scale);
             viewport.y = (h - viewport.h) / 2;
-            SDL_RenderSetViewport(renderer, &viewport);
         }
     } else {
         if (scale_policy == 1) {
@@ -2029,7 +2423,6 @@ UpdateLogicalSize(SDL_Renderer *renderer)
             viewport.w = w;
             viewport.h = (int)SDL_ceil(renderer->logical_h * scale);
             viewport.y = (h - viewport.h) / 2;
-            SDL_RenderSetViewport(renderer, &viewport);
         } else {
             /* We want a narrower aspect ratio than is available - use side-bars */
              scale = (float)h / renderer->logical_h;
@@ -2037,10 +2430,23 @@ UpdateLogicalSize(SDL_Renderer *renderer)
              viewport.h = h;
              viewport.w = (int)SDL_ceil(renderer->logical_w * scale);
              viewport.x = (w - viewport.w) / 2;
-             SDL_RenderSetViewport(renderer, &viewport);
         }
     }
 
+    if (renderer->SetLogicalPresentation && !renderer->target) {
+        /* Draw at the logical size, the backend scales it into the viewport when presenting */
+        if (renderer->SetLogicalPresentation(renderer, renderer->logical_w, renderer->logical_h, &viewport, SDL_GetScaleMode()) < 0) {
+            return -1;
+        }
+        renderer->logical_presentation = SDL_TRUE;
+        renderer->logical_viewport = viewport;
+        renderer->logical_scale.x = scale;
+        renderer->logical_scale.y = scale;
+        return SDL_RenderSetViewport(renderer, NULL);
+    }
+
+    SDL_RenderSetViewport(renderer, &viewport);
+
     /* Set the new scale */
     SDL_RenderSetScale(renderer, scale, scale);
 
@@ -2056,6 +2462,10 @@ SDL_RenderSetLogicalSize(SDL_Renderer * renderer, int w, int h)
         /* Clear any previous logical resolution */
         renderer->logical_w = 0;
         renderer->logical_h = 0;
+        if (renderer->logical_presentation) {
+            renderer->SetLogicalPresentation(renderer, 0, 0, NULL, SDL_ScaleModeNearest);
+            renderer->logical_presentation = SDL_FALSE;
+        }
         SDL_RenderSetViewport(renderer, NULL);
         SDL_RenderSetScale(renderer, 1.0f, 1.0f);
         return 0;
@@ -2109,6 +2519,12 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
         renderer->viewport.y = (int)SDL_floor(rect->y * renderer->scale.y);
         renderer->viewport.w = (int)SDL_ceil(rect->w * renderer->scale.x);
         renderer->viewport.h = (int)SDL_ceil(rect->h * renderer->scale.y);
+    } else if (renderer->logical_presentation && !renderer->target) {
+        /* The backend draws at the logical size */
+        renderer->viewport.x = 0;
+        renderer->viewport.y = 0;
+        renderer->viewport.w = renderer->logical_w;
+        renderer->viewport.h = renderer->logical_h;
     } else {
         renderer->viewport.x = 0;
         renderer->viewport.y = 0;
@@ -2999,7 +3415,129 @@ SDL_RenderCopyF(SDL_Renderer * renderer, SDL_Texture * texture,
 
     texture->last_command_generation = renderer->render_command_generation;
 
-    retval = QueueCmdCopy(renderer, texture, &real_srcrect, &real_dstrect);
+    retval = QueueCmdCopies(renderer, texture, &real_srcrect, &real_dstrect, 1);
+    return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
+}
+
+int
+SDL_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                 const SDL_Rect * srcrects, const SDL_Rect * dstrects, int count)
+{
+    SDL_FRect *dstfrects;
+    int i;
+    int retval;
+    SDL_bool isstack;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!dstrects) {
+        return SDL_SetError("SDL_RenderCopies(): Passed NULL dstrects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    dstfrects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    if (!dstfrects) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < count; ++i) {
+        dstfrects[i].x = (float) dstrects[i].x;
+        dstfrects[i].y = (float) dstrects[i].y;
+        dstfrects[i].w = (float) dstrects[i].w;
+        dstfrects[i].h = (float) dstrects[i].h;
+    }
+
+    retval = SDL_RenderCopiesF(renderer, texture, srcrects, dstfrects, count);
+
+    SDL_small_free(dstfrects, isstack);
+
+    return retval;
+}
+
+int
+SDL_RenderCopiesF(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count)
+{
+    SDL_Rect *real_srcrects;
+    SDL_FRect *real_dstrects;
+    SDL_FRect viewport;
+    SDL_Rect r;
+    int i, num_copies;
+    int retval;
+    SDL_bool srcstack, dststack;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!dstrects) {
+        return SDL_SetError("SDL_RenderCopiesF(): Passed NULL dstrects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    real_srcrects = SDL_small_alloc(SDL_Rect, count, &srcstack);
+    real_dstrects = SDL_small_alloc(SDL_FRect, count, &dststack);
+    if (!real_srcrects || !real_dstrects) {
+        SDL_small_free(real_srcrects, srcstack);
+        SDL_small_free(real_dstrects, dststack);
+        return SDL_OutOfMemory();
+    }
+
+    SDL_zero(r);
+    SDL_RenderGetViewport(renderer, &r);
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.w = (float) r.w;
+    viewport.h = (float) r.h;
+
+    /* Clip each copy like SDL_RenderCopyF() does, dropping the ones that draw nothing */
+    num_copies = 0;
+    for (i = 0; i < count; ++i) {
+        SDL_Rect *srcrect = &real_srcrects[num_copies];
+        SDL_FRect *dstrect = &real_dstrects[num_copies];
+
+        srcrect->x = 0;
+        srcrect->y = 0;
+        srcrect->w = texture->w;
+        srcrect->h = texture->h;
+        if (srcrects) {
+            if (!SDL_IntersectRect(&srcrects[i], srcrect, srcrect)) {
+                continue;
+            }
+        }
+        if (!SDL_HasIntersectionF(&dstrects[i], &viewport)) {
+            continue;
+        }
+        dstrect->x = dstrects[i].x * renderer->scale.x;
+        dstrect->y = dstrects[i].y * renderer->scale.y;
+        dstrect->w = dstrects[i].w * renderer->scale.x;
+        dstrect->h = dstrects[i].h * renderer->scale.y;
+        ++num_copies;
+    }
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    retval = 0;
+    if (num_copies > 0) {
+        texture->last_command_generation = renderer->render_command_generation;
+        retval = QueueCmdCopies(renderer, texture, real_srcrects, real_dstrects, num_copies);
+    }
+
+    SDL_small_free(real_srcrects, srcstack);
+    SDL_small_free(real_dstrects, dststack);
+
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
 
@@ -3146,6 +3684,27 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                       format, pixels, pitch);
 }
 
+static void
+AddRenderStats(SDL_RenderStats *total, const SDL_RenderStats *frame)
+{
+    total->viewport_commands += frame->viewport_commands;
+    total->cliprect_commands += frame->cliprect_commands;
+    total->drawcolor_commands += frame->drawcolor_commands;
+    total->clear_commands += frame->clear_commands;
+    total->point_commands += frame->point_commands;
+    total->line_commands += frame->line_commands;
+    total->fillrect_commands += frame->fillrect_commands;
+    total->copy_commands += frame->copy_commands;
+    total->copyex_commands += frame->copyex_commands;
+    total->vertex_bytes += frame->vertex_bytes;
+    total->flushes += frame->flushes;
+    total->texture_uploads += frame->texture_uploads;
+    total->texture_upload_bytes += frame->texture_upload_bytes;
+    total->target_switches += frame->target_switches;
+    total->run_queue_us += frame->run_queue_us;
+    total->present_us += frame->present_us;
+}
+
 void
 SDL_RenderPresent(SDL_Renderer * renderer)
 {
@@ -3154,10 +3713,16 @@ SDL_RenderPresent(SDL_Renderer * renderer)
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
     /* Don't present while we're hidden */
-    if (renderer->hidden) {
-        return;
+    if (!renderer->hidden) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        renderer->RenderPresent(renderer);
+        renderer->stats.present_us += SDL_GetPerformanceCounter() - start;
     }
-    renderer->RenderPresent(renderer);
+
+    /* The frame is done, start counting the next one */
+    AddRenderStats(&renderer->total_stats, &renderer->stats);
+    renderer->last_frame_stats = renderer->stats;
+    SDL_zero(renderer->stats);
 }
 
 void
@@ -3168,11 +3733,29 @@ SDL_DestroyTexture(SDL_Texture * texture)
     CHECK_TEXTURE_MAGIC(texture, );
 
     renderer = texture->renderer;
+    if (renderer->recording) {
+        /* The queue isn't flushed while recording, drop the copies of this texture instead */
+        SDL_RenderCommand *cmd;
+        for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+            if ((cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX) &&
+                cmd->data.draw.texture == texture) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+            }
+        }
+    }
     if (texture == renderer->target) {
-        SDL_SetRenderTarget(renderer, NULL);  /* implies command queue flush */
+        if (renderer->recording) {
+            /* Everything recorded was drawn to this texture, the list can't be replayed */
+            DiscardRenderCommands(renderer);
+            renderer->recording_target_lost = SDL_TRUE;
+        }
+        SetRenderTarget(renderer, NULL);  /* implies command queue flush */
     } else {
         FlushRenderCommandsIfTextureNeeded(texture);
     }
+    if (texture->refcount > 0) {
+        InvalidateCommandLists(renderer, texture);
+    }
 
     texture->magic = NULL;
 
@@ -3231,6 +3814,9 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_free(renderer->vertex_data);
 
+    /* Stop recording, nothing can be queued anymore */
+    renderer->recording = SDL_FALSE;
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_Texture *tex = renderer->textures; (void) tex;
@@ -3238,6 +3824,17 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
         SDL_assert(tex != renderer->textures);  /* satisfy static analysis. */
     }
 
+    /* The application still owns the command lists, detach them */
+    while (renderer->command_lists) {
+        SDL_RenderCommandList *list = renderer->command_lists;
+        ReleaseCommandListTextures(list);
+        list->valid = SDL_FALSE;
+        list->renderer = NULL;
+        list->prev = NULL;
+        renderer->command_lists = list->next;
+        list->next = NULL;
+    }
+
     if (renderer->window) {
         SDL_SetWindowData(renderer->window, SDL_WINDOWRENDERDATA, NULL);
     }
@@ -3309,6 +3906,56 @@ SDL_RenderGetMetalCommandEncoder(SDL_Renderer * renderer)
     return NULL;
 }
 
+static Uint64
+TicksToMicroseconds(Uint64 ticks, Uint64 frequency)
+{
+    /* split up so long running totals don't overflow */
+    return (ticks / frequency) * 1000000 + ((ticks % frequency) * 1000000) / frequency;
+}
+
+static void
+ConvertRenderStats(SDL_RenderStats *stats, const SDL_RenderStats *ticks)
+{
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    *stats = *ticks;
+    stats->run_queue_us = TicksToMicroseconds(ticks->run_queue_us, frequency);
+    stats->present_us = TicksToMicroseconds(ticks->present_us, frequency);
+}
+
+int
+SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats *frame, SDL_RenderStats *total)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (frame) {
+        ConvertRenderStats(frame, &renderer->last_frame_stats);
+    }
+    if (total) {
+        ConvertRenderStats(total, &renderer->total_stats);
+    }
+    return 0;
+}
+
+int
+SDL_RenderGetCopyExCacheStats(SDL_Renderer * renderer, Uint64 *hits, Uint64 *misses)
+{
+    Uint64 cache_hits = 0, cache_misses = 0;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (renderer->GetCopyExCacheStats) {
+        renderer->GetCopyExCacheStats(renderer, &cache_hits, &cache_misses);
+    }
+    if (hits) {
+        *hits = cache_hits;
+    }
+    if (misses) {
+        *misses = cache_misses;
+    }
+    return 0;
+}
+
 static SDL_BlendMode
 SDL_GetShortBlendMode(SDL_BlendMode blendMode)
 {
@@ -3327,6 +3974,9 @@ SDL_GetShortBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL_FULL) {
         return SDL_BLENDMODE_MUL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
     return blendMode;
 }
 
@@ -3348,6 +3998,9 @@ SDL_GetLongBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL) {
         return SDL_BLENDMODE_MUL_FULL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL;
+    }
     return blendMode;
 }
 
@@ -56,6 +56,7 @@ struct SDL_Texture
     SDL_Surface *locked_surface;  /**< Locked region exposed as a SDL surface */
 
     Uint32 last_command_generation; /* last command queue generation this texture was in. */
+    int refcount;               /**< Number of recorded command lists using this texture */
 
     void *driverdata;           /**< Driver specific texture representation */
 
@@ -104,6 +105,24 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+/* Command lists are replayed at this alignment so the offsets recorded in
+   them keep the alignment the backend asked SDL_AllocateRenderVertices for. */
+#define SDL_RENDER_COMMAND_LIST_ALIGNMENT 256
+
+struct SDL_RenderCommandList
+{
+    SDL_Renderer *renderer;     /**< NULL once the renderer is destroyed */
+    SDL_bool valid;             /**< SDL_FALSE once a texture it uses is destroyed */
+    SDL_RenderCommand *commands;
+    size_t num_commands;
+    void *vertex_data;
+    size_t vertex_data_used;
+    SDL_Texture **textures;     /**< The textures the commands use, each counted once */
+    int num_textures;
+    SDL_RenderCommandList *prev;
+    SDL_RenderCommandList *next;
+};
+
 
 /* Define the SDL renderer structure */
 struct SDL_Renderer
@@ -112,6 +131,10 @@ struct SDL_Renderer
 
     void (*WindowEvent) (SDL_Renderer * renderer, const SDL_WindowEvent *event);
     int (*GetOutputSize) (SDL_Renderer * renderer, int *w, int *h);
+    /* Optional, draw at the logical size and scale the result into viewport
+       when presenting. logical_w and logical_h are 0 to stop doing that. */
+    int (*SetLogicalPresentation) (SDL_Renderer * renderer, int logical_w, int logical_h,
+                                   const SDL_Rect * viewport, SDL_ScaleMode scaleMode);
     SDL_bool (*SupportsBlendMode)(SDL_Renderer * renderer, SDL_BlendMode blendMode);
     int (*CreateTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
     int (*QueueSetViewport) (SDL_Renderer * renderer, SDL_RenderCommand *cmd);
@@ -124,6 +147,10 @@ struct SDL_Renderer
                             int count);
     int (*QueueCopy) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                        const SDL_Rect * srcrect, const SDL_FRect * dstrect);
+    /* Optional, queues count copies into one SDL_RENDERCMD_COPY, so only for
+       backends that draw cmd->data.draw.count copies per command */
+    int (*QueueCopies) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                        const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count);
     int (*QueueCopyEx) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                         const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                         const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
@@ -148,6 +175,8 @@ struct SDL_Renderer
 
     void (*DestroyRenderer) (SDL_Renderer * renderer);
 
+    void (*GetCopyExCacheStats) (SDL_Renderer * renderer, Uint64 *hits, Uint64 *misses);
+
     int (*GL_BindTexture) (SDL_Renderer * renderer, SDL_Texture *texture, float *texw, float *texh);
     int (*GL_UnbindTexture) (SDL_Renderer * renderer, SDL_Texture *texture);
 
@@ -170,6 +199,12 @@ struct SDL_Renderer
     /* Whether or not to force the viewport to even integer intervals */
     SDL_bool integer_scale;
 
+    /* Whether the backend scales the logical output when presenting, and
+       where in the window and by how much */
+    SDL_bool logical_presentation;
+    SDL_Rect logical_viewport;
+    SDL_FPoint logical_scale;
+
     /* The drawable area within the window */
     SDL_Rect viewport;
     SDL_Rect viewport_backup;
@@ -206,6 +241,15 @@ struct SDL_Renderer
 
     SDL_bool always_batch;
     SDL_bool batching;
+    SDL_bool coalesce_copies;           /**< The backend can draw SDL_RENDERCMD_COPY with a count above one */
+    SDL_bool recording;                 /**< Between SDL_RenderBeginRecording() and SDL_RenderEndRecording() */
+    SDL_bool recording_target_lost;     /**< The render target was destroyed while recording */
+    SDL_RenderCommandList *command_lists;
+
+    /* Work counters, the times are kept in performance counter ticks */
+    SDL_RenderStats stats;              /**< The frame being rendered */
+    SDL_RenderStats last_frame_stats;
+    SDL_RenderStats total_stats;
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
     SDL_RenderCommand *render_commands_pool;
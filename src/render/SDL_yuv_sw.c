@@ -27,6 +27,7 @@
 #include "SDL_assert.h"
 
 #include "SDL_yuv_sw_c.h"
+#include "../video/SDL_yuv_c.h"
 
 
 SDL_SW_YUVTexture *
@@ -42,6 +43,8 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     case SDL_PIXELFORMAT_YVYU:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         break;
     default:
         SDL_SetError("Unsupported YUV format");
@@ -81,11 +84,17 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
                 dst_size = sz_plane + sz_plane_chroma + sz_plane_chroma;
                 break;
 
+            case SDL_PIXELFORMAT_P010: /**< Planar mode: Y + U/V interleaved, 10 bits in the high bits of 16 bit samples (2 planes) */
+            case SDL_PIXELFORMAT_P016: /**< Planar mode: Y + U/V interleaved, 16 bit samples (2 planes) */
+                dst_size = 2 * (sz_plane + sz_plane_chroma + sz_plane_chroma);
+                break;
+
             default:
                 SDL_assert(0 && "We should never get here (caught above)");
                 break;
         }
-        swdata->pixels = (Uint8 *) SDL_malloc(dst_size);
+        /* Cleared, so the first updates compare against defined data */
+        swdata->pixels = (Uint8 *) SDL_calloc(1, dst_size);
         if (!swdata->pixels) {
             SDL_SW_DestroyYUVTexture(swdata);
             SDL_OutOfMemory();
@@ -119,15 +128,80 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         break;
 
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        swdata->pitches[0] = 2 * w;
+        swdata->pitches[1] = 4 * ((w + 1) / 2);
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        break;
+
     default:
         SDL_assert(0 && "We should never get here (caught above)");
         break;
     }
 
+    /* Nothing has been converted yet */
+    swdata->dirty.w = w;
+    swdata->dirty.h = h;
+    swdata->stretch_dirty = swdata->dirty;
+
     /* We're all done.. */
     return (swdata);
 }
 
+static void
+SDL_SW_MarkYUVTextureDirty(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect)
+{
+    SDL_UnionRect(&swdata->dirty, rect, &swdata->dirty);
+    SDL_UnionRect(&swdata->stretch_dirty, rect, &swdata->stretch_dirty);
+}
+
+/* Copies rows of a plane, setting *changed if any of them were different.
+   This way uploading the same frame again doesn't convert it again.
+ */
+static void
+SDL_SW_CopyYUVRows(Uint8 *dst, int dst_pitch, const Uint8 *src, int src_pitch,
+                   size_t length, int rows, SDL_bool *changed)
+{
+    int row;
+
+    for (row = 0; row < rows; ++row) {
+        if (*changed || SDL_memcmp(dst, src, length) != 0) {
+            SDL_memcpy(dst, src, length);
+            *changed = SDL_TRUE;
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+
+/* Expands an area to the full width rows that have to be converted again,
+   starting on an even row when the chroma is shared by pairs of rows.
+ */
+static void
+SDL_SW_GetYUVRows(SDL_SW_YUVTexture * swdata, const SDL_Rect * area, SDL_Rect * rect)
+{
+    rect->x = 0;
+    rect->y = area->y;
+    rect->w = swdata->w;
+    rect->h = area->h;
+    switch (swdata->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        rect->h += (rect->y & 1);
+        rect->y &= ~1;
+        rect->h = SDL_min(rect->h + (rect->h & 1), swdata->h - rect->y);
+        break;
+    default:
+        break;
+    }
+}
+
 int
 SDL_SW_QueryYUVTexturePixels(SDL_SW_YUVTexture * swdata, void **pixels,
                              int *pitch)
@@ -141,38 +215,31 @@ int
 SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
                         const void *pixels, int pitch)
 {
+    SDL_bool changed = SDL_FALSE;
+
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
         if (rect->x == 0 && rect->y == 0 &&
             rect->w == swdata->w && rect->h == swdata->h) {
-                SDL_memcpy(swdata->pixels, pixels,
-                           (swdata->h * swdata->w) + 2* ((swdata->h + 1) /2) * ((swdata->w + 1) / 2));
+                SDL_SW_CopyYUVRows(swdata->pixels, 0, pixels, 0,
+                           (swdata->h * swdata->w) + 2* ((swdata->h + 1) /2) * ((swdata->w + 1) / 2), 1, &changed);
         } else {
             Uint8 *src, *dst;
-            int row;
             size_t length;
 
             /* Copy the Y plane */
             src = (Uint8 *) pixels;
             dst = swdata->pixels + rect->y * swdata->w + rect->x;
             length = rect->w;
-            for (row = 0; row < rect->h; ++row) {
-                SDL_memcpy(dst, src, length);
-                src += pitch;
-                dst += swdata->w;
-            }
+            SDL_SW_CopyYUVRows(dst, swdata->w, src, pitch, length, rect->h, &changed);
             
             /* Copy the next plane */
             src = (Uint8 *) pixels + rect->h * pitch;
             dst = swdata->pixels + swdata->h * swdata->w;
             dst += rect->y/2 * ((swdata->w + 1) / 2) + rect->x/2;
             length = (rect->w + 1) / 2;
-            for (row = 0; row < (rect->h + 1)/2; ++row) {
-                SDL_memcpy(dst, src, length);
-                src += (pitch + 1)/2;
-                dst += (swdata->w + 1)/2;
-            }
+            SDL_SW_CopyYUVRows(dst, (swdata->w + 1)/2, src, (pitch + 1)/2, length, (rect->h + 1)/2, &changed);
 
             /* Copy the next plane */
             src = (Uint8 *) pixels + rect->h * pitch + ((rect->h + 1) / 2) * ((pitch + 1) / 2);
@@ -180,11 +247,7 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
                   ((swdata->h + 1)/2) * ((swdata->w+1) / 2);
             dst += rect->y/2 * ((swdata->w + 1)/2) + rect->x/2;
             length = (rect->w + 1) / 2;
-            for (row = 0; row < (rect->h + 1)/2; ++row) {
-                SDL_memcpy(dst, src, length);
-                src += (pitch + 1)/2;
-                dst += (swdata->w + 1)/2;
-            }
+            SDL_SW_CopyYUVRows(dst, (swdata->w + 1)/2, src, (pitch + 1)/2, length, (rect->h + 1)/2, &changed);
         }
         break;
     case SDL_PIXELFORMAT_YUY2:
@@ -192,7 +255,6 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     case SDL_PIXELFORMAT_YVYU:
         {
             Uint8 *src, *dst;
-            int row;
             size_t length;
 
             src = (Uint8 *) pixels;
@@ -200,47 +262,57 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
                 swdata->planes[0] + rect->y * swdata->pitches[0] +
                 rect->x * 2;
             length = 4 * ((rect->w + 1) / 2);
-            for (row = 0; row < rect->h; ++row) {
-                SDL_memcpy(dst, src, length);
-                src += pitch;
-                dst += swdata->pitches[0];
-            }
+            SDL_SW_CopyYUVRows(dst, swdata->pitches[0], src, pitch, length, rect->h, &changed);
         }
         break;
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
         {
             if (rect->x == 0 && rect->y == 0 && rect->w == swdata->w && rect->h == swdata->h) {
-                SDL_memcpy(swdata->pixels, pixels,
-                        (swdata->h * swdata->w) + 2* ((swdata->h + 1) /2) * ((swdata->w + 1) / 2));
+                SDL_SW_CopyYUVRows(swdata->pixels, 0, pixels, 0,
+                        (swdata->h * swdata->w) + 2* ((swdata->h + 1) /2) * ((swdata->w + 1) / 2), 1, &changed);
             } else {
 
                 Uint8 *src, *dst;
-                int row;
                 size_t length;
 
                 /* Copy the Y plane */
                 src = (Uint8 *) pixels;
                 dst = swdata->pixels + rect->y * swdata->w + rect->x;
                 length = rect->w;
-                for (row = 0; row < rect->h; ++row) {
-                    SDL_memcpy(dst, src, length);
-                    src += pitch;
-                    dst += swdata->w;
-                }
+                SDL_SW_CopyYUVRows(dst, swdata->w, src, pitch, length, rect->h, &changed);
                 
                 /* Copy the next plane */
                 src = (Uint8 *) pixels + rect->h * pitch;
                 dst = swdata->pixels + swdata->h * swdata->w;
                 dst += 2 * ((rect->y + 1)/2) * ((swdata->w + 1) / 2) + 2 * (rect->x/2);
                 length = 2 * ((rect->w + 1) / 2);
-                for (row = 0; row < (rect->h + 1)/2; ++row) {
-                    SDL_memcpy(dst, src, length);
-                    src += 2 * ((pitch + 1)/2);
-                    dst += 2 * ((swdata->w + 1)/2);
-                }
+                SDL_SW_CopyYUVRows(dst, 2 * ((swdata->w + 1)/2), src, 2 * ((pitch + 1)/2), length, (rect->h + 1)/2, &changed);
             }
         }
+        break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        {
+            Uint8 *src, *dst;
+            size_t length;
+
+            /* Copy the Y plane */
+            src = (Uint8 *) pixels;
+            dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x * 2;
+            length = rect->w * 2;
+            SDL_SW_CopyYUVRows(dst, swdata->pitches[0], src, pitch, length, rect->h, &changed);
+
+            /* Copy the U/V plane */
+            src = (Uint8 *) pixels + rect->h * pitch;
+            dst = swdata->planes[1] + (rect->y / 2) * swdata->pitches[1] + (rect->x / 2) * 4;
+            length = 4 * ((rect->w + 1) / 2);
+            SDL_SW_CopyYUVRows(dst, swdata->pitches[1], src, 4 * ((pitch + 3) / 4), length, (rect->h + 1) / 2, &changed);
+        }
+        break;
+    }
+    if (changed) {
+        SDL_SW_MarkYUVTextureDirty(swdata, rect);
     }
     return 0;
 }
@@ -253,18 +325,14 @@ SDL_SW_UpdateYUVTexturePlanar(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
 {
     const Uint8 *src;
     Uint8 *dst;
-    int row;
     size_t length;
+    SDL_bool changed = SDL_FALSE;
 
     /* Copy the Y plane */
     src = Yplane;
     dst = swdata->pixels + rect->y * swdata->w + rect->x;
     length = rect->w;
-    for (row = 0; row < rect->h; ++row) {
-        SDL_memcpy(dst, src, length);
-        src += Ypitch;
-        dst += swdata->w;
-    }
+    SDL_SW_CopyYUVRows(dst, swdata->w, src, Ypitch, length, rect->h, &changed);
 
     /* Copy the U plane */
     src = Uplane;
@@ -276,11 +344,7 @@ SDL_SW_UpdateYUVTexturePlanar(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     }
     dst += rect->y/2 * ((swdata->w + 1)/2) + rect->x/2;
     length = (rect->w + 1) / 2;
-    for (row = 0; row < (rect->h + 1)/2; ++row) {
-        SDL_memcpy(dst, src, length);
-        src += Upitch;
-        dst += (swdata->w + 1)/2;
-    }
+    SDL_SW_CopyYUVRows(dst, (swdata->w + 1)/2, src, Upitch, length, (rect->h + 1)/2, &changed);
 
     /* Copy the V plane */
     src = Vplane;
@@ -292,10 +356,10 @@ SDL_SW_UpdateYUVTexturePlanar(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     }
     dst += rect->y/2 * ((swdata->w + 1)/2) + rect->x/2;
     length = (rect->w + 1) / 2;
-    for (row = 0; row < (rect->h + 1)/2; ++row) {
-        SDL_memcpy(dst, src, length);
-        src += Vpitch;
-        dst += (swdata->w + 1)/2;
+    SDL_SW_CopyYUVRows(dst, (swdata->w + 1)/2, src, Vpitch, length, (rect->h + 1)/2, &changed);
+
+    if (changed) {
+        SDL_SW_MarkYUVTextureDirty(swdata, rect);
     }
     return 0;
 }
@@ -309,19 +373,29 @@ SDL_SW_LockYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     case SDL_PIXELFORMAT_IYUV:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         if (rect
             && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w
                 || rect->h != swdata->h)) {
             return SDL_SetError
-                ("YV12, IYUV, NV12, NV21 textures only support full surface locks");
+                ("YV12, IYUV, NV12, NV21, P010, P016 textures only support full surface locks");
         }
         break;
     }
 
     if (rect) {
         *pixels = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x * 2;
+        SDL_SW_MarkYUVTextureDirty(swdata, rect);
     } else {
+        SDL_Rect full_rect;
+
+        full_rect.x = 0;
+        full_rect.y = 0;
+        full_rect.w = swdata->w;
+        full_rect.h = swdata->h;
         *pixels = swdata->planes[0];
+        SDL_SW_MarkYUVTextureDirty(swdata, &full_rect);
     }
     *pitch = swdata->pitches[0];
     return 0;
@@ -332,70 +406,102 @@ SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture * swdata)
 {
 }
 
+SDL_bool
+SDL_SW_GetYUVTextureDirtyRows(SDL_SW_YUVTexture * swdata, SDL_Rect * rect)
+{
+    if (SDL_RectEmpty(&swdata->dirty)) {
+        return SDL_FALSE;
+    }
+    SDL_SW_GetYUVRows(swdata, &swdata->dirty, rect);
+    return SDL_TRUE;
+}
+
 int
 SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
                     Uint32 target_format, int w, int h, void *pixels,
                     int pitch)
 {
-    int stretch;
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+    SDL_Rect rows;
 
     /* Make sure we're set up to display in the desired format */
-    if (target_format != swdata->target_format && swdata->display) {
+    if (target_format != swdata->target_format) {
         SDL_FreeSurface(swdata->display);
         swdata->display = NULL;
+        SDL_FreeSurface(swdata->stretch);
+        swdata->stretch = NULL;
+        swdata->target_format = target_format;
     }
 
-    stretch = 0;
-    if (srcrect->x || srcrect->y || srcrect->w < swdata->w || srcrect->h < swdata->h) {
-        /* The source rectangle has been clipped.
-           Using a scratch surface is easier than adding clipped
-           source support to all the blitters, plus that would
-           slow them down in the general unclipped case.
-         */
-        stretch = 1;
-    } else if ((srcrect->w != w) || (srcrect->h != h)) {
-        stretch = 1;
+    if (srcrect->x == 0 && srcrect->w == swdata->w &&
+        srcrect->w == w && srcrect->h == h) {
+        SDL_SW_GetYUVRows(swdata, srcrect, &rows);
+        if (rows.y == srcrect->y && rows.h == srcrect->h) {
+            /* Whole rows are converted straight into the destination.
+               Large frames are split across the SDL_HINT_BLIT_THREADS threads.
+             */
+            SDL_zero(swdata->dirty);
+            return SDL_ConvertPixels_YUV_to_RGB_Rows(swdata->w, swdata->h,
+                                                     rows.y, rows.h, swdata->format,
+                                                     swdata->planes[0], swdata->pitches[0],
+                                                     target_format, pixels, pitch);
+        }
     }
-    if (stretch) {
-        int bpp;
-        Uint32 Rmask, Gmask, Bmask, Amask;
-
-        if (swdata->display) {
-            swdata->display->w = w;
-            swdata->display->h = h;
-            swdata->display->pixels = pixels;
-            swdata->display->pitch = pitch;
-        } else {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->display =
-                SDL_CreateRGBSurfaceFrom(pixels, w, h, bpp, pitch, Rmask,
-                                         Gmask, Bmask, Amask);
-            if (!swdata->display) {
-                return (-1);
-            }
+
+    /* The source rectangle has been clipped or scaled.
+       Using a scratch surface is easier than adding clipped
+       source support to all the blitters, plus that would
+       slow them down in the general unclipped case.
+     */
+    if (swdata->display) {
+        swdata->display->w = w;
+        swdata->display->h = h;
+        swdata->display->pixels = pixels;
+        swdata->display->pitch = pitch;
+    } else {
+        /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
+        SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
+                                   &Bmask, &Amask);
+        swdata->display =
+            SDL_CreateRGBSurfaceFrom(pixels, w, h, bpp, pitch, Rmask,
+                                     Gmask, Bmask, Amask);
+        if (!swdata->display) {
+            return (-1);
         }
+    }
+    if (!swdata->stretch) {
+        /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
+        SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
+                                   &Bmask, &Amask);
+        swdata->stretch =
+            SDL_CreateRGBSurface(0, swdata->w, swdata->h, bpp, Rmask,
+                                 Gmask, Bmask, Amask);
         if (!swdata->stretch) {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->stretch =
-                SDL_CreateRGBSurface(0, swdata->w, swdata->h, bpp, Rmask,
-                                     Gmask, Bmask, Amask);
-            if (!swdata->stretch) {
-                return (-1);
-            }
+            return (-1);
         }
-        pixels = swdata->stretch->pixels;
-        pitch = swdata->stretch->pitch;
+        swdata->stretch_dirty.x = 0;
+        swdata->stretch_dirty.y = 0;
+        swdata->stretch_dirty.w = swdata->w;
+        swdata->stretch_dirty.h = swdata->h;
     }
-    if (SDL_ConvertPixels(swdata->w, swdata->h, swdata->format,
-                          swdata->planes[0], swdata->pitches[0], 
-                          target_format, pixels, pitch) < 0) {
-        return -1;
+
+    /* The scratch surface keeps the frame, so only changed rows are converted */
+    if (!SDL_RectEmpty(&swdata->stretch_dirty)) {
+        SDL_SW_GetYUVRows(swdata, &swdata->stretch_dirty, &rows);
+        if (SDL_ConvertPixels_YUV_to_RGB_Rows(swdata->w, swdata->h,
+                                              rows.y, rows.h, swdata->format,
+                                              swdata->planes[0], swdata->pitches[0],
+                                              target_format,
+                                              (Uint8 *)swdata->stretch->pixels + rows.y * swdata->stretch->pitch,
+                                              swdata->stretch->pitch) < 0) {
+            return -1;
+        }
+        SDL_zero(swdata->stretch_dirty);
     }
-    if (stretch) {
+    SDL_zero(swdata->dirty);
+
+    {
         SDL_Rect rect = *srcrect;
         SDL_SoftStretch(swdata->stretch, &rect, swdata->display, NULL);
     }
@@ -39,8 +39,14 @@ struct SDL_SW_YUVTexture
     Uint16 pitches[3];
     Uint8 *planes[3];
 
-    /* This is a temporary surface in case we have to stretch copy */
+    /* The area changed since the last SDL_SW_CopyYUVToRGB() */
+    SDL_Rect dirty;
+
+    /* This is a temporary surface in case we have to stretch copy.
+       It keeps the converted frame, so only stretch_dirty is converted again.
+     */
     SDL_Surface *stretch;
+    SDL_Rect stretch_dirty;
     SDL_Surface *display;
 };
 
@@ -58,6 +64,7 @@ int SDL_SW_UpdateYUVTexturePlanar(SDL_SW_YUVTexture * swdata, const SDL_Rect * r
 int SDL_SW_LockYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
                           void **pixels, int *pitch);
 void SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture * swdata);
+SDL_bool SDL_SW_GetYUVTextureDirtyRows(SDL_SW_YUVTexture * swdata, SDL_Rect * rect);
 int SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
                         Uint32 target_format, int w, int h, void *pixels,
                         int pitch);
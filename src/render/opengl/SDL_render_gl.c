@@ -871,46 +871,41 @@ GL_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd, const SDL_FRe
 }
 
 static int
-GL_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
-             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+GL_QueueCopies(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+               const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count)
 {
     GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
-    GLfloat minx, miny, maxx, maxy;
-    GLfloat minu, maxu, minv, maxv;
-    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, 8 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 8 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    int i;
 
     if (!verts) {
         return -1;
     }
 
-    cmd->data.draw.count = 1;
-
-    minx = dstrect->x;
-    miny = dstrect->y;
-    maxx = dstrect->x + dstrect->w;
-    maxy = dstrect->y + dstrect->h;
-
-    minu = (GLfloat) srcrect->x / texture->w;
-    minu *= texturedata->texw;
-    maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-    maxu *= texturedata->texw;
-    minv = (GLfloat) srcrect->y / texture->h;
-    minv *= texturedata->texh;
-    maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
-    maxv *= texturedata->texh;
+    cmd->data.draw.count = count;
 
-    cmd->data.draw.count = 1;
-    *(verts++) = minx;
-    *(verts++) = miny;
-    *(verts++) = maxx;
-    *(verts++) = maxy;
-    *(verts++) = minu;
-    *(verts++) = maxu;
-    *(verts++) = minv;
-    *(verts++) = maxv;
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &srcrects[i];
+        const SDL_FRect *dstrect = &dstrects[i];
+        *(verts++) = dstrect->x;
+        *(verts++) = dstrect->y;
+        *(verts++) = dstrect->x + dstrect->w;
+        *(verts++) = dstrect->y + dstrect->h;
+        *(verts++) = (GLfloat) srcrect->x / texture->w * texturedata->texw;
+        *(verts++) = (GLfloat) (srcrect->x + srcrect->w) / texture->w * texturedata->texw;
+        *(verts++) = (GLfloat) srcrect->y / texture->h * texturedata->texh;
+        *(verts++) = (GLfloat) (srcrect->y + srcrect->h) / texture->h * texturedata->texh;
+    }
     return 0;
 }
 
+static int
+GL_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    return GL_QueueCopies(renderer, cmd, texture, srcrect, dstrect, 1);
+}
+
 static int
 GL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                const SDL_Rect * srcrect, const SDL_FRect * dstrect,
@@ -1278,25 +1273,29 @@ GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
             }
 
             case SDL_RENDERCMD_COPY: {
+                /* Consecutive copies with the same state are queued as one command, draw them as one batch */
                 const GLfloat *verts = (GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const GLfloat minx = verts[0];
-                const GLfloat miny = verts[1];
-                const GLfloat maxx = verts[2];
-                const GLfloat maxy = verts[3];
-                const GLfloat minu = verts[4];
-                const GLfloat maxu = verts[5];
-                const GLfloat minv = verts[6];
-                const GLfloat maxv = verts[7];
+                const size_t count = cmd->data.draw.count;
                 SetCopyState(data, cmd);
-                data->glBegin(GL_TRIANGLE_STRIP);
-                data->glTexCoord2f(minu, minv);
-                data->glVertex2f(minx, miny);
-                data->glTexCoord2f(maxu, minv);
-                data->glVertex2f(maxx, miny);
-                data->glTexCoord2f(minu, maxv);
-                data->glVertex2f(minx, maxy);
-                data->glTexCoord2f(maxu, maxv);
-                data->glVertex2f(maxx, maxy);
+                data->glBegin(GL_QUADS);
+                for (i = 0; i < count; i++, verts += 8) {
+                    const GLfloat minx = verts[0];
+                    const GLfloat miny = verts[1];
+                    const GLfloat maxx = verts[2];
+                    const GLfloat maxy = verts[3];
+                    const GLfloat minu = verts[4];
+                    const GLfloat maxu = verts[5];
+                    const GLfloat minv = verts[6];
+                    const GLfloat maxv = verts[7];
+                    data->glTexCoord2f(minu, minv);
+                    data->glVertex2f(minx, miny);
+                    data->glTexCoord2f(maxu, minv);
+                    data->glVertex2f(maxx, miny);
+                    data->glTexCoord2f(maxu, maxv);
+                    data->glVertex2f(maxx, maxy);
+                    data->glTexCoord2f(minu, maxv);
+                    data->glVertex2f(minx, maxy);
+                }
                 data->glEnd();
                 break;
             }
@@ -1605,6 +1604,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueDrawLines = GL_QueueDrawPoints;  /* lines and points queue vertices the same way. */
     renderer->QueueFillRects = GL_QueueFillRects;
     renderer->QueueCopy = GL_QueueCopy;
+    renderer->QueueCopies = GL_QueueCopies;
     renderer->QueueCopyEx = GL_QueueCopyEx;
     renderer->RunCommandQueue = GL_RunCommandQueue;
     renderer->RenderReadPixels = GL_RenderReadPixels;
@@ -1613,6 +1613,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->DestroyRenderer = GL_DestroyRenderer;
     renderer->GL_BindTexture = GL_BindTexture;
     renderer->GL_UnbindTexture = GL_UnbindTexture;
+    renderer->coalesce_copies = SDL_TRUE;
     renderer->info = GL_RenderDriver.info;
     renderer->info.flags = SDL_RENDERER_ACCELERATED;
     renderer->driverdata = data;
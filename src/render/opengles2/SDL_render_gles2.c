@@ -815,50 +815,77 @@ GLES2_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd, const SDL_
 }
 
 static int
-GLES2_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
-                          const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+GLES2_QueueCopies(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                  const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count)
 {
     GLfloat minx, miny, maxx, maxy;
     GLfloat minu, maxu, minv, maxv;
-    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, 16 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 24 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    int i;
 
     if (!verts) {
         return -1;
     }
 
-    cmd->data.draw.count = 1;
+    cmd->data.draw.count = count;
 
-    minx = dstrect->x;
-    miny = dstrect->y;
-    maxx = dstrect->x + dstrect->w;
-    maxy = dstrect->y + dstrect->h;
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &srcrects[i];
+        const SDL_FRect *dstrect = &dstrects[i];
 
-    minu = (GLfloat) srcrect->x / texture->w;
-    maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-    minv = (GLfloat) srcrect->y / texture->h;
-    maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
 
-    *(verts++) = minx;
-    *(verts++) = miny;
-    *(verts++) = maxx;
-    *(verts++) = miny;
-    *(verts++) = minx;
-    *(verts++) = maxy;
-    *(verts++) = maxx;
-    *(verts++) = maxy;
+        minu = (GLfloat) srcrect->x / texture->w;
+        maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+        minv = (GLfloat) srcrect->y / texture->h;
+        maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
 
-    *(verts++) = minu;
-    *(verts++) = minv;
-    *(verts++) = maxu;
-    *(verts++) = minv;
-    *(verts++) = minu;
-    *(verts++) = maxv;
-    *(verts++) = maxu;
-    *(verts++) = maxv;
+        /* Two triangles of interleaved position and texture coordinates, so that
+           consecutive copies merged into one command can be drawn with one call. */
+        *(verts++) = minx;
+        *(verts++) = miny;
+        *(verts++) = minu;
+        *(verts++) = minv;
+
+        *(verts++) = maxx;
+        *(verts++) = miny;
+        *(verts++) = maxu;
+        *(verts++) = minv;
+
+        *(verts++) = minx;
+        *(verts++) = maxy;
+        *(verts++) = minu;
+        *(verts++) = maxv;
+
+        *(verts++) = minx;
+        *(verts++) = maxy;
+        *(verts++) = minu;
+        *(verts++) = maxv;
+
+        *(verts++) = maxx;
+        *(verts++) = miny;
+        *(verts++) = maxu;
+        *(verts++) = minv;
+
+        *(verts++) = maxx;
+        *(verts++) = maxy;
+        *(verts++) = maxu;
+        *(verts++) = maxv;
+    }
 
     return 0;
 }
 
+static int
+GLES2_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                          const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    return GLES2_QueueCopies(renderer, cmd, texture, srcrect, dstrect, 1);
+}
+
 static int
 GLES2_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                         const SDL_Rect * srcquad, const SDL_FRect * dstrect,
@@ -946,6 +973,7 @@ SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_I
 {
     const SDL_bool was_copy_ex = data->drawstate.is_copy_ex;
     const SDL_bool is_copy_ex = (cmd->command == SDL_RENDERCMD_COPY_EX);
+    const SDL_bool is_copy = (cmd->command == SDL_RENDERCMD_COPY);
     SDL_Texture *texture = cmd->data.draw.texture;
     const SDL_BlendMode blend = cmd->data.draw.blend;
     GLES2_ProgramCacheEntry *program;
@@ -1016,7 +1044,9 @@ SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_I
         data->drawstate.texture = texture;
     }
 
-    if (texture) {
+    if (is_copy) {
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof (GLfloat) * 4, (const GLvoid *) (cmd->data.draw.first + (sizeof (GLfloat) * 2)));
+    } else if (texture) {
         data->glVertexAttribPointer(GLES2_ATTRIBUTE_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 0, (const GLvoid *) (cmd->data.draw.first + (sizeof (GLfloat) * 8)));
     }
 
@@ -1059,8 +1089,8 @@ SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_I
         data->drawstate.blend = blend;
     }
 
-    /* all drawing commands use this */
-    data->glVertexAttribPointer(GLES2_ATTRIBUTE_POSITION, 2, GL_FLOAT, GL_FALSE, 0, (const GLvoid *) cmd->data.draw.first);
+    /* all drawing commands use this, copies interleave it with the texture coordinates */
+    data->glVertexAttribPointer(GLES2_ATTRIBUTE_POSITION, 2, GL_FLOAT, GL_FALSE, is_copy ? sizeof (GLfloat) * 4 : 0, (const GLvoid *) cmd->data.draw.first);
 
     if (is_copy_ex != was_copy_ex) {
         if (is_copy_ex) {
@@ -1320,7 +1350,14 @@ GLES2_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
-            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY: {
+                /* Consecutive copies with the same state are queued as one command */
+                if (SetCopyState(renderer, cmd) == 0) {
+                    data->glDrawArrays(GL_TRIANGLES, 0, (GLsizei) (cmd->data.draw.count * 6));
+                }
+                break;
+            }
+
             case SDL_RENDERCMD_COPY_EX: {
                 if (SetCopyState(renderer, cmd) == 0) {
                     data->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
@@ -2102,6 +2139,7 @@ GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
     renderer->QueueDrawLines      = GLES2_QueueDrawPoints;  /* lines and points queue vertices the same way. */
     renderer->QueueFillRects      = GLES2_QueueFillRects;
     renderer->QueueCopy           = GLES2_QueueCopy;
+    renderer->QueueCopies         = GLES2_QueueCopies;
     renderer->QueueCopyEx         = GLES2_QueueCopyEx;
     renderer->RunCommandQueue     = GLES2_RunCommandQueue;
     renderer->RenderReadPixels    = GLES2_RenderReadPixels;
@@ -2110,6 +2148,7 @@ GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
     renderer->DestroyRenderer     = GLES2_DestroyRenderer;
     renderer->GL_BindTexture      = GLES2_BindTexture;
     renderer->GL_UnbindTexture    = GLES2_UnbindTexture;
+    renderer->coalesce_copies     = SDL_TRUE;
 
     renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_YV12;
     renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_IYUV;
@@ -35,17 +35,11 @@ SDL_BlendLine_RGB2(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     const SDL_PixelFormat *fmt = dst->format;
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -140,17 +134,11 @@ SDL_BlendLine_RGB555(SDL_Surface * dst, int x1, int y1, int x2, int y2,
 {
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -245,17 +233,11 @@ SDL_BlendLine_RGB565(SDL_Surface * dst, int x1, int y1, int x2, int y2,
 {
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -351,17 +333,11 @@ SDL_BlendLine_RGB4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     const SDL_PixelFormat *fmt = dst->format;
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -457,17 +433,11 @@ SDL_BlendLine_RGBA4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     const SDL_PixelFormat *fmt = dst->format;
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -562,17 +532,11 @@ SDL_BlendLine_RGB888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
 {
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
@@ -667,17 +631,11 @@ SDL_BlendLine_ARGB8888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
 {
     unsigned r, g, b, a, inva;
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(_r, _a);
-        g = DRAW_MUL(_g, _a);
-        b = DRAW_MUL(_b, _a);
-        a = _a;
-    } else {
-        r = _r;
-        g = _g;
-        b = _b;
-        a = _a;
-    }
+    SDL_PrepareDrawBlend(&blendMode, &_r, &_g, &_b, _a);
+    r = _r;
+    g = _g;
+    b = _b;
+    a = _a;
     inva = (a ^ 0xff);
 
     if (y1 == y2) {
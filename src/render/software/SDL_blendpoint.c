@@ -233,11 +233,7 @@ SDL_BlendPoint(SDL_Surface * dst, int x, int y, SDL_BlendMode blendMode, Uint8 r
         return 0;
     }
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(r, a);
-        g = DRAW_MUL(g, a);
-        b = DRAW_MUL(b, a);
-    }
+    SDL_PrepareDrawBlend(&blendMode, &r, &g, &b, a);
 
     switch (dst->format->BitsPerPixel) {
     case 15:
@@ -295,11 +291,7 @@ SDL_BlendPoints(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_BlendPoints(): Unsupported surface format");
     }
 
-    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
-        r = DRAW_MUL(r, a);
-        g = DRAW_MUL(g, a);
-        b = DRAW_MUL(b, a);
-    }
+    SDL_PrepareDrawBlend(&blendMode, &r, &g, &b, a);
 
     /* FIXME: Does this function pointer slow things down significantly? */
     switch (dst->format->BitsPerPixel) {
@@ -28,6 +28,23 @@
 
 #define DRAW_MUL(_a, _b) (((unsigned)(_a)*(_b))/255)
 
+/* Premultiplies the color by its alpha for the blend and add modes.
+ * A color drawn with SDL_BLENDMODE_BLEND_PREMULTIPLIED is premultiplied
+ * already and is drawn as SDL_BLENDMODE_BLEND, which saturates like the
+ * premultiplied blitters when the color is brighter than its alpha.
+ */
+SDL_FORCE_INLINE void
+SDL_PrepareDrawBlend(SDL_BlendMode *blendMode, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 a)
+{
+    if (*blendMode == SDL_BLENDMODE_BLEND || *blendMode == SDL_BLENDMODE_ADD) {
+        *r = DRAW_MUL(*r, a);
+        *g = DRAW_MUL(*g, a);
+        *b = DRAW_MUL(*b, a);
+    } else if (*blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        *blendMode = SDL_BLENDMODE_BLEND;
+    }
+}
+
 #define DRAW_FASTSETPIXEL(type) \
     *pixel = (type) color
 
@@ -53,9 +70,9 @@ do { \
 do { \
     unsigned sr, sg, sb, sa = 0xFF; \
     getpixel; \
-    sr = DRAW_MUL(inva, sr) + r; \
-    sg = DRAW_MUL(inva, sg) + g; \
-    sb = DRAW_MUL(inva, sb) + b; \
+    sr = DRAW_MUL(inva, sr) + r; if (sr > 0xff) sr = 0xff; \
+    sg = DRAW_MUL(inva, sg) + g; if (sg > 0xff) sg = 0xff; \
+    sb = DRAW_MUL(inva, sb) + b; if (sb > 0xff) sb = 0xff; \
     sa = DRAW_MUL(inva, sa) + a; \
     setpixel; \
 } while (0)
@@ -26,6 +26,11 @@
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
 #include "SDL_assert.h"
+#include "SDL_cpuinfo.h"
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
+#include "../../video/SDL_RLEaccel_c.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -37,33 +42,138 @@
 
 /* SDL surface based renderer implementation */
 
+/* The most threads SDL_HINT_RENDER_SOFTWARE_THREADS can ask for */
+#define SW_MAX_THREADS      64
+
+/* Tiles are never made shorter than this many rows */
+#define SW_MIN_TILE_HEIGHT  16
+
+/* Separate areas of the window presented before falling back to their bounding box */
+#define SW_MAX_DIRTY_RECTS  16
+
 typedef struct
 {
     const SDL_Rect *viewport;
     const SDL_Rect *cliprect;
+    const SDL_Rect *tile;
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* A worker-private surface sharing the pixels of a texture surface, so the
+ * worker can change the blit map, clip rect and modulation without racing
+ * the other workers.
+ */
+typedef struct
+{
+    SDL_Surface *src;
+    SDL_Surface *view;
+} SW_TileSourceView;
+
+/* Number of hash buckets of the transformed surface cache */
+#define SW_TRANSFORM_BUCKETS    256
+
+/* Default memory budget of the transformed surface cache, in kilobytes */
+#define SW_TRANSFORM_CACHE_SIZE 4096
+
+/* Everything the result of SDLgfx_rotateSurface depends on.  The position of
+ * the copy only matters when blitting the result, so it isn't part of the key.
+ */
 typedef struct
+{
+    SDL_Surface *src;
+    SDL_Rect srcrect;
+    int w, h;
+    double angle;
+    SDL_RendererFlip flip;
+    SDL_ScaleMode scaleMode;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;   /* 0xFF unless the modulation is applied before rotating */
+} SW_TransformKey;
+
+typedef struct SW_TransformedSurface
+{
+    SW_TransformKey key;
+    Uint32 hash;
+    SDL_Surface *rotated;
+    SDL_Surface *mask;      /* only for non-opaque copies with the NONE blend mode */
+    int dstwidth, dstheight;
+    double cangle, sangle;
+    SDL_bool modulated;     /* the color and alpha modulation is already applied */
+    SDL_bool opaque;
+    size_t size;
+    int pinned;             /* in use, can't be evicted */
+    struct SW_TransformedSurface *prev, *next;  /* LRU order, most recent first */
+    struct SW_TransformedSurface *hash_next;
+} SW_TransformedSurface;
+
+typedef struct
+{
+    SW_TransformedSurface *buckets[SW_TRANSFORM_BUCKETS];
+    SW_TransformedSurface *head;
+    SW_TransformedSurface *tail;
+    size_t size;
+    size_t budget;
+    Uint64 hits;
+    Uint64 misses;
+} SW_TransformCache;
+
+typedef struct SW_TileWorker
+{
+    struct SW_RenderData *renderdata;
+    SDL_Thread *thread;
+    SDL_Surface *target;        /* private view of the current render target */
+    SW_TileSourceView *views;   /* open addressing hash table, keyed by source surface */
+    int num_views;
+    int max_views;
+} SW_TileWorker;
+
+typedef struct SW_RenderData
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Drawn into instead of the window at the logical size, see SDL_HINT_RENDER_SOFTWARE_LOGICAL_PRESENT */
+    SDL_Surface *logical;
+    SDL_Rect logical_viewport;
+    SDL_ScaleMode logical_scale_mode;
+
+    /* Tiled command queue execution, see SDL_HINT_RENDER_SOFTWARE_THREADS */
+    int num_workers;
+    SW_TileWorker *workers;
+    SDL_sem *work_sem;
+    SDL_sem *done_sem;
+    SDL_atomic_t next_tile;
+    int num_tiles;
+    SDL_bool shutdown;
+    SDL_Renderer *renderer;
+    SDL_RenderCommand *commands;
+    void *vertices;
+    SW_TransformedSurface **transforms;  /* result of every SDL_RENDERCMD_COPY_EX, in order */
+    int num_transforms;
+    int max_transforms;
+
+    SW_TransformCache transform_cache;
+
+    /* Areas of the window surface drawn since the last present */
+    SDL_Rect dirty_rects[SW_MAX_DIRTY_RECTS];   /* in logical coordinates when drawing at the logical size */
+    int num_dirty_rects;
+    SDL_bool dirty_full;
 } SW_RenderData;
 
+static void SW_InvalidateTransformCache(SW_RenderData *data, SDL_Surface *src);
+
 
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
-    if (!data->surface) {
-        data->surface = data->window;
+    if (!data->window && renderer->window) {
+        data->window = SDL_GetWindowSurface(renderer->window);
+        data->dirty_full = SDL_TRUE;
     }
     if (!data->surface) {
-        SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
-        if (surface) {
-            data->surface = data->window = surface;
-        }
+        data->surface = data->logical ? data->logical : data->window;
     }
     return data->surface;
 }
@@ -76,6 +186,9 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        /* The window system may have lost what we presented before */
+        data->dirty_full = SDL_TRUE;
     }
 }
 
@@ -84,12 +197,12 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
-    if (data->surface) {
+    if (data->window) {
         if (w) {
-            *w = data->surface->w;
+            *w = data->window->w;
         }
         if (h) {
-            *h = data->surface->h;
+            *h = data->window->h;
         }
         return 0;
     }
@@ -103,6 +216,13 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
     return -1;
 }
 
+static SDL_bool
+SW_SupportsBlendMode(SDL_Renderer * renderer, SDL_BlendMode blendMode)
+{
+    /* The software blitters and drawing only know the predefined modes */
+    return (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) ? SDL_TRUE : SDL_FALSE;
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
@@ -144,6 +264,8 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     int row;
     size_t length;
 
+    SW_InvalidateTransformCache((SW_RenderData *) renderer->driverdata, surface);
+
     if(SDL_MUSTLOCK(surface))
         SDL_LockSurface(surface);
     src = (Uint8 *) pixels;
@@ -177,11 +299,13 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
 static void
 SW_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_InvalidateTransformCache((SW_RenderData *) renderer->driverdata, (SDL_Surface *) texture->driverdata);
 }
 
 static void
 SW_SetTextureScaleMode(SDL_Renderer * renderer, SDL_Texture * texture, SDL_ScaleMode scaleMode)
 {
+    /* Nothing to do, texture->scaleMode is checked when copying */
 }
 
 static int
@@ -192,8 +316,45 @@ SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
     if (texture) {
         data->surface = (SDL_Surface *) texture->driverdata;
     } else {
-        data->surface = data->window;
+        data->surface = data->logical ? data->logical : data->window;
+    }
+    return 0;
+}
+
+static int
+SW_SetLogicalPresentation(SDL_Renderer * renderer, int logical_w, int logical_h,
+                          const SDL_Rect * viewport, SDL_ScaleMode scaleMode)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *logical = data->logical;
+
+    if (!logical_w || !logical_h) {
+        logical = NULL;
+    } else if (!logical || logical->w != logical_w || logical->h != logical_h) {
+        SW_ActivateRenderer(renderer);
+        if (!data->window) {
+            return -1;
+        }
+        logical = SDL_CreateRGBSurfaceWithFormat(0, logical_w, logical_h, 0, data->window->format->format);
+        if (!logical) {
+            return -1;
+        }
+        SDL_SetSurfaceBlendMode(logical, SDL_BLENDMODE_NONE);
     }
+
+    if (logical != data->logical) {
+        if (!renderer->target) {
+            data->surface = logical ? logical : data->window;
+        }
+        SDL_FreeSurface(data->logical);
+        data->logical = logical;
+        data->num_dirty_rects = 0;
+    }
+    if (logical) {
+        data->logical_viewport = *viewport;
+        data->logical_scale_mode = scaleMode;
+    }
+    data->dirty_full = SDL_TRUE;
     return 0;
 }
 
@@ -267,33 +428,39 @@ SW_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd, const SDL_FRe
 }
 
 static int
-SW_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
-             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+SW_QueueCopies(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+               const SDL_Rect * srcrects, const SDL_FRect * dstrects, int count)
 {
-    SDL_Rect *verts = (SDL_Rect *) SDL_AllocateRenderVertices(renderer, 2 * sizeof (SDL_Rect), 0, &cmd->data.draw.first);
+    SDL_Rect *verts = (SDL_Rect *) SDL_AllocateRenderVertices(renderer, count * 2 * sizeof (SDL_Rect), 0, &cmd->data.draw.first);
+    const int x = renderer->viewport.x;
+    const int y = renderer->viewport.y;
+    int i;
 
     if (!verts) {
         return -1;
     }
 
-    cmd->data.draw.count = 1;
-
-    SDL_memcpy(verts, srcrect, sizeof (SDL_Rect));
-    verts++;
+    cmd->data.draw.count = count;
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        verts->x = (int)(renderer->viewport.x + dstrect->x);
-        verts->y = (int)(renderer->viewport.y + dstrect->y);
-    } else {
-        verts->x = (int)dstrect->x;
-        verts->y = (int)dstrect->y;
+    /* Source and destination rects alternate */
+    for (i = 0; i < count; i++, verts += 2) {
+        verts[0] = srcrects[i];
+        verts[1].x = (int)(x + dstrects[i].x);
+        verts[1].y = (int)(y + dstrects[i].y);
+        verts[1].w = (int)dstrects[i].w;
+        verts[1].h = (int)dstrects[i].h;
     }
-    verts->w = (int)dstrect->w;
-    verts->h = (int)dstrect->h;
 
     return 0;
 }
 
+static int
+SW_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    return SW_QueueCopies(renderer, cmd, texture, srcrect, dstrect, 1);
+}
+
 typedef struct CopyExData
 {
     SDL_Rect srcrect;
@@ -334,31 +501,92 @@ SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
     return 0;
 }
 
-static int
-SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * texture,
-                const SDL_Rect * srcrect, const SDL_Rect * final_rect,
-                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+static Uint32
+SW_HashTransformKey(const SW_TransformKey *key)
 {
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+    Uint32 hash = (Uint32)(((uintptr_t)key->src) >> 4);
+    Uint32 angle[2];
+
+    SDL_memcpy(angle, &key->angle, sizeof (angle));
+    hash = hash * 31 + (Uint32)key->srcrect.x;
+    hash = hash * 31 + (Uint32)key->srcrect.y;
+    hash = hash * 31 + (Uint32)key->srcrect.w;
+    hash = hash * 31 + (Uint32)key->srcrect.h;
+    hash = hash * 31 + (Uint32)key->w;
+    hash = hash * 31 + (Uint32)key->h;
+    hash = hash * 31 + angle[0];
+    hash = hash * 31 + angle[1];
+    hash = hash * 31 + (Uint32)key->flip;
+    hash = hash * 31 + (Uint32)key->scaleMode;
+    hash = hash * 31 + (Uint32)key->blendMode;
+    hash = hash * 31 + (((Uint32)key->r << 24) | ((Uint32)key->g << 16) | ((Uint32)key->b << 8) | key->a);
+    return hash * 2654435761u;
+}
+
+static SDL_bool
+SW_TransformKeysEqual(const SW_TransformKey *a, const SW_TransformKey *b)
+{
+    return (a->src == b->src &&
+            a->srcrect.x == b->srcrect.x && a->srcrect.y == b->srcrect.y &&
+            a->srcrect.w == b->srcrect.w && a->srcrect.h == b->srcrect.h &&
+            a->w == b->w && a->h == b->h &&
+            a->angle == b->angle && a->flip == b->flip &&
+            a->scaleMode == b->scaleMode && a->blendMode == b->blendMode &&
+            a->r == b->r && a->g == b->g && a->b == b->b && a->a == b->a) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+SW_MakeTransformKey(SW_TransformKey *key, SDL_Surface *src, SDL_Texture *texture,
+                    const SDL_RenderCommand *cmd, const CopyExData *copydata)
+{
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+
+    SDL_zerop(key);
+    key->src = src;
+    key->srcrect = copydata->srcrect;
+    key->w = copydata->dstrect.w;
+    key->h = copydata->dstrect.h;
+    key->angle = copydata->angle;
+    key->flip = copydata->flip;
+    key->scaleMode = texture->scaleMode;
+    key->blendMode = blend;
+    if (blend == SDL_BLENDMODE_NONE || blend == SDL_BLENDMODE_MOD || blend == SDL_BLENDMODE_MUL) {
+        key->r = cmd->data.draw.r;
+        key->g = cmd->data.draw.g;
+        key->b = cmd->data.draw.b;
+        key->a = cmd->data.draw.a;
+    } else {
+        key->r = key->g = key->b = key->a = 0xFF;
+    }
+}
+
+/* Scale, modulate and rotate a texture surface, ready to be blitted at any position. */
+static SW_TransformedSurface *
+SW_CreateTransformedSurface(SDL_Surface *src, const SW_TransformKey *key)
+{
+    SW_TransformedSurface *xform;
     SDL_Rect tmp_rect;
-    SDL_Surface *src_clone, *src_rotated, *src_scaled;
-    SDL_Surface *mask = NULL, *mask_rotated = NULL;
-    int retval = 0, dstwidth, dstheight, abscenterx, abscentery;
-    double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
-    SDL_BlendMode blendmode;
-    Uint8 alphaMod, rMod, gMod, bMod;
-    int applyModulation = SDL_FALSE;
+    SDL_Surface *src_clone, *src_scaled;
+    SDL_Surface *mask = NULL;
+    const SDL_Rect *srcrect = &key->srcrect;
+    const SDL_BlendMode blendmode = key->blendMode;
+    int retval = 0;
     int blitRequired = SDL_FALSE;
+    int applyModulation = SDL_FALSE;
     int isOpaque = SDL_FALSE;
 
-    if (!surface) {
-        return -1;
+    xform = (SW_TransformedSurface *) SDL_calloc(1, sizeof (*xform));
+    if (!xform) {
+        SDL_OutOfMemory();
+        return NULL;
     }
+    xform->key = *key;
+    xform->hash = SW_HashTransformKey(key);
 
     tmp_rect.x = 0;
     tmp_rect.y = 0;
-    tmp_rect.w = final_rect->w;
-    tmp_rect.h = final_rect->h;
+    tmp_rect.w = key->w;
+    tmp_rect.h = key->h;
 
     /* It is possible to encounter an RLE encoded surface here and locking it is
      * necessary because this code is going to access the pixel buffer directly.
@@ -377,20 +605,17 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
         if (SDL_MUSTLOCK(src)) {
             SDL_UnlockSurface(src);
         }
-        return -1;
+        SDL_free(xform);
+        return NULL;
     }
 
-    SDL_GetSurfaceBlendMode(src, &blendmode);
-    SDL_GetSurfaceAlphaMod(src, &alphaMod);
-    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
     /* SDLgfx_rotateSurface only accepts 32-bit surfaces with a 8888 layout. Everything else has to be converted. */
     if (src->format->BitsPerPixel != 32 || SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888 || !src->format->Amask) {
         blitRequired = SDL_TRUE;
     }
 
     /* If scaling and cropping is necessary, it has to be taken care of before the rotation. */
-    if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
+    if (!(srcrect->w == key->w && srcrect->h == key->h && srcrect->x == 0 && srcrect->y == 0)) {
         blitRequired = SDL_TRUE;
     }
 
@@ -400,14 +625,14 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     }
 
     /* The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes. */
-    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (alphaMod & rMod & gMod & bMod) != 255) {
+    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (key->a & key->r & key->g & key->b) != 255) {
         applyModulation = SDL_TRUE;
-        SDL_SetSurfaceAlphaMod(src_clone, alphaMod);
-        SDL_SetSurfaceColorMod(src_clone, rMod, gMod, bMod);
+        SDL_SetSurfaceAlphaMod(src_clone, key->a);
+        SDL_SetSurfaceColorMod(src_clone, key->r, key->g, key->b);
     }
 
     /* Opaque surfaces are much easier to handle with the NONE blend mode. */
-    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
+    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && key->a == 255) {
         isOpaque = SDL_TRUE;
     }
 
@@ -415,7 +640,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
     if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+        mask = SDL_CreateRGBSurface(0, key->w, key->h, 32,
                                     0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (mask == NULL) {
             retval = -1;
@@ -429,13 +654,13 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
      */
     if (!retval && (blitRequired || applyModulation)) {
         SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+        src_scaled = SDL_CreateRGBSurface(0, key->w, key->h, 32,
                                           0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (src_scaled == NULL) {
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
-            retval = SDL_BlitScaled(src_clone, srcrect, src_scaled, &scale_rect);
+            retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect, key->scaleMode != SDL_ScaleModeNearest);
             SDL_FreeSurface(src_clone);
             src_clone = src_scaled;
             src_scaled = NULL;
@@ -446,107 +671,18 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     SDL_SetSurfaceBlendMode(src_clone, blendmode);
 
     if (!retval) {
-        SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, &dstwidth, &dstheight, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle, dstwidth/2, dstheight/2, (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
-        if (src_rotated == NULL) {
+        SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, key->angle, &xform->dstwidth, &xform->dstheight, &xform->cangle, &xform->sangle);
+        xform->rotated = SDLgfx_rotateSurface(src_clone, key->angle, xform->dstwidth/2, xform->dstheight/2, (key->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, key->flip & SDL_FLIP_HORIZONTAL, key->flip & SDL_FLIP_VERTICAL, xform->dstwidth, xform->dstheight, xform->cangle, xform->sangle);
+        if (xform->rotated == NULL) {
             retval = -1;
         }
         if (!retval && mask != NULL) {
             /* The mask needed for the NONE blend mode gets rotated with the same parameters. */
-            mask_rotated = SDLgfx_rotateSurface(mask, angle, dstwidth/2, dstheight/2, SDL_FALSE, 0, 0, dstwidth, dstheight, cangle, sangle);
-            if (mask_rotated == NULL) {
+            xform->mask = SDLgfx_rotateSurface(mask, key->angle, xform->dstwidth/2, xform->dstheight/2, SDL_FALSE, 0, 0, xform->dstwidth, xform->dstheight, xform->cangle, xform->sangle);
+            if (xform->mask == NULL) {
                 retval = -1;
             }
         }
-        if (!retval) {
-            /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
-            abscenterx = final_rect->x + (int)center->x;
-            abscentery = final_rect->y + (int)center->y;
-            /* Compensate the angle inversion to match the behaviour of the other backends */
-            sangle = -sangle;
-
-            /* Top Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y - abscentery;
-            p1x = px * cangle - py * sangle + abscenterx;
-            p1y = px * sangle + py * cangle + abscentery;
-
-            /* Top Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y - abscentery;
-            p2x = px * cangle - py * sangle + abscenterx;
-            p2y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p3x = px * cangle - py * sangle + abscenterx;
-            p3y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p4x = px * cangle - py * sangle + abscenterx;
-            p4y = px * sangle + py * cangle + abscentery;
-
-            tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
-            tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
-            tmp_rect.w = dstwidth;
-            tmp_rect.h = dstheight;
-
-            /* The NONE blend mode needs some special care with non-opaque surfaces.
-             * Other blend modes or opaque surfaces can be blitted directly.
-             */
-            if (blendmode != SDL_BLENDMODE_NONE || isOpaque) {
-                if (applyModulation == SDL_FALSE) {
-                    /* If the modulation wasn't already applied, make it happen now. */
-                    SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
-                    SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
-                }
-                retval = SDL_BlitSurface(src_rotated, NULL, surface, &tmp_rect);
-            } else {
-                /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
-                 * First, the area where the rotated pixels will be blitted to get set to zero.
-                 * This is accomplished by simply blitting a mask with the NONE blend mode.
-                 * The colorkey set by the rotate function will discard the correct pixels.
-                 */
-                SDL_Rect mask_rect = tmp_rect;
-                SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
-                retval = SDL_BlitSurface(mask_rotated, NULL, surface, &mask_rect);
-                if (!retval) {
-                    /* The next step copies the alpha value. This is done with the BLEND blend mode and
-                     * by modulating the source colors with 0. Since the destination is all zeros, this
-                     * will effectively set the destination alpha to the source alpha.
-                     */
-                    SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
-                    mask_rect = tmp_rect;
-                    retval = SDL_BlitSurface(src_rotated, NULL, surface, &mask_rect);
-                    if (!retval) {
-                        /* The last step gets the color values in place. The ADD blend mode simply adds them to
-                         * the destination (where the color values are all zero). However, because the ADD blend
-                         * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
-                         * to be created. This makes all source pixels opaque and the colors get copied correctly.
-                         */
-                        SDL_Surface *src_rotated_rgb;
-                        src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
-                                                                   src_rotated->format->BitsPerPixel, src_rotated->pitch,
-                                                                   src_rotated->format->Rmask, src_rotated->format->Gmask,
-                                                                   src_rotated->format->Bmask, 0);
-                        if (src_rotated_rgb == NULL) {
-                            retval = -1;
-                        } else {
-                            SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
-                            retval = SDL_BlitSurface(src_rotated_rgb, NULL, surface, &tmp_rect);
-                            SDL_FreeSurface(src_rotated_rgb);
-                        }
-                    }
-                }
-                SDL_FreeSurface(mask_rotated);
-            }
-            if (src_rotated != NULL) {
-                SDL_FreeSurface(src_rotated);
-            }
-        }
     }
 
     if (SDL_MUSTLOCK(src)) {
@@ -558,19 +694,322 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     if (src_clone != NULL) {
         SDL_FreeSurface(src_clone);
     }
+
+    if (retval < 0) {
+        SDL_FreeSurface(xform->rotated);
+        SDL_FreeSurface(xform->mask);
+        SDL_free(xform);
+        return NULL;
+    }
+
+    xform->modulated = applyModulation;
+    xform->opaque = isOpaque;
+    xform->size = sizeof (*xform) + (size_t)xform->rotated->pitch * xform->rotated->h;
+    if (xform->mask) {
+        xform->size += (size_t)xform->mask->pitch * xform->mask->h;
+    }
+    return xform;
+}
+
+/* Blit a transformed surface, rotated around center. The rotated and mask
+ * surfaces are the ones of xform or views of them sharing their pixels.
+ */
+static int
+SW_BlitTransformedSurface(SDL_Surface *surface, const SW_TransformedSurface *xform,
+                          SDL_Surface *src_rotated, SDL_Surface *mask_rotated,
+                          const SDL_Rect * final_rect, const SDL_FPoint * center,
+                          Uint8 rMod, Uint8 gMod, Uint8 bMod, Uint8 alphaMod)
+{
+    const SDL_BlendMode blendmode = xform->key.blendMode;
+    const double cangle = xform->cangle;
+    /* Compensate the angle inversion to match the behaviour of the other backends */
+    const double sangle = -xform->sangle;
+    SDL_Rect tmp_rect;
+    int retval, abscenterx, abscentery;
+    double px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
+
+    /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
+    abscenterx = final_rect->x + (int)center->x;
+    abscentery = final_rect->y + (int)center->y;
+
+    /* Top Left */
+    px = final_rect->x - abscenterx;
+    py = final_rect->y - abscentery;
+    p1x = px * cangle - py * sangle + abscenterx;
+    p1y = px * sangle + py * cangle + abscentery;
+
+    /* Top Right */
+    px = final_rect->x + final_rect->w - abscenterx;
+    py = final_rect->y - abscentery;
+    p2x = px * cangle - py * sangle + abscenterx;
+    p2y = px * sangle + py * cangle + abscentery;
+
+    /* Bottom Left */
+    px = final_rect->x - abscenterx;
+    py = final_rect->y + final_rect->h - abscentery;
+    p3x = px * cangle - py * sangle + abscenterx;
+    p3y = px * sangle + py * cangle + abscentery;
+
+    /* Bottom Right */
+    px = final_rect->x + final_rect->w - abscenterx;
+    py = final_rect->y + final_rect->h - abscentery;
+    p4x = px * cangle - py * sangle + abscenterx;
+    p4y = px * sangle + py * cangle + abscentery;
+
+    tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
+    tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
+    tmp_rect.w = xform->dstwidth;
+    tmp_rect.h = xform->dstheight;
+
+    /* The NONE blend mode needs some special care with non-opaque surfaces.
+     * Other blend modes or opaque surfaces can be blitted directly.
+     */
+    if (blendmode != SDL_BLENDMODE_NONE || xform->opaque) {
+        if (xform->modulated == SDL_FALSE) {
+            /* If the modulation wasn't already applied, make it happen now. */
+            SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
+            SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
+        }
+        retval = SDL_BlitSurface(src_rotated, NULL, surface, &tmp_rect);
+    } else {
+        /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
+         * First, the area where the rotated pixels will be blitted to get set to zero.
+         * This is accomplished by simply blitting a mask with the NONE blend mode.
+         * The colorkey set by the rotate function will discard the correct pixels.
+         */
+        SDL_Rect mask_rect = tmp_rect;
+        SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
+        retval = SDL_BlitSurface(mask_rotated, NULL, surface, &mask_rect);
+        if (!retval) {
+            /* The next step copies the alpha value. This is done with the BLEND blend mode and
+             * by modulating the source colors with 0. Since the destination is all zeros, this
+             * will effectively set the destination alpha to the source alpha.
+             */
+            SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
+            mask_rect = tmp_rect;
+            retval = SDL_BlitSurface(src_rotated, NULL, surface, &mask_rect);
+            if (!retval) {
+                /* The last step gets the color values in place. The ADD blend mode simply adds them to
+                 * the destination (where the color values are all zero). However, because the ADD blend
+                 * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
+                 * to be created. This makes all source pixels opaque and the colors get copied correctly.
+                 */
+                SDL_Surface *src_rotated_rgb;
+                src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
+                                                           src_rotated->format->BitsPerPixel, src_rotated->pitch,
+                                                           src_rotated->format->Rmask, src_rotated->format->Gmask,
+                                                           src_rotated->format->Bmask, 0);
+                if (src_rotated_rgb == NULL) {
+                    retval = -1;
+                } else {
+                    SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
+                    retval = SDL_BlitSurface(src_rotated_rgb, NULL, surface, &tmp_rect);
+                    SDL_FreeSurface(src_rotated_rgb);
+                }
+            }
+        }
+    }
     return retval;
 }
 
+static void SW_RemoveTileSourceView(SW_TileWorker *worker, SDL_Surface *src);
+
 static void
-PrepTextureForCopy(const SDL_RenderCommand *cmd)
+SW_FreeTransformedSurface(SW_RenderData *data, SW_TransformedSurface *xform)
+{
+    int i;
+
+    for (i = 0; i < data->num_workers; ++i) {
+        SW_RemoveTileSourceView(&data->workers[i], xform->rotated);
+        if (xform->mask) {
+            SW_RemoveTileSourceView(&data->workers[i], xform->mask);
+        }
+    }
+    SDL_FreeSurface(xform->rotated);
+    SDL_FreeSurface(xform->mask);
+    SDL_free(xform);
+}
+
+static void
+SW_UnlinkTransformedSurface(SW_TransformCache *cache, SW_TransformedSurface *xform)
+{
+    SW_TransformedSurface **link = &cache->buckets[xform->hash % SW_TRANSFORM_BUCKETS];
+
+    while (*link != xform) {
+        link = &(*link)->hash_next;
+    }
+    *link = xform->hash_next;
+
+    if (xform->prev) {
+        xform->prev->next = xform->next;
+    } else {
+        cache->head = xform->next;
+    }
+    if (xform->next) {
+        xform->next->prev = xform->prev;
+    } else {
+        cache->tail = xform->prev;
+    }
+    cache->size -= xform->size;
+}
+
+/* Evict the least recently used entries until the cache fits its budget */
+static void
+SW_TrimTransformCache(SW_RenderData *data)
+{
+    SW_TransformCache *cache = &data->transform_cache;
+    SW_TransformedSurface *xform = cache->tail;
+
+    while (xform && cache->size > cache->budget) {
+        SW_TransformedSurface *prev = xform->prev;
+        if (!xform->pinned) {
+            SW_UnlinkTransformedSurface(cache, xform);
+            SW_FreeTransformedSurface(data, xform);
+        }
+        xform = prev;
+    }
+}
+
+/* Drop every entry made from a surface whose pixels changed or went away */
+static void
+SW_InvalidateTransformCache(SW_RenderData *data, SDL_Surface *src)
+{
+    SW_TransformCache *cache = &data->transform_cache;
+    SW_TransformedSurface *xform = cache->head;
+
+    while (xform) {
+        SW_TransformedSurface *next = xform->next;
+        if (xform->key.src == src || !src) {
+            SDL_assert(!xform->pinned);
+            SW_UnlinkTransformedSurface(cache, xform);
+            SW_FreeTransformedSurface(data, xform);
+        }
+        xform = next;
+    }
+}
+
+/* Look up or create the transformed surface for key. It stays pinned until
+ * SW_ReleaseTransformedSurface is called.
+ */
+static SW_TransformedSurface *
+SW_GetTransformedSurface(SW_RenderData *data, SDL_Surface *src, const SW_TransformKey *key)
+{
+    SW_TransformCache *cache = &data->transform_cache;
+    const Uint32 hash = SW_HashTransformKey(key);
+    SW_TransformedSurface *xform;
+
+    for (xform = cache->buckets[hash % SW_TRANSFORM_BUCKETS]; xform; xform = xform->hash_next) {
+        if (xform->hash == hash && SW_TransformKeysEqual(&xform->key, key)) {
+            break;
+        }
+    }
+
+    if (xform) {
+        ++cache->hits;
+        /* Move to the front of the LRU list */
+        if (xform->prev) {
+            xform->prev->next = xform->next;
+            if (xform->next) {
+                xform->next->prev = xform->prev;
+            } else {
+                cache->tail = xform->prev;
+            }
+            xform->prev = NULL;
+            xform->next = cache->head;
+            cache->head->prev = xform;
+            cache->head = xform;
+        }
+    } else {
+        ++cache->misses;
+        xform = SW_CreateTransformedSurface(src, key);
+        if (!xform) {
+            return NULL;
+        }
+        xform->hash_next = cache->buckets[hash % SW_TRANSFORM_BUCKETS];
+        cache->buckets[hash % SW_TRANSFORM_BUCKETS] = xform;
+        xform->next = cache->head;
+        if (cache->head) {
+            cache->head->prev = xform;
+        } else {
+            cache->tail = xform;
+        }
+        cache->head = xform;
+        cache->size += xform->size;
+    }
+
+    ++xform->pinned;
+    return xform;
+}
+
+static void
+SW_ReleaseTransformedSurface(SW_TransformedSurface *xform)
+{
+    SDL_assert(xform->pinned > 0);
+    --xform->pinned;
+}
+
+static int
+SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, const SDL_RenderCommand *cmd,
+                const CopyExData *copydata)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Texture *texture = cmd->data.draw.texture;
+    SW_TransformKey key;
+    SW_TransformedSurface *xform;
+    int retval;
+
+    if (!surface) {
+        return -1;
+    }
+
+    SW_MakeTransformKey(&key, (SDL_Surface *) texture->driverdata, texture, cmd, copydata);
+    xform = SW_GetTransformedSurface(data, key.src, &key);
+    if (!xform) {
+        return -1;
+    }
+    retval = SW_BlitTransformedSurface(surface, xform, xform->rotated, xform->mask,
+                                       &copydata->dstrect, &copydata->center,
+                                       cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+    SW_ReleaseTransformedSurface(xform);
+    SW_TrimTransformCache(data);
+    return retval;
+}
+
+/* Conservative bounds of a rotated copy */
+static void
+SW_GetCopyExBounds(const CopyExData *copydata, SDL_Rect *bounds)
+{
+    const double cx = copydata->dstrect.x + copydata->center.x;
+    const double cy = copydata->dstrect.y + copydata->center.y;
+    const double dx = SDL_max(SDL_fabs(copydata->center.x), SDL_fabs(copydata->dstrect.w - copydata->center.x));
+    const double dy = SDL_max(SDL_fabs(copydata->center.y), SDL_fabs(copydata->dstrect.h - copydata->center.y));
+    /* The rotated surface can be a couple of pixels larger than the exact bounds */
+    const double radius = SDL_sqrt(dx * dx + dy * dy) + 2.0;
+
+    bounds->x = (int)SDL_floor(cx - radius);
+    bounds->y = (int)SDL_floor(cy - radius);
+    bounds->w = (int)SDL_ceil(2.0 * radius) + 1;
+    bounds->h = bounds->w;
+}
+
+/* Conservative check whether a rotated copy can touch the current clip rect */
+static SDL_bool
+SW_CopyExIntersectsClip(SDL_Surface *surface, const CopyExData *copydata)
+{
+    SDL_Rect bounds;
+
+    SW_GetCopyExBounds(copydata, &bounds);
+    return SDL_HasIntersection(&bounds, &surface->clip_rect);
+}
+
+static void
+PrepTextureForCopy(const SDL_RenderCommand *cmd, SDL_Surface *surface)
 {
     const Uint8 r = cmd->data.draw.r;
     const Uint8 g = cmd->data.draw.g;
     const Uint8 b = cmd->data.draw.b;
     const Uint8 a = cmd->data.draw.a;
     const SDL_BlendMode blend = cmd->data.draw.blend;
-    SDL_Texture *texture = cmd->data.draw.texture;
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
     const SDL_bool colormod = ((r & g & b) != 0xFF);
     const SDL_bool alphamod = (a != 0xFF);
     const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL));
@@ -591,35 +1030,438 @@ SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
     if (drawstate->surface_cliprect_dirty) {
         const SDL_Rect *viewport = drawstate->viewport;
         const SDL_Rect *cliprect = drawstate->cliprect;
+        SDL_Rect clip_rect;
         SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
 
         if (cliprect != NULL) {
-            SDL_Rect clip_rect;
             clip_rect.x = cliprect->x + viewport->x;
             clip_rect.y = cliprect->y + viewport->y;
             clip_rect.w = cliprect->w;
             clip_rect.h = cliprect->h;
             SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
         } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
+            clip_rect = *viewport;
         }
+        if (drawstate->tile != NULL) {
+            SDL_IntersectRect(drawstate->tile, &clip_rect, &clip_rect);
+        }
+        SDL_SetClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
+static void SW_DrawCommands(SDL_Renderer * renderer, SDL_Surface *surface, SW_TileWorker *worker,
+                            const SDL_Rect *tile, SDL_RenderCommand *cmd, void *vertices);
+
+static Uint32
+SW_HashSurface(const SDL_Surface *surface)
+{
+    return (Uint32)(((uintptr_t)surface) >> 4) * 2654435761u;
+}
+
+static void
+SW_InsertTileSourceView(SW_TileWorker *worker, SDL_Surface *src, SDL_Surface *view)
+{
+    const Uint32 mask = (Uint32)(worker->max_views - 1);
+    Uint32 i = SW_HashSurface(src) & mask;
+
+    while (worker->views[i].src != NULL) {
+        i = (i + 1) & mask;
+    }
+    worker->views[i].src = src;
+    worker->views[i].view = view;
+    ++worker->num_views;
+}
+
+static SDL_Surface *
+SW_GetTileSourceView(SW_TileWorker *worker, SDL_Surface *src)
+{
+    SW_TileSourceView *slot;
+    SDL_Surface *view;
+    SDL_BlendMode blendMode;
+    Uint32 colorkey;
+    Uint32 mask, i;
+
+    if (worker->max_views) {
+        mask = (Uint32)(worker->max_views - 1);
+        i = SW_HashSurface(src) & mask;
+        while ((slot = &worker->views[i])->src != NULL) {
+            if (slot->src == src) {
+                /* Decoding RLE data reallocates the pixels */
+                slot->view->pixels = src->pixels;
+                return slot->view;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    /* Keep the table at most half full */
+    if ((worker->num_views + 1) * 2 > worker->max_views) {
+        SW_TileSourceView *views = worker->views;
+        const int max_views = worker->max_views;
+        const int new_max = max_views ? max_views * 2 : 16;
+
+        worker->views = (SW_TileSourceView *) SDL_calloc(new_max, sizeof (*worker->views));
+        if (!worker->views) {
+            worker->views = views;
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        worker->max_views = new_max;
+        worker->num_views = 0;
+        for (i = 0; i < (Uint32)max_views; ++i) {
+            if (views[i].src) {
+                SW_InsertTileSourceView(worker, views[i].src, views[i].view);
+            }
+        }
+        SDL_free(views);
+    }
+
+    view = SDL_CreateRGBSurfaceWithFormatFrom(src->pixels, src->w, src->h,
+                                              src->format->BitsPerPixel, src->pitch,
+                                              src->format->format);
+    if (!view) {
+        return NULL;
+    }
+    /* Rotated surfaces come with a colorkey and blend mode, textures get theirs when copying */
+    if (SDL_GetColorKey(src, &colorkey) == 0) {
+        SDL_SetColorKey(view, SDL_TRUE, colorkey);
+    }
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_SetSurfaceBlendMode(view, blendMode);
+    SW_InsertTileSourceView(worker, src, view);
+    return view;
+}
+
+static void
+SW_RemoveTileSourceView(SW_TileWorker *worker, SDL_Surface *src)
+{
+    Uint32 mask, i;
+
+    if (!worker->num_views) {
+        return;
+    }
+
+    mask = (Uint32)(worker->max_views - 1);
+    i = SW_HashSurface(src) & mask;
+    while (worker->views[i].src != src) {
+        if (worker->views[i].src == NULL) {
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+
+    SDL_FreeSurface(worker->views[i].view);
+    worker->views[i].src = NULL;
+    --worker->num_views;
+
+    /* Reinsert the rest of the cluster so lookups don't stop at the hole */
+    for (i = (i + 1) & mask; worker->views[i].src != NULL; i = (i + 1) & mask) {
+        SW_TileSourceView entry = worker->views[i];
+        worker->views[i].src = NULL;
+        --worker->num_views;
+        SW_InsertTileSourceView(worker, entry.src, entry.view);
+    }
+}
+
+static SDL_Surface *
+SW_GetCopySource(SW_TileWorker *worker, SDL_Texture *texture)
+{
+    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+
+    if (worker) {
+        return SW_GetTileSourceView(worker, src);
+    }
+    return src;
+}
+
 static int
-SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+SW_UpdateTileTarget(SW_TileWorker *worker, SDL_Surface *surface)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    SDL_Surface *target = worker->target;
+    int i;
 
-    if (!surface) {
+    if (target &&
+        target->pixels == surface->pixels && target->pitch == surface->pitch &&
+        target->w == surface->w && target->h == surface->h &&
+        target->format->format == surface->format->format) {
+        return 0;
+    }
+
+    if (target) {
+        /* The source views hold a reference to the target they're mapped to */
+        for (i = 0; i < worker->max_views; ++i) {
+            if (worker->views[i].src) {
+                SDL_InvalidateMap(worker->views[i].view->map);
+            }
+        }
+        SDL_FreeSurface(target);
+        worker->target = NULL;
+    }
+
+    worker->target = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                                        surface->format->BitsPerPixel, surface->pitch,
+                                                        surface->format->format);
+    if (!worker->target) {
         return -1;
     }
+    return 0;
+}
+
+static void
+SW_RunTiles(SW_TileWorker *worker)
+{
+    SW_RenderData *data = worker->renderdata;
+    SDL_Surface *target = worker->target;
+    SDL_Rect tile;
+    int i;
+
+    while ((i = SDL_AtomicAdd(&data->next_tile, 1)) < data->num_tiles) {
+        const int y1 = (target->h * i) / data->num_tiles;
+        const int y2 = (target->h * (i + 1)) / data->num_tiles;
+        tile.x = 0;
+        tile.y = y1;
+        tile.w = target->w;
+        tile.h = y2 - y1;
+        SW_DrawCommands(data->renderer, target, worker, &tile, data->commands, data->vertices);
+    }
+}
+
+static int SDLCALL
+SW_TileThread(void *userdata)
+{
+    SW_TileWorker *worker = (SW_TileWorker *) userdata;
+    SW_RenderData *data = worker->renderdata;
+
+    for ( ; ; ) {
+        SDL_SemWait(data->work_sem);
+        if (data->shutdown) {
+            break;
+        }
+        SW_RunTiles(worker);
+        SDL_SemPost(data->done_sem);
+    }
+    return 0;
+}
+
+static void
+SW_DestroyTileWorkers(SW_RenderData *data)
+{
+    int i;
+
+    if (!data->workers) {
+        return;
+    }
+
+    data->shutdown = SDL_TRUE;
+    for (i = 1; i < data->num_workers; ++i) {
+        if (data->workers[i].thread) {
+            SDL_SemPost(data->work_sem);
+        }
+    }
+    for (i = 0; i < data->num_workers; ++i) {
+        SW_TileWorker *worker = &data->workers[i];
+        int j;
+
+        if (worker->thread) {
+            SDL_WaitThread(worker->thread, NULL);
+        }
+        for (j = 0; j < worker->max_views; ++j) {
+            if (worker->views[j].src) {
+                SDL_FreeSurface(worker->views[j].view);
+            }
+        }
+        SDL_free(worker->views);
+        SDL_FreeSurface(worker->target);
+    }
+
+    if (data->work_sem) {
+        SDL_DestroySemaphore(data->work_sem);
+    }
+    if (data->done_sem) {
+        SDL_DestroySemaphore(data->done_sem);
+    }
+    SDL_free(data->workers);
+    data->workers = NULL;
+    data->num_workers = 0;
+}
+
+static void
+SW_CreateTileWorkers(SW_RenderData *data)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int num_workers = 1;
+    int i;
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "auto") == 0) {
+            num_workers = SDL_GetCPUCount();
+        } else {
+            num_workers = SDL_atoi(hint);
+        }
+    }
+    num_workers = SDL_min(num_workers, SW_MAX_THREADS);
+    if (num_workers <= 1) {
+        return;
+    }
+
+    data->workers = (SW_TileWorker *) SDL_calloc(num_workers, sizeof (*data->workers));
+    if (!data->workers) {
+        return;
+    }
+    data->num_workers = num_workers;
+    data->work_sem = SDL_CreateSemaphore(0);
+    data->done_sem = SDL_CreateSemaphore(0);
+    if (!data->work_sem || !data->done_sem) {
+        SW_DestroyTileWorkers(data);
+        return;
+    }
 
+    /* The rendering thread is worker 0 */
+    for (i = 0; i < num_workers; ++i) {
+        SW_TileWorker *worker = &data->workers[i];
+        worker->renderdata = data;
+        if (i > 0) {
+            char name[32];
+            SDL_snprintf(name, sizeof (name), "SDLRenderSW%d", i);
+            worker->thread = SDL_CreateThreadInternal(SW_TileThread, name, 0, worker);
+            if (!worker->thread) {
+                /* Not fatal, just render on the calling thread */
+                SW_DestroyTileWorkers(data);
+                return;
+            }
+        }
+    }
+}
+
+/* Clipping a line or a scaled copy to a tile moves the points it samples,
+ * which would leave seams between the tiles, so queues with those are drawn
+ * in one piece. So are queues copying RLE encoded textures: the workers can
+ * only share the decoded pixels, and decoding them for every tiled batch
+ * would have the next untiled batch encode them again.
+ */
+static SDL_bool
+SW_CanRunTiled(const SDL_RenderCommand *cmd, const void *vertices)
+{
+    for ( ; cmd; cmd = cmd->next) {
+        if (cmd->command == SDL_RENDERCMD_DRAW_LINES) {
+            return SDL_FALSE;
+        }
+#if SDL_HAVE_RLE
+        if (cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX) {
+            const SDL_Surface *src = (const SDL_Surface *) cmd->data.draw.texture->driverdata;
+            if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+                return SDL_FALSE;
+            }
+        }
+#endif
+        if (cmd->command == SDL_RENDERCMD_COPY) {
+            const SDL_Rect *verts = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+            size_t i;
+            for (i = 0; i < cmd->data.draw.count; i++, verts += 2) {
+                if (verts[0].w != verts[1].w || verts[0].h != verts[1].h) {
+                    return SDL_FALSE;
+                }
+            }
+        }
+    }
+    return SDL_TRUE;
+}
+
+static int
+SW_RunCommandQueueTiled(SDL_Renderer * renderer, SW_RenderData *data, SDL_Surface *surface,
+                        SDL_RenderCommand *cmd, void *vertices)
+{
+    SDL_RenderCommand *it;
+    SW_DrawStateCache drawstate;
+    int i, retval = 0;
+
+    /* Each rotated copy is made once before dispatching, skipping the ones
+     * outside their clip rect, and the workers share it.
+     */
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
+    drawstate.tile = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
+    data->num_transforms = 0;
+    for (it = cmd; it; it = it->next) {
+        if (it->command == SDL_RENDERCMD_SETVIEWPORT) {
+            drawstate.viewport = &it->data.viewport.rect;
+            drawstate.surface_cliprect_dirty = SDL_TRUE;
+        } else if (it->command == SDL_RENDERCMD_SETCLIPRECT) {
+            drawstate.cliprect = it->data.cliprect.enabled ? &it->data.cliprect.rect : NULL;
+            drawstate.surface_cliprect_dirty = SDL_TRUE;
+        } else if (it->command == SDL_RENDERCMD_COPY_EX) {
+            SDL_Surface *src = (SDL_Surface *) it->data.draw.texture->driverdata;
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + it->data.draw.first);
+            SW_TransformedSurface *xform = NULL;
+
+            if (data->num_transforms == data->max_transforms) {
+                const int max_transforms = data->max_transforms ? data->max_transforms * 2 : 32;
+                void *ptr = SDL_realloc(data->transforms, max_transforms * sizeof (*data->transforms));
+                if (!ptr) {
+                    retval = SDL_OutOfMemory();
+                    goto done;
+                }
+                data->transforms = (SW_TransformedSurface **) ptr;
+                data->max_transforms = max_transforms;
+            }
+            SetDrawState(surface, &drawstate);
+            if (SW_CopyExIntersectsClip(surface, copydata)) {
+                SW_TransformKey key;
+                SW_MakeTransformKey(&key, src, it->data.draw.texture, it, copydata);
+                xform = SW_GetTransformedSurface(data, src, &key);
+            }
+            data->transforms[data->num_transforms++] = xform;
+        }
+    }
+    SDL_SetClipRect(surface, NULL);
+
+    for (i = 0; i < data->num_workers; ++i) {
+        if (SW_UpdateTileTarget(&data->workers[i], surface) < 0) {
+            retval = -1;
+            goto done;
+        }
+    }
+
+    data->renderer = renderer;
+    data->commands = cmd;
+    data->vertices = vertices;
+    data->num_tiles = SDL_min(data->num_workers * 2, surface->h / SW_MIN_TILE_HEIGHT);
+    SDL_AtomicSet(&data->next_tile, 0);
+
+    for (i = 1; i < data->num_workers; ++i) {
+        SDL_SemPost(data->work_sem);
+    }
+    SW_RunTiles(&data->workers[0]);
+    for (i = 1; i < data->num_workers; ++i) {
+        SDL_SemWait(data->done_sem);
+    }
+
+    data->commands = NULL;
+    data->vertices = NULL;
+
+done:
+    for (i = 0; i < data->num_transforms; ++i) {
+        if (data->transforms[i]) {
+            SW_ReleaseTransformedSurface(data->transforms[i]);
+        }
+    }
+    data->num_transforms = 0;
+    SW_TrimTransformCache(data);
+    return retval;
+}
+
+static void
+SW_DrawCommands(SDL_Renderer * renderer, SDL_Surface *surface, SW_TileWorker *worker,
+                const SDL_Rect *tile, SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_DrawStateCache drawstate;
+    int transform_index = 0;
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.tile = tile;
     drawstate.surface_cliprect_dirty = SDL_TRUE;
 
     while (cmd) {
@@ -635,7 +1477,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
             }
 
             case SDL_RENDERCMD_SETCLIPRECT: {
-                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;                
+                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
                 drawstate.surface_cliprect_dirty = SDL_TRUE;
                 break;
             }
@@ -646,7 +1488,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 const Uint8 b = cmd->data.color.b;
                 const Uint8 a = cmd->data.color.a;
                 /* By definition the clear ignores the clip rect */
-                SDL_SetClipRect(surface, NULL);
+                SDL_SetClipRect(surface, tile);
                 SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
                 drawstate.surface_cliprect_dirty = SDL_TRUE;
                 break;
@@ -704,34 +1546,62 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
             }
 
             case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
-                SDL_Texture *texture = cmd->data.draw.texture;
-                SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+                /* Consecutive copies with the same state are queued as one command */
+                const SDL_Rect *verts = (const SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                SDL_Surface *src = SW_GetCopySource(worker, cmd->data.draw.texture);
+                size_t i;
+
+                if (!src) {
+                    break;
+                }
 
                 SetDrawState(surface, &drawstate);
 
-                PrepTextureForCopy(cmd);
+                PrepTextureForCopy(cmd, src);
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+                for (i = 0; i < cmd->data.draw.count; i++, verts += 2) {
+                    const SDL_Rect *srcrect = verts;
+                    /* The blit clips the destination rect, keep the queued one intact for the other tiles */
+                    SDL_Rect dstrect = verts[1];
+
+                    if ( srcrect->w == dstrect.w && srcrect->h == dstrect.h ) {
+                        SDL_BlitSurface(src, srcrect, surface, &dstrect);
+                    } else {
+                        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+                         * to avoid potentially frequent RLE encoding/decoding.
+                         */
+                        SDL_SetSurfaceRLE(surface, 0);
+                        SDL_PrivateUpperBlitScaled(src, srcrect, surface, &dstrect, cmd->data.draw.texture->scaleMode != SDL_ScaleModeNearest);
+                    }
                 }
                 break;
             }
 
             case SDL_RENDERCMD_COPY_EX: {
                 const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                SW_TransformedSurface *xform;
+                SDL_Surface *rotated, *mask;
+
                 SetDrawState(surface, &drawstate);
-                PrepTextureForCopy(cmd);
-                SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                                &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
+                if (!worker) {
+                    if (SW_CopyExIntersectsClip(surface, copydata)) {
+                        SW_RenderCopyEx(renderer, surface, cmd, copydata);
+                    }
+                    break;
+                }
+
+                /* The rendering thread transformed the texture before dispatching */
+                xform = worker->renderdata->transforms[transform_index++];
+                if (!xform || !SW_CopyExIntersectsClip(surface, copydata)) {
+                    break;
+                }
+                rotated = SW_GetTileSourceView(worker, xform->rotated);
+                mask = xform->mask ? SW_GetTileSourceView(worker, xform->mask) : NULL;
+                if (!rotated || (xform->mask && !mask)) {
+                    break;
+                }
+                SW_BlitTransformedSurface(surface, xform, rotated, mask, &copydata->dstrect, &copydata->center,
+                                          cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
                 break;
             }
 
@@ -741,7 +1611,148 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
 
         cmd = cmd->next;
     }
+}
+
+static void
+SW_AddDirtyRect(SW_RenderData *data, const SDL_Rect *rect)
+{
+    int i;
+
+    for (i = 0; i < data->num_dirty_rects; ++i) {
+        if (SDL_HasIntersection(&data->dirty_rects[i], rect)) {
+            SDL_UnionRect(&data->dirty_rects[i], rect, &data->dirty_rects[i]);
+            return;
+        }
+    }
+
+    if (data->num_dirty_rects == SW_MAX_DIRTY_RECTS) {
+        for (i = 1; i < data->num_dirty_rects; ++i) {
+            SDL_UnionRect(&data->dirty_rects[0], &data->dirty_rects[i], &data->dirty_rects[0]);
+        }
+        SDL_UnionRect(&data->dirty_rects[0], rect, &data->dirty_rects[0]);
+        data->num_dirty_rects = 1;
+        return;
+    }
+
+    data->dirty_rects[data->num_dirty_rects++] = *rect;
+}
+
+/* Records the area of the window surface each drawing command can touch,
+ * clipped the same way SetDrawState() clips it.
+ */
+static void
+SW_AddDirtyCommands(SW_RenderData *data, SDL_Surface *surface, const SDL_RenderCommand *cmd, const void *vertices)
+{
+    const SDL_Rect *viewport = NULL;
+    const SDL_Rect *cliprect = NULL;
+    SDL_Rect clip_rect, bounds;
+    size_t i;
+
+    clip_rect.x = 0;
+    clip_rect.y = 0;
+    clip_rect.w = surface->w;
+    clip_rect.h = surface->h;
+
+    for ( ; cmd && !data->dirty_full; cmd = cmd->next) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+            case SDL_RENDERCMD_SETCLIPRECT:
+                if (cmd->command == SDL_RENDERCMD_SETVIEWPORT) {
+                    viewport = &cmd->data.viewport.rect;
+                } else {
+                    cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+                }
+                clip_rect.x = 0;
+                clip_rect.y = 0;
+                clip_rect.w = surface->w;
+                clip_rect.h = surface->h;
+                if (viewport) {
+                    SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
+                    if (cliprect) {
+                        bounds.x = cliprect->x + viewport->x;
+                        bounds.y = cliprect->y + viewport->y;
+                        bounds.w = cliprect->w;
+                        bounds.h = cliprect->h;
+                        SDL_IntersectRect(&bounds, &clip_rect, &clip_rect);
+                    }
+                }
+                continue;
+
+            case SDL_RENDERCMD_CLEAR:
+                /* By definition the clear ignores the clip rect */
+                data->dirty_full = SDL_TRUE;
+                continue;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES: {
+                const SDL_Point *points = (const SDL_Point *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+                if (!SDL_EnclosePoints(points, (int) cmd->data.draw.count, NULL, &bounds)) {
+                    continue;
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_FILL_RECTS: {
+                const SDL_Rect *rects = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+                if (cmd->data.draw.count == 0) {
+                    continue;
+                }
+                bounds = rects[0];
+                for (i = 1; i < cmd->data.draw.count; i++) {
+                    SDL_UnionRect(&bounds, &rects[i], &bounds);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_COPY: {
+                /* Source and destination rects alternate */
+                const SDL_Rect *rects = (const SDL_Rect *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+                bounds = rects[1];
+                for (i = 1; i < cmd->data.draw.count; i++) {
+                    SDL_UnionRect(&bounds, &rects[i * 2 + 1], &bounds);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_COPY_EX: {
+                const CopyExData *copydata = (const CopyExData *) (((const Uint8 *) vertices) + cmd->data.draw.first);
+                SW_GetCopyExBounds(copydata, &bounds);
+                break;
+            }
+
+            default:
+                continue;
+        }
+
+        if (SDL_IntersectRect(&bounds, &clip_rect, &bounds)) {
+            SW_AddDirtyRect(data, &bounds);
+        }
+    }
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+
+    if (!surface) {
+        return -1;
+    }
+
+    /* Drawing into a texture changes what rotating it gives */
+    if (surface != (data->logical ? data->logical : data->window)) {
+        SW_InvalidateTransformCache(data, surface);
+    } else if (renderer->window) {
+        SW_AddDirtyCommands(data, surface, cmd, vertices);
+    }
+
+    if (data->num_workers > 1 && surface->h / SW_MIN_TILE_HEIGHT >= 2 &&
+        !SDL_ISPIXELFORMAT_INDEXED(surface->format->format) && SW_CanRunTiled(cmd, vertices)) {
+        return SW_RunCommandQueueTiled(renderer, data, surface, cmd, vertices);
+    }
 
+    SW_DrawCommands(renderer, surface, NULL, NULL, cmd, vertices);
     return 0;
 }
 
@@ -776,21 +1787,125 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                              format, pixels, pitch);
 }
 
+/* Scales the whole logical surface into the window, one blit per frame
+ * instead of one scaled blit per command.
+ */
+static void
+SW_PresentLogical(SW_RenderData *data, SDL_Window *window)
+{
+    SDL_Rect dstrect = data->logical_viewport;
+    SDL_Rect bounds;
+
+    if (!data->dirty_full && data->num_dirty_rects == 0) {
+        return;
+    }
+
+    if (!data->window) {
+        data->window = SDL_GetWindowSurface(window);
+        if (!data->window) {
+            return;
+        }
+        data->dirty_full = SDL_TRUE;
+    }
+
+    if (data->dirty_full) {
+        /* Clear the bars around the logical output */
+        const Uint32 black = SDL_MapRGB(data->window->format, 0, 0, 0);
+        SDL_Rect bars[4];
+        int num_bars = 0;
+
+        if (dstrect.y > 0) {
+            bars[num_bars].x = 0;
+            bars[num_bars].y = 0;
+            bars[num_bars].w = data->window->w;
+            bars[num_bars].h = dstrect.y;
+            ++num_bars;
+        }
+        if (dstrect.y + dstrect.h < data->window->h) {
+            bars[num_bars].x = 0;
+            bars[num_bars].y = dstrect.y + dstrect.h;
+            bars[num_bars].w = data->window->w;
+            bars[num_bars].h = data->window->h - bars[num_bars].y;
+            ++num_bars;
+        }
+        if (dstrect.x > 0) {
+            bars[num_bars].x = 0;
+            bars[num_bars].y = dstrect.y;
+            bars[num_bars].w = dstrect.x;
+            bars[num_bars].h = dstrect.h;
+            ++num_bars;
+        }
+        if (dstrect.x + dstrect.w < data->window->w) {
+            bars[num_bars].x = dstrect.x + dstrect.w;
+            bars[num_bars].y = dstrect.y;
+            bars[num_bars].w = data->window->w - bars[num_bars].x;
+            bars[num_bars].h = dstrect.h;
+            ++num_bars;
+        }
+        if (num_bars > 0) {
+            SDL_SetClipRect(data->window, NULL);
+            SDL_FillRects(data->window, bars, num_bars, black);
+        }
+    }
+
+    SDL_SetClipRect(data->window, NULL);
+    if (dstrect.w == data->logical->w && dstrect.h == data->logical->h) {
+        SDL_BlitSurface(data->logical, NULL, data->window, &dstrect);
+    } else {
+        SDL_PrivateUpperBlitScaled(data->logical, NULL, data->window, &dstrect, data->logical_scale_mode != SDL_ScaleModeNearest);
+    }
+
+    if (data->dirty_full) {
+        SDL_UpdateWindowSurface(window);
+    } else {
+        bounds.x = 0;
+        bounds.y = 0;
+        bounds.w = data->window->w;
+        bounds.h = data->window->h;
+        if (SDL_IntersectRect(&data->logical_viewport, &bounds, &bounds)) {
+            SDL_UpdateWindowSurfaceRects(window, &bounds, 1);
+        }
+    }
+    data->dirty_full = SDL_FALSE;
+    data->num_dirty_rects = 0;
+}
+
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
 
-    if (window) {
+    if (!window) {
+        return;
+    }
+
+    if (data->logical) {
+        SW_PresentLogical(data, window);
+        return;
+    }
+
+    /* Only push the parts of the window drawn since the last present */
+    if (data->dirty_full) {
         SDL_UpdateWindowSurface(window);
+    } else if (data->num_dirty_rects > 0) {
+        SDL_UpdateWindowSurfaceRects(window, data->dirty_rects, data->num_dirty_rects);
     }
+    data->dirty_full = SDL_FALSE;
+    data->num_dirty_rects = 0;
 }
 
 static void
 SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    int i;
 
+    SW_InvalidateTransformCache(data, surface);
+    for (i = 0; i < data->num_workers; ++i) {
+        SW_RemoveTileSourceView(&data->workers[i], surface);
+    }
     SDL_FreeSurface(surface);
 }
 
@@ -799,15 +1914,31 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_InvalidateTransformCache(data, NULL);
+        SW_DestroyTileWorkers(data);
+        SDL_free(data->transforms);
+        SDL_FreeSurface(data->logical);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
 
+static void
+SW_GetCopyExCacheStats(SDL_Renderer * renderer, Uint64 *hits, Uint64 *misses)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+    *hits = data->transform_cache.hits;
+    *misses = data->transform_cache.misses;
+}
+
 SDL_Renderer *
 SW_CreateRendererForSurface(SDL_Surface * surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
 
     if (!surface) {
         SDL_SetError("Can't create renderer for NULL surface");
@@ -828,9 +1959,14 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->dirty_full = SDL_TRUE;
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE);
+    data->transform_cache.budget = (size_t)SDL_max((hint && *hint) ? SDL_atoi(hint) : SW_TRANSFORM_CACHE_SIZE, 0) * 1024;
+    SW_CreateTileWorkers(data);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
+    renderer->SupportsBlendMode = SW_SupportsBlendMode;
     renderer->CreateTexture = SW_CreateTexture;
     renderer->UpdateTexture = SW_UpdateTexture;
     renderer->LockTexture = SW_LockTexture;
@@ -843,12 +1979,15 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->QueueDrawLines = SW_QueueDrawPoints;  /* lines and points queue vertices the same way. */
     renderer->QueueFillRects = SW_QueueFillRects;
     renderer->QueueCopy = SW_QueueCopy;
+    renderer->QueueCopies = SW_QueueCopies;
     renderer->QueueCopyEx = SW_QueueCopyEx;
     renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
     renderer->DestroyTexture = SW_DestroyTexture;
     renderer->DestroyRenderer = SW_DestroyRenderer;
+    renderer->GetCopyExCacheStats = SW_GetCopyExCacheStats;
+    renderer->coalesce_copies = SDL_TRUE;
     renderer->info = SW_RenderDriver.info;
     renderer->driverdata = data;
 
@@ -861,12 +2000,17 @@ static SDL_Renderer *
 SW_CreateRenderer(SDL_Window * window, Uint32 flags)
 {
     SDL_Surface *surface;
+    SDL_Renderer *renderer;
 
     surface = SDL_GetWindowSurface(window);
     if (!surface) {
         return NULL;
     }
-    return SW_CreateRendererForSurface(surface);
+    renderer = SW_CreateRendererForSurface(surface);
+    if (renderer && SDL_GetHintBoolean(SDL_HINT_RENDER_SOFTWARE_LOGICAL_PRESENT, SDL_FALSE)) {
+        renderer->SetLogicalPresentation = SW_SetLogicalPresentation;
+    }
+    return renderer;
 }
 
 SDL_RenderDriver SW_RenderDriver = {
@@ -41,6 +41,7 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 
 #include "SDL.h"
 #include "SDL_rotate.h"
+#include "../../video/SDL_blit.h"
 
 /* ---- Internally used structures */
 
@@ -209,6 +210,528 @@ transformSurfaceY90(SDL_Surface * src, SDL_Surface * dst, int angle, int flipx,
 
 #undef TRANSFORM_SURFACE_90
 
+/* !
+\brief SIMD row kernels for the rotozoomers.
+
+Each kernel transforms as many whole groups of destination pixels of a row as it can,
+starting at 'sdx'/'sdy', and returns the number of pixels it wrote. The caller finishes
+the row with the scalar code. The results are bit-exact with the scalar code: the same
+16.16 coordinates are used and the interpolation keeps the scalar rounding by taking
+the high half of the signed difference times the unsigned 16-bit fraction.
+Destination pixels that fall outside of the source are left untouched.
+'flipx' and 'flipy' must be 0 or 1.
+*/
+
+#ifdef __SSE2__
+/* ((c1 - c0) * f >> 16) + c0 for eight 16-bit channels */
+static __m128i
+lerpChannels_SSE2(__m128i c0, __m128i c1, __m128i f)
+{
+    const __m128i d = _mm_sub_epi16(c1, c0);
+    /* mulhi_epu16 treats d as unsigned, correct for the negative ones */
+    const __m128i hi = _mm_sub_epi16(_mm_mulhi_epu16(d, f), _mm_and_si128(_mm_srai_epi16(d, 15), f));
+    return _mm_add_epi16(hi, c0);
+}
+
+static int
+transformRowRGBASmooth_SSE2(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *) src->pixels;
+    const int pitch = src->pitch;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i minus1 = _mm_set1_epi32(-1);
+    const __m128i lowbyte = _mm_set1_epi16(0xff);
+    const __m128i lowword = _mm_set1_epi32(0xffff);
+    const __m128i sw = _mm_set1_epi32(src->w - 1);
+    const __m128i sh = _mm_set1_epi32(src->h - 1);
+    const __m128i stepx = _mm_set1_epi32(icos * 4);
+    const __m128i stepy = _mm_set1_epi32(isin * 4);
+    __m128i vsdx = _mm_setr_epi32(sdx, sdx + icos, sdx + icos * 2, sdx + icos * 3);
+    __m128i vsdy = _mm_setr_epi32(sdy, sdy + isin, sdy + isin * 2, sdy + isin * 3);
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, pc += 4) {
+        __m128i dx = _mm_srai_epi32(vsdx, 16);
+        __m128i dy = _mm_srai_epi32(vsdy, 16);
+        __m128i inside;
+        int mask;
+
+        if (flipx) dx = _mm_sub_epi32(sw, dx);
+        if (flipy) dy = _mm_sub_epi32(sh, dy);
+        inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(dx, minus1), _mm_cmpgt_epi32(dy, minus1)),
+                               _mm_and_si128(_mm_cmplt_epi32(dx, sw), _mm_cmplt_epi32(dy, sh)));
+        mask = _mm_movemask_ps(_mm_castsi128_ps(inside));
+        if (mask) {
+            int xs[4], ys[4];
+            Uint32 c00[4], c01[4], c10[4], c11[4];
+            __m128i ex, ey, exlo, exhi, eylo, eyhi, v00, v01, v10, v11, t1lo, t1hi, t2lo, t2hi, out;
+
+            _mm_storeu_si128((__m128i *) xs, dx);
+            _mm_storeu_si128((__m128i *) ys, dy);
+            for (i = 0; i < 4; ++i) {
+                if (mask & (1 << i)) {
+                    /* Flipping swaps the neighbours instead of the fractions */
+                    const Uint8 *row0 = pixels + pitch * (ys[i] + flipy);
+                    const Uint8 *row1 = pixels + pitch * (ys[i] + 1 - flipy);
+                    const int x0 = (xs[i] + flipx) * 4;
+                    const int x1 = (xs[i] + 1 - flipx) * 4;
+                    c00[i] = *(const Uint32 *) (row0 + x0);
+                    c01[i] = *(const Uint32 *) (row0 + x1);
+                    c10[i] = *(const Uint32 *) (row1 + x0);
+                    c11[i] = *(const Uint32 *) (row1 + x1);
+                } else {
+                    c00[i] = c01[i] = c10[i] = c11[i] = 0;
+                }
+            }
+
+            /* Spread each fraction over the four channels of its pixel */
+            ex = _mm_and_si128(vsdx, lowword);
+            ey = _mm_and_si128(vsdy, lowword);
+            ex = _mm_or_si128(ex, _mm_slli_epi32(ex, 16));
+            ey = _mm_or_si128(ey, _mm_slli_epi32(ey, 16));
+            exlo = _mm_unpacklo_epi32(ex, ex);
+            exhi = _mm_unpackhi_epi32(ex, ex);
+            eylo = _mm_unpacklo_epi32(ey, ey);
+            eyhi = _mm_unpackhi_epi32(ey, ey);
+
+            v00 = _mm_loadu_si128((const __m128i *) c00);
+            v01 = _mm_loadu_si128((const __m128i *) c01);
+            v10 = _mm_loadu_si128((const __m128i *) c10);
+            v11 = _mm_loadu_si128((const __m128i *) c11);
+            t1lo = _mm_and_si128(lerpChannels_SSE2(_mm_unpacklo_epi8(v00, zero), _mm_unpacklo_epi8(v01, zero), exlo), lowbyte);
+            t1hi = _mm_and_si128(lerpChannels_SSE2(_mm_unpackhi_epi8(v00, zero), _mm_unpackhi_epi8(v01, zero), exhi), lowbyte);
+            t2lo = _mm_and_si128(lerpChannels_SSE2(_mm_unpacklo_epi8(v10, zero), _mm_unpacklo_epi8(v11, zero), exlo), lowbyte);
+            t2hi = _mm_and_si128(lerpChannels_SSE2(_mm_unpackhi_epi8(v10, zero), _mm_unpackhi_epi8(v11, zero), exhi), lowbyte);
+            out = _mm_packus_epi16(lerpChannels_SSE2(t1lo, t2lo, eylo), lerpChannels_SSE2(t1hi, t2hi, eyhi));
+
+            out = _mm_or_si128(_mm_and_si128(inside, out),
+                               _mm_andnot_si128(inside, _mm_loadu_si128((const __m128i *) pc)));
+            _mm_storeu_si128((__m128i *) pc, out);
+        }
+        vsdx = _mm_add_epi32(vsdx, stepx);
+        vsdy = _mm_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+/* Shared by the 32-bit and 8-bit nearest kernels, 'bpp' is 4 or 1 */
+static SDL_INLINE int
+transformRowNearest_SSE2(SDL_Surface * src, Uint8 * pc, int bpp, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *) src->pixels;
+    const int pitch = src->pitch;
+    const __m128i minus1 = _mm_set1_epi32(-1);
+    const __m128i w = _mm_set1_epi32(src->w);
+    const __m128i h = _mm_set1_epi32(src->h);
+    const __m128i sw = _mm_set1_epi32(src->w - 1);
+    const __m128i sh = _mm_set1_epi32(src->h - 1);
+    const __m128i stepx = _mm_set1_epi32(icos * 4);
+    const __m128i stepy = _mm_set1_epi32(isin * 4);
+    __m128i vsdx = _mm_setr_epi32(sdx, sdx + icos, sdx + icos * 2, sdx + icos * 3);
+    __m128i vsdy = _mm_setr_epi32(sdy, sdy + isin, sdy + isin * 2, sdy + isin * 3);
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, pc += 4 * bpp) {
+        __m128i dx = _mm_srai_epi32(vsdx, 16);
+        __m128i dy = _mm_srai_epi32(vsdy, 16);
+        const __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(dx, minus1), _mm_cmpgt_epi32(dy, minus1)),
+                                             _mm_and_si128(_mm_cmplt_epi32(dx, w), _mm_cmplt_epi32(dy, h)));
+        const int mask = _mm_movemask_ps(_mm_castsi128_ps(inside));
+
+        if (mask) {
+            int xs[4], ys[4];
+
+            if (flipx) dx = _mm_sub_epi32(sw, dx);
+            if (flipy) dy = _mm_sub_epi32(sh, dy);
+            _mm_storeu_si128((__m128i *) xs, dx);
+            _mm_storeu_si128((__m128i *) ys, dy);
+            for (i = 0; i < 4; ++i) {
+                if (mask & (1 << i)) {
+                    const Uint8 *sp = pixels + pitch * ys[i] + xs[i] * bpp;
+                    if (bpp == 4) {
+                        ((Uint32 *) pc)[i] = *(const Uint32 *) sp;
+                    } else {
+                        pc[i] = *sp;
+                    }
+                }
+            }
+        }
+        vsdx = _mm_add_epi32(vsdx, stepx);
+        vsdy = _mm_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+static int
+transformRowRGBANearest_SSE2(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    return transformRowNearest_SSE2(src, (Uint8 *) pc, 4, width, sdx, sdy, icos, isin, flipx, flipy);
+}
+
+static int
+transformRowY_SSE2(SDL_Surface * src, tColorY * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    return transformRowNearest_SSE2(src, (Uint8 *) pc, 1, width, sdx, sdy, icos, isin, flipx, flipy);
+}
+#endif /* __SSE2__ */
+
+#if SDL_AVX2_INTRINSICS
+static SDL_TARGETING("avx2") __m256i
+lerpChannels_AVX2(__m256i c0, __m256i c1, __m256i f)
+{
+    const __m256i d = _mm256_sub_epi16(c1, c0);
+    const __m256i hi = _mm256_sub_epi16(_mm256_mulhi_epu16(d, f), _mm256_and_si256(_mm256_srai_epi16(d, 15), f));
+    return _mm256_add_epi16(hi, c0);
+}
+
+static SDL_TARGETING("avx2") int
+transformRowRGBASmooth_AVX2(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const int *pixels = (const int *) src->pixels;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i lowbyte = _mm256_set1_epi16(0xff);
+    const __m256i lowword = _mm256_set1_epi32(0xffff);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch / 4);
+    const __m256i x0off = _mm256_set1_epi32(flipx);
+    const __m256i x1off = _mm256_set1_epi32(1 - flipx);
+    const __m256i y0off = _mm256_set1_epi32(flipy);
+    const __m256i y1off = _mm256_set1_epi32(1 - flipy);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i stepx = _mm256_set1_epi32(icos * 8);
+    const __m256i stepy = _mm256_set1_epi32(isin * 8);
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8, pc += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        __m256i inside;
+
+        if (flipx) dx = _mm256_sub_epi32(sw, dx);
+        if (flipy) dy = _mm256_sub_epi32(sh, dy);
+        inside = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(dy, minus1)),
+                                  _mm256_and_si256(_mm256_cmpgt_epi32(sw, dx), _mm256_cmpgt_epi32(sh, dy)));
+        if (!_mm256_testz_si256(inside, inside)) {
+            const __m256i row0 = _mm256_mullo_epi32(_mm256_add_epi32(dy, y0off), pitch);
+            const __m256i row1 = _mm256_mullo_epi32(_mm256_add_epi32(dy, y1off), pitch);
+            const __m256i x0 = _mm256_add_epi32(dx, x0off);
+            const __m256i x1 = _mm256_add_epi32(dx, x1off);
+            const __m256i v00 = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(row0, x0), inside, 4);
+            const __m256i v01 = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(row0, x1), inside, 4);
+            const __m256i v10 = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(row1, x0), inside, 4);
+            const __m256i v11 = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(row1, x1), inside, 4);
+            __m256i ex = _mm256_and_si256(vsdx, lowword);
+            __m256i ey = _mm256_and_si256(vsdy, lowword);
+            __m256i exlo, exhi, eylo, eyhi, t1lo, t1hi, t2lo, t2hi, out;
+
+            /* In-lane unpacks, matching the order of the byte unpacks below */
+            ex = _mm256_or_si256(ex, _mm256_slli_epi32(ex, 16));
+            ey = _mm256_or_si256(ey, _mm256_slli_epi32(ey, 16));
+            exlo = _mm256_unpacklo_epi32(ex, ex);
+            exhi = _mm256_unpackhi_epi32(ex, ex);
+            eylo = _mm256_unpacklo_epi32(ey, ey);
+            eyhi = _mm256_unpackhi_epi32(ey, ey);
+
+            t1lo = _mm256_and_si256(lerpChannels_AVX2(_mm256_unpacklo_epi8(v00, zero), _mm256_unpacklo_epi8(v01, zero), exlo), lowbyte);
+            t1hi = _mm256_and_si256(lerpChannels_AVX2(_mm256_unpackhi_epi8(v00, zero), _mm256_unpackhi_epi8(v01, zero), exhi), lowbyte);
+            t2lo = _mm256_and_si256(lerpChannels_AVX2(_mm256_unpacklo_epi8(v10, zero), _mm256_unpacklo_epi8(v11, zero), exlo), lowbyte);
+            t2hi = _mm256_and_si256(lerpChannels_AVX2(_mm256_unpackhi_epi8(v10, zero), _mm256_unpackhi_epi8(v11, zero), exhi), lowbyte);
+            out = _mm256_packus_epi16(lerpChannels_AVX2(t1lo, t2lo, eylo), lerpChannels_AVX2(t1hi, t2hi, eyhi));
+            _mm256_maskstore_epi32((int *) pc, inside, out);
+        }
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+static SDL_TARGETING("avx2") int
+transformRowRGBANearest_AVX2(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const int *pixels = (const int *) src->pixels;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i w = _mm256_set1_epi32(src->w);
+    const __m256i h = _mm256_set1_epi32(src->h);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch / 4);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i stepx = _mm256_set1_epi32(icos * 8);
+    const __m256i stepy = _mm256_set1_epi32(isin * 8);
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8, pc += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        const __m256i inside = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(dy, minus1)),
+                                                _mm256_and_si256(_mm256_cmpgt_epi32(w, dx), _mm256_cmpgt_epi32(h, dy)));
+
+        if (!_mm256_testz_si256(inside, inside)) {
+            __m256i out;
+
+            if (flipx) dx = _mm256_sub_epi32(sw, dx);
+            if (flipy) dy = _mm256_sub_epi32(sh, dy);
+            out = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), dx), inside, 4);
+            _mm256_maskstore_epi32((int *) pc, inside, out);
+        }
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+static SDL_TARGETING("avx2") int
+transformRowY_AVX2(SDL_Surface * src, tColorY * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    /* Gather the 32-bit words starting at the source bytes, or ending at them
+       near the end of the pixels, so nothing outside the surface is read. */
+    const int last = (src->h - 1) * src->pitch + src->w - 4;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i lowbyte = _mm256_set1_epi32(0xff);
+    const __m256i w = _mm256_set1_epi32(src->w);
+    const __m256i h = _mm256_set1_epi32(src->h);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch);
+    const __m256i vlast = _mm256_set1_epi32(last);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i stepx = _mm256_set1_epi32(icos * 8);
+    const __m256i stepy = _mm256_set1_epi32(isin * 8);
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    int x;
+
+    if (last < 0) {
+        /* Fewer than four bytes of pixels, leave it all to the scalar code */
+        return 0;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8, pc += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        const __m256i inside = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(dy, minus1)),
+                                                _mm256_and_si256(_mm256_cmpgt_epi32(w, dx), _mm256_cmpgt_epi32(h, dy)));
+
+        if (!_mm256_testz_si256(inside, inside)) {
+            __m256i offset, start, out;
+            __m128i bytes, mask8;
+
+            if (flipx) dx = _mm256_sub_epi32(sw, dx);
+            if (flipy) dy = _mm256_sub_epi32(sh, dy);
+            offset = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), dx);
+            start = _mm256_min_epi32(offset, vlast);
+            out = _mm256_mask_i32gather_epi32(zero, (const int *) src->pixels, start, inside, 1);
+            out = _mm256_and_si256(_mm256_srlv_epi32(out, _mm256_slli_epi32(_mm256_sub_epi32(offset, start), 3)), lowbyte);
+
+            /* Narrow the eight 32-bit lanes to bytes and merge with the row */
+            bytes = _mm_packus_epi32(_mm256_castsi256_si128(out), _mm256_extracti128_si256(out, 1));
+            mask8 = _mm_packs_epi32(_mm256_castsi256_si128(inside), _mm256_extracti128_si256(inside, 1));
+            bytes = _mm_packus_epi16(bytes, bytes);
+            mask8 = _mm_packs_epi16(mask8, mask8);
+            bytes = _mm_blendv_epi8(_mm_loadl_epi64((const __m128i *) pc), bytes, mask8);
+            _mm_storel_epi64((__m128i *) pc, bytes);
+        }
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#ifdef __ARM_NEON
+/* Widens a 32-bit pixel to four 32-bit channels */
+static int32x4_t
+widenPixel_NEON(Uint32 c)
+{
+    const uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(c));
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+}
+
+/* ((c1 - c0) * f >> 16) + c0 for the four channels of a pixel */
+static int32x4_t
+lerpPixel_NEON(int32x4_t c0, int32x4_t c1, int32x4_t f)
+{
+    return vaddq_s32(vshrq_n_s32(vmulq_s32(vsubq_s32(c1, c0), f), 16), c0);
+}
+
+static int
+transformRowRGBASmooth_NEON(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *) src->pixels;
+    const int pitch = src->pitch;
+    const int32x4_t minus1 = vdupq_n_s32(-1);
+    const int32x4_t lowbyte = vdupq_n_s32(0xff);
+    const int32x4_t sw = vdupq_n_s32(src->w - 1);
+    const int32x4_t sh = vdupq_n_s32(src->h - 1);
+    const int32x4_t stepx = vdupq_n_s32(icos * 4);
+    const int32x4_t stepy = vdupq_n_s32(isin * 4);
+    const int32_t sdxs[4] = { sdx, sdx + icos, sdx + icos * 2, sdx + icos * 3 };
+    const int32_t sdys[4] = { sdy, sdy + isin, sdy + isin * 2, sdy + isin * 3 };
+    int32x4_t vsdx = vld1q_s32(sdxs);
+    int32x4_t vsdy = vld1q_s32(sdys);
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, pc += 4) {
+        int32x4_t dx = vshrq_n_s32(vsdx, 16);
+        int32x4_t dy = vshrq_n_s32(vsdy, 16);
+        uint32x4_t inside;
+        Uint32 mask[4];
+        int32_t xs[4], ys[4], exs[4], eys[4];
+
+        if (flipx) dx = vsubq_s32(sw, dx);
+        if (flipy) dy = vsubq_s32(sh, dy);
+        inside = vandq_u32(vandq_u32(vcgtq_s32(dx, minus1), vcgtq_s32(dy, minus1)),
+                           vandq_u32(vcltq_s32(dx, sw), vcltq_s32(dy, sh)));
+        vst1q_u32(mask, inside);
+        vst1q_s32(xs, dx);
+        vst1q_s32(ys, dy);
+        vst1q_s32(exs, vandq_s32(vsdx, vdupq_n_s32(0xffff)));
+        vst1q_s32(eys, vandq_s32(vsdy, vdupq_n_s32(0xffff)));
+        for (i = 0; i < 4; ++i) {
+            if (mask[i]) {
+                const Uint8 *row0 = pixels + pitch * (ys[i] + flipy);
+                const Uint8 *row1 = pixels + pitch * (ys[i] + 1 - flipy);
+                const int x0 = (xs[i] + flipx) * 4;
+                const int x1 = (xs[i] + 1 - flipx) * 4;
+                const int32x4_t ex = vdupq_n_s32(exs[i]);
+                const int32x4_t ey = vdupq_n_s32(eys[i]);
+                const int32x4_t t1 = vandq_s32(lerpPixel_NEON(widenPixel_NEON(*(const Uint32 *) (row0 + x0)),
+                                                              widenPixel_NEON(*(const Uint32 *) (row0 + x1)), ex), lowbyte);
+                const int32x4_t t2 = vandq_s32(lerpPixel_NEON(widenPixel_NEON(*(const Uint32 *) (row1 + x0)),
+                                                              widenPixel_NEON(*(const Uint32 *) (row1 + x1)), ex), lowbyte);
+                const uint16x4_t out16 = vmovn_u32(vreinterpretq_u32_s32(lerpPixel_NEON(t1, t2, ey)));
+                const uint8x8_t out8 = vmovn_u16(vcombine_u16(out16, out16));
+                ((Uint32 *) pc)[i] = vget_lane_u32(vreinterpret_u32_u8(out8), 0);
+            }
+        }
+        vsdx = vaddq_s32(vsdx, stepx);
+        vsdy = vaddq_s32(vsdy, stepy);
+    }
+    return x;
+}
+
+/* Shared by the 32-bit and 8-bit nearest kernels, 'bpp' is 4 or 1 */
+static SDL_INLINE int
+transformRowNearest_NEON(SDL_Surface * src, Uint8 * pc, int bpp, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *) src->pixels;
+    const int pitch = src->pitch;
+    const int32x4_t minus1 = vdupq_n_s32(-1);
+    const int32x4_t w = vdupq_n_s32(src->w);
+    const int32x4_t h = vdupq_n_s32(src->h);
+    const int32x4_t sw = vdupq_n_s32(src->w - 1);
+    const int32x4_t sh = vdupq_n_s32(src->h - 1);
+    const int32x4_t stepx = vdupq_n_s32(icos * 4);
+    const int32x4_t stepy = vdupq_n_s32(isin * 4);
+    const int32_t sdxs[4] = { sdx, sdx + icos, sdx + icos * 2, sdx + icos * 3 };
+    const int32_t sdys[4] = { sdy, sdy + isin, sdy + isin * 2, sdy + isin * 3 };
+    int32x4_t vsdx = vld1q_s32(sdxs);
+    int32x4_t vsdy = vld1q_s32(sdys);
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, pc += 4 * bpp) {
+        int32x4_t dx = vshrq_n_s32(vsdx, 16);
+        int32x4_t dy = vshrq_n_s32(vsdy, 16);
+        const uint32x4_t inside = vandq_u32(vandq_u32(vcgtq_s32(dx, minus1), vcgtq_s32(dy, minus1)),
+                                            vandq_u32(vcltq_s32(dx, w), vcltq_s32(dy, h)));
+        Uint32 mask[4];
+        int32_t offsets[4];
+
+        if (flipx) dx = vsubq_s32(sw, dx);
+        if (flipy) dy = vsubq_s32(sh, dy);
+        vst1q_u32(mask, inside);
+        vst1q_s32(offsets, vmlaq_s32(vmulq_n_s32(dx, bpp), dy, vdupq_n_s32(pitch)));
+        for (i = 0; i < 4; ++i) {
+            if (mask[i]) {
+                if (bpp == 4) {
+                    ((Uint32 *) pc)[i] = *(const Uint32 *) (pixels + offsets[i]);
+                } else {
+                    pc[i] = pixels[offsets[i]];
+                }
+            }
+        }
+        vsdx = vaddq_s32(vsdx, stepx);
+        vsdy = vaddq_s32(vsdy, stepy);
+    }
+    return x;
+}
+
+static int
+transformRowRGBANearest_NEON(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    return transformRowNearest_NEON(src, (Uint8 *) pc, 4, width, sdx, sdy, icos, isin, flipx, flipy);
+}
+
+static int
+transformRowY_NEON(SDL_Surface * src, tColorY * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    return transformRowNearest_NEON(src, (Uint8 *) pc, 1, width, sdx, sdy, icos, isin, flipx, flipy);
+}
+#endif /* __ARM_NEON */
+
+typedef int (*transformRowRGBAFunc)(SDL_Surface * src, tColorRGBA * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy);
+typedef int (*transformRowYFunc)(SDL_Surface * src, tColorY * pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy);
+
+/* !
+\brief Picks the fastest available row kernel for the 32 bit rotozoomer, or NULL.
+*/
+static transformRowRGBAFunc
+getTransformRowRGBA(int smooth)
+{
+    const int features = SDL_GetBlitCPUFeatures();
+
+#if SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return smooth ? transformRowRGBASmooth_AVX2 : transformRowRGBANearest_AVX2;
+    }
+#endif
+#ifdef __SSE2__
+    if (features & SDL_CPU_SSE2) {
+        return smooth ? transformRowRGBASmooth_SSE2 : transformRowRGBANearest_SSE2;
+    }
+#endif
+#ifdef __ARM_NEON
+    if (features & SDL_CPU_NEON) {
+        return smooth ? transformRowRGBASmooth_NEON : transformRowRGBANearest_NEON;
+    }
+#endif
+    return NULL;
+}
+
+/* !
+\brief Picks the fastest available row kernel for the 8 bit rotozoomer, or NULL.
+*/
+static transformRowYFunc
+getTransformRowY(void)
+{
+    const int features = SDL_GetBlitCPUFeatures();
+
+#if SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return transformRowY_AVX2;
+    }
+#endif
+#ifdef __SSE2__
+    if (features & SDL_CPU_SSE2) {
+        return transformRowY_SSE2;
+    }
+#endif
+#ifdef __ARM_NEON
+    if (features & SDL_CPU_NEON) {
+        return transformRowY_NEON;
+    }
+#endif
+    return NULL;
+}
+
 /* !
 \brief Internal 32 bit rotozoomer with optional anti-aliasing.
 
@@ -235,6 +758,7 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
     tColorRGBA c00, c01, c10, c11, cswap;
     tColorRGBA *pc, *sp;
     int gap;
+    transformRowRGBAFunc transformRow = getTransformRowRGBA(smooth);
 
     /*
     * Variable setup
@@ -256,7 +780,14 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
             dy = cy - y;
             sdx = (ax + (isin * dy)) + xd;
             sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
+            x = 0;
+            if (transformRow) {
+                x = transformRow(src, pc, dst->w, sdx, sdy, icos, isin, flipx != 0, flipy != 0);
+                sdx += x * icos;
+                sdy += x * isin;
+                pc += x;
+            }
+            for (; x < dst->w; x++) {
                 dx = (sdx >> 16);
                 dy = (sdy >> 16);
                 if (flipx) dx = sw - dx;
@@ -307,7 +838,14 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
             dy = cy - y;
             sdx = (ax + (isin * dy)) + xd;
             sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
+            x = 0;
+            if (transformRow) {
+                x = transformRow(src, pc, dst->w, sdx, sdy, icos, isin, flipx != 0, flipy != 0);
+                sdx += x * icos;
+                sdy += x * isin;
+                pc += x;
+            }
+            for (; x < dst->w; x++) {
                 dx = (sdx >> 16);
                 dy = (sdy >> 16);
                 if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
@@ -348,6 +886,7 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
     int x, y, dx, dy, xd, yd, sdx, sdy, ax, ay;
     tColorY *pc;
     int gap;
+    transformRowYFunc transformRow = getTransformRowY();
 
     /*
     * Variable setup
@@ -369,7 +908,14 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
         dy = cy - y;
         sdx = (ax + (isin * dy)) + xd;
         sdy = (ay - (icos * dy)) + yd;
-        for (x = 0; x < dst->w; x++) {
+        x = 0;
+        if (transformRow) {
+            x = transformRow(src, pc, dst->w, sdx, sdy, icos, isin, flipx != 0, flipy != 0);
+            sdx += x * icos;
+            sdy += x * isin;
+            pc += x;
+        }
+        for (; x < dst->w; x++) {
             dx = (sdx >> 16);
             dy = (sdy >> 16);
             if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
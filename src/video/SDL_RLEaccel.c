@@ -632,6 +632,27 @@ typedef struct
     Uint8 Ashift;
 } RLEDestFormat;
 
+/* save the destination format so we can undo the encoding later */
+static void
+SetRLEDestFormat(RLEDestFormat * r, const SDL_PixelFormat * df)
+{
+    /* Cleared so the padding is saved as zeros, see SDL_ReadRLESurface() */
+    SDL_zerop(r);
+    r->BytesPerPixel = df->BytesPerPixel;
+    r->Rmask = df->Rmask;
+    r->Gmask = df->Gmask;
+    r->Bmask = df->Bmask;
+    r->Amask = df->Amask;
+    r->Rloss = df->Rloss;
+    r->Gloss = df->Gloss;
+    r->Bloss = df->Bloss;
+    r->Aloss = df->Aloss;
+    r->Rshift = df->Rshift;
+    r->Gshift = df->Gshift;
+    r->Bshift = df->Bshift;
+    r->Ashift = df->Ashift;
+}
+
 /* blit a pixel-alpha RLE surface clipped at the right and/or left edges */
 static void
 RLEAlphaClipBlit(int w, Uint8 * srcbuf, SDL_Surface * surf_dst,
@@ -1097,23 +1118,7 @@ RLEAlphaSurface(SDL_Surface * surface)
     if (!rlebuf) {
         return SDL_OutOfMemory();
     }
-    {
-        /* save the destination format so we can undo the encoding later */
-        RLEDestFormat *r = (RLEDestFormat *) rlebuf;
-        r->BytesPerPixel = df->BytesPerPixel;
-        r->Rmask = df->Rmask;
-        r->Gmask = df->Gmask;
-        r->Bmask = df->Bmask;
-        r->Amask = df->Amask;
-        r->Rloss = df->Rloss;
-        r->Gloss = df->Gloss;
-        r->Bloss = df->Bloss;
-        r->Aloss = df->Aloss;
-        r->Rshift = df->Rshift;
-        r->Gshift = df->Gshift;
-        r->Bshift = df->Bshift;
-        r->Ashift = df->Ashift;
-    }
+    SetRLEDestFormat((RLEDestFormat *) rlebuf, df);
     dst = rlebuf + sizeof(RLEDestFormat);
 
     /* Do the actual encoding */
@@ -1283,6 +1288,7 @@ RLEColorkeySurface(SDL_Surface * surface)
     const int bpp = surface->format->BytesPerPixel;
     getpix_func getpix;
     Uint32 ckey, rgbmask;
+    SDL_bool keyed;
     int w, h;
 
     /* calculate the worst case size for the compressed surface */
@@ -1319,6 +1325,8 @@ RLEColorkeySurface(SDL_Surface * surface)
     dst = rlebuf;
     rgbmask = ~surface->format->Amask;
     ckey = surface->map->info.colorkey & rgbmask;
+    /* Surfaces blended without a colorkey have no transparent pixels */
+    keyed = (surface->map->info.flags & SDL_COPY_COLORKEY) ? SDL_TRUE : SDL_FALSE;
     lastline = dst;
     getpix = getpixes[bpp - 1];
     w = surface->w;
@@ -1344,10 +1352,10 @@ RLEColorkeySurface(SDL_Surface * surface)
             int skipstart = x;
 
             /* find run of transparent, then opaque pixels */
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey)
+            while (keyed && x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey)
                 x++;
             runstart = x;
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey)
+            while (x < w && (!keyed || (getpix(srcbuf + x * bpp) & rgbmask) != ckey))
                 x++;
             skip = runstart - skipstart;
             if (skip == w)
@@ -1403,45 +1411,93 @@ RLEColorkeySurface(SDL_Surface * surface)
     return 0;
 }
 
-int
-SDL_RLESurface(SDL_Surface * surface)
+/* The destination formats RLEAlphaSurface() can encode for */
+static SDL_bool
+RLEAlphaDestSupported(const SDL_PixelFormat * df)
 {
-    int flags;
+    const Uint32 masksum = df->Rmask | df->Gmask | df->Bmask;
 
-    /* Clear any previous RLE conversion */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
+    switch (df->BytesPerPixel) {
+    case 2:
+        if (masksum == 0xffff) {
+            return (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) ? SDL_TRUE : SDL_FALSE;
+        }
+        if (masksum == 0x7fff) {
+            return (df->Gmask == 0x03e0 || df->Rmask == 0x03e0 || df->Bmask == 0x03e0) ? SDL_TRUE : SDL_FALSE;
+        }
+        return SDL_FALSE;
+    case 4:
+        return (masksum == 0x00ffffff) ? SDL_TRUE : SDL_FALSE;
+    default:
+        return SDL_FALSE;
     }
+}
 
-    /* We don't support RLE encoding of bitmaps */
-    if (surface->format->BitsPerPixel < 8) {
-        return -1;
+/*
+ * Whether the surface can be RLE encoded for its current blit mapping.
+ * This only depends on the formats, the blit flags and map->identity.
+ */
+SDL_bool
+SDL_CanRLESurface(SDL_Surface * surface)
+{
+    int flags = surface->map->info.flags;
+
+    /* The surface isn't mapped for blitting yet */
+    if (!surface->map->dst) {
+        return SDL_FALSE;
     }
 
-    /* Make sure the pixels are available */
-    if (!surface->pixels) {
-        return -1;
+    /* We don't support RLE encoding of bitmaps */
+    if (surface->format->BitsPerPixel < 8) {
+        return SDL_FALSE;
     }
 
     /* If we don't have colorkey or blending, nothing to do... */
-    flags = surface->map->info.flags;
     if (!(flags & (SDL_COPY_COLORKEY | SDL_COPY_BLEND))) {
-        return -1;
+        return SDL_FALSE;
     }
 
     /* Pass on combinations not supported */
     if ((flags & SDL_COPY_MODULATE_COLOR) ||
         ((flags & SDL_COPY_MODULATE_ALPHA) && surface->format->Amask) ||
-        (flags & (SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) ||
+        (flags & (SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) ||
         (flags & SDL_COPY_NEAREST)) {
+        return SDL_FALSE;
+    }
+
+    if (!surface->format->Amask || !(flags & SDL_COPY_BLEND)) {
+        return surface->map->identity ? SDL_TRUE : SDL_FALSE;
+    }
+
+    /* The combinations RLEAlphaSurface() can encode */
+    if (surface->format->BitsPerPixel != 32) {
+        return SDL_FALSE;
+    }
+    return RLEAlphaDestSupported(surface->map->dst->format);
+}
+
+int
+SDL_RLESurface(SDL_Surface * surface)
+{
+    int flags;
+
+    /* Clear any previous RLE conversion */
+    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+        SDL_UnRLESurface(surface, 1);
+    }
+
+    /* Make sure the pixels are available */
+    if (!surface->pixels) {
+        return -1;
+    }
+
+    if (!SDL_CanRLESurface(surface)) {
         return -1;
     }
 
     /* Encode and set up the blit */
+    flags = surface->map->info.flags;
     if (!surface->format->Amask || !(flags & SDL_COPY_BLEND)) {
-        if (!surface->map->identity) {
-            return -1;
-        }
         if (RLEColorkeySurface(surface) < 0) {
             return -1;
         }
@@ -1586,6 +1642,366 @@ SDL_UnRLESurface(SDL_Surface * surface, int recode)
     }
 }
 
+/*
+ * Whether the current encoding of the surface can be used as is for its new
+ * blit mapping, in which case the RLE blit is set up again without decoding
+ * and encoding the surface.
+ */
+SDL_bool
+SDL_KeepRLESurface(SDL_Surface * surface)
+{
+    SDL_BlitMap *map = surface->map;
+    int flags = map->info.flags;
+
+    if (!(flags & SDL_COPY_RLE_DESIRED) || !SDL_CanRLESurface(surface)) {
+        return SDL_FALSE;
+    }
+
+    if (!surface->format->Amask || !(flags & SDL_COPY_BLEND)) {
+        /* Encoded in the source format, which map->identity guarantees */
+        if (!(flags & SDL_COPY_RLE_COLORKEY)) {
+            return SDL_FALSE;
+        }
+        map->blit = SDL_RLEBlit;
+    } else {
+        const RLEDestFormat *r = (const RLEDestFormat *) map->data;
+        const SDL_PixelFormat *df = map->dst->format;
+
+        if (!(flags & SDL_COPY_RLE_ALPHAKEY) ||
+            r->BytesPerPixel != df->BytesPerPixel ||
+            r->Rmask != df->Rmask || r->Gmask != df->Gmask ||
+            r->Bmask != df->Bmask || r->Amask != df->Amask) {
+            return SDL_FALSE;
+        }
+        map->blit = SDL_RLEAlphaBlit;
+    }
+    return SDL_TRUE;
+}
+
+/*
+ * Serialized form of an encoded surface, as written by SDL_SaveRLE_RW().
+ * The header fields are little endian 32-bit values:
+ *
+ *   magic "SRLE", version, byte order of the encoding, pixel format,
+ *   width, height, kind of encoding (RLE_KIND_*), colorkey enabled,
+ *   colorkey, blend mode, number of palette colors
+ *
+ * followed by the palette colors as r, g, b, a bytes, the size of the
+ * encoding and the encoding itself, as described at the top of this file.
+ * The encoding holds native 16 and 32-bit values, so it can only be loaded
+ * on a machine with the same byte order.
+ */
+#define RLE_FILE_MAGIC      SDL_FOURCC('S', 'R', 'L', 'E')
+#define RLE_FILE_VERSION    1
+#define RLE_KIND_COLORKEY   1
+#define RLE_KIND_ALPHA      2
+
+/*
+ * Walk an encoding to find its size, checking that it stays within the
+ * given number of bytes and the surface dimensions.
+ * Returns 0 if the encoding isn't well formed.
+ */
+static size_t
+RLEEncodingSize(const Uint8 * data, size_t size, int w, int h, int kind, int bpp)
+{
+    size_t pos = 0;
+    int count_size, pixel_size;
+    int lines = 0;
+
+#define READ_COUNTS(csize)                                  \
+    do {                                                    \
+        if (size - pos < 2 * (size_t)(csize)) {             \
+            return 0;                                       \
+        }                                                   \
+        if ((csize) == 1) {                                 \
+            skip = data[pos];                               \
+            run = data[pos + 1];                            \
+        } else {                                            \
+            skip = ((const Uint16 *)(data + pos))[0];       \
+            run = ((const Uint16 *)(data + pos))[1];        \
+        }                                                   \
+        pos += 2 * (csize);                                 \
+    } while (0)
+
+#define SKIP_PIXELS(psize)                                  \
+    do {                                                    \
+        if ((size - pos) / (psize) < (size_t)run) {         \
+            return 0;                                       \
+        }                                                   \
+        pos += (size_t)run * (psize);                       \
+        ofs += run;                                         \
+    } while (0)
+
+    if (kind == RLE_KIND_ALPHA) {
+        const RLEDestFormat *r = (const RLEDestFormat *) data;
+
+        if (size < sizeof(RLEDestFormat) ||
+            (r->BytesPerPixel != 2 && r->BytesPerPixel != 4)) {
+            return 0;
+        }
+        pos = sizeof(RLEDestFormat);
+        count_size = (r->BytesPerPixel == 4) ? 2 : 1;
+        pixel_size = r->BytesPerPixel;
+    } else {
+        count_size = (bpp == 4) ? 2 : 1;
+        pixel_size = bpp;
+    }
+
+    for (;;) {
+        int ofs = 0;
+        int skip, run;
+
+        /* opaque pixels, or all the pixels of a colorkey encoding */
+        do {
+            READ_COUNTS(count_size);
+            ofs += skip;
+            if (run) {
+                SKIP_PIXELS(pixel_size);
+            } else if (!ofs) {
+                return pos;
+            }
+            if (ofs > w) {
+                return 0;
+            }
+        } while (ofs < w);
+
+        if (kind == RLE_KIND_ALPHA) {
+            /* translucent pixels, 32-bit aligned */
+            if (pixel_size == 2) {
+                pos += pos & 2;
+                if (pos > size) {
+                    return 0;
+                }
+            }
+            ofs = 0;
+            do {
+                READ_COUNTS(2);
+                ofs += skip;
+                SKIP_PIXELS(4);
+                if (ofs > w) {
+                    return 0;
+                }
+            } while (ofs < w);
+        }
+
+        if (++lines > h) {
+            return 0;
+        }
+    }
+
+#undef READ_COUNTS
+#undef SKIP_PIXELS
+}
+
+/* Whether the file's pixel format is one the encoders take */
+static SDL_bool
+RLEFileFormatValid(const SDL_PixelFormat * fmt, int kind)
+{
+    if (kind == RLE_KIND_ALPHA) {
+        /* RLEAlphaSurface() reads 8 bits of each channel */
+        return (fmt->BytesPerPixel == 4 && fmt->Amask &&
+                !fmt->Rloss && !fmt->Gloss && !fmt->Bloss && !fmt->Aloss) ? SDL_TRUE : SDL_FALSE;
+    }
+    /* Channels wider than 8 bits have a negative loss, which wraps */
+    return (fmt->BytesPerPixel >= 1 && fmt->BytesPerPixel <= 4 &&
+            fmt->Rloss <= 8 && fmt->Gloss <= 8 && fmt->Bloss <= 8 && fmt->Aloss <= 8) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Whether a saved destination format is exactly what RLEAlphaSurface()
+   writes for one of the formats it supports */
+static SDL_bool
+RLEDestFormatValid(const RLEDestFormat * r)
+{
+    RLEDestFormat expected;
+    SDL_PixelFormat *df;
+    SDL_bool valid = SDL_FALSE;
+    Uint32 format;
+
+    format = SDL_MasksToPixelFormatEnum(r->BytesPerPixel * 8, r->Rmask, r->Gmask, r->Bmask, r->Amask);
+    if (format == SDL_PIXELFORMAT_UNKNOWN) {
+        return SDL_FALSE;
+    }
+    df = SDL_AllocFormat(format);
+    if (df) {
+        if (df->BytesPerPixel == r->BytesPerPixel && RLEAlphaDestSupported(df)) {
+            SetRLEDestFormat(&expected, df);
+            valid = (SDL_memcmp(&expected, r, sizeof(expected)) == 0) ? SDL_TRUE : SDL_FALSE;
+        }
+        SDL_FreeFormat(df);
+    }
+    return valid;
+}
+
+int
+SDL_WriteRLESurface(SDL_Surface * surface, SDL_RWops * dst)
+{
+    SDL_Palette *palette = surface->format->palette;
+    int flags = surface->map->info.flags;
+    SDL_BlendMode blendMode;
+    int kind, ncolors, i;
+    size_t size;
+
+    if ((surface->flags & SDL_RLEACCEL) != SDL_RLEACCEL ||
+        !(flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY))) {
+        return SDL_SetError("Surface isn't RLE encoded, see SDL_PrepareSurfaceRLE()");
+    }
+
+    kind = (flags & SDL_COPY_RLE_ALPHAKEY) ? RLE_KIND_ALPHA : RLE_KIND_COLORKEY;
+    size = RLEEncodingSize(surface->map->data, (size_t)-1, surface->w, surface->h,
+                           kind, surface->format->BytesPerPixel);
+    if (!size || size > SDL_MAX_UINT32) {
+        return SDL_SetError("Couldn't determine the size of the RLE encoding");
+    }
+    ncolors = palette ? palette->ncolors : 0;
+    SDL_GetSurfaceBlendMode(surface, &blendMode);
+
+    SDL_ClearError();
+    SDL_WriteLE32(dst, RLE_FILE_MAGIC);
+    SDL_WriteLE32(dst, RLE_FILE_VERSION);
+    SDL_WriteLE32(dst, SDL_BYTEORDER);
+    SDL_WriteLE32(dst, surface->format->format);
+    SDL_WriteLE32(dst, surface->w);
+    SDL_WriteLE32(dst, surface->h);
+    SDL_WriteLE32(dst, kind);
+    SDL_WriteLE32(dst, (flags & SDL_COPY_COLORKEY) ? 1 : 0);
+    SDL_WriteLE32(dst, surface->map->info.colorkey);
+    SDL_WriteLE32(dst, blendMode);
+    SDL_WriteLE32(dst, ncolors);
+    for (i = 0; i < ncolors; ++i) {
+        SDL_WriteU8(dst, palette->colors[i].r);
+        SDL_WriteU8(dst, palette->colors[i].g);
+        SDL_WriteU8(dst, palette->colors[i].b);
+        SDL_WriteU8(dst, palette->colors[i].a);
+    }
+    SDL_WriteLE32(dst, (Uint32)size);
+    if (SDL_RWwrite(dst, surface->map->data, 1, size) != size) {
+        return SDL_Error(SDL_EFWRITE);
+    }
+    return (SDL_strcmp(SDL_GetError(), "") == 0) ? 0 : -1;
+}
+
+SDL_Surface *
+SDL_ReadRLESurface(SDL_RWops * src)
+{
+    SDL_Surface *surface = NULL;
+    SDL_Color *colors = NULL;
+    Uint8 *data = NULL;
+    Uint32 format, size;
+    int w, h, kind, has_colorkey, ncolors, i;
+    Uint32 colorkey;
+    SDL_BlendMode blendMode;
+    Sint64 maxsize;
+
+    if (SDL_ReadLE32(src) != RLE_FILE_MAGIC) {
+        SDL_SetError("File is not a serialized RLE surface");
+        return NULL;
+    }
+    if (SDL_ReadLE32(src) != RLE_FILE_VERSION) {
+        SDL_SetError("Unsupported RLE surface version");
+        return NULL;
+    }
+    if (SDL_ReadLE32(src) != SDL_BYTEORDER) {
+        SDL_SetError("RLE surface was saved with a different byte order");
+        return NULL;
+    }
+    format = SDL_ReadLE32(src);
+    w = (int)SDL_ReadLE32(src);
+    h = (int)SDL_ReadLE32(src);
+    kind = (int)SDL_ReadLE32(src);
+    has_colorkey = (int)SDL_ReadLE32(src);
+    colorkey = SDL_ReadLE32(src);
+    blendMode = (SDL_BlendMode)SDL_ReadLE32(src);
+    ncolors = (int)SDL_ReadLE32(src);
+
+    /* Only known formats, a made up layout can have masks that don't fit
+       the pixel and the blitters index bytes outside of it */
+    if (w <= 0 || h <= 0 || w > 65535 || h > 65535 ||
+        SDL_strcmp(SDL_GetPixelFormatName(format), "SDL_PIXELFORMAT_UNKNOWN") == 0 ||
+        SDL_ISPIXELFORMAT_FOURCC(format) || SDL_BITSPERPIXEL(format) < 8 ||
+        (kind != RLE_KIND_COLORKEY && kind != RLE_KIND_ALPHA) ||
+        (kind == RLE_KIND_ALPHA && SDL_BITSPERPIXEL(format) != 32) ||
+        ncolors < 0 || ncolors > 256) {
+        SDL_SetError("Corrupt RLE surface header");
+        return NULL;
+    }
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, format);
+    if (!surface) {
+        return NULL;
+    }
+    if (!RLEFileFormatValid(surface->format, kind)) {
+        SDL_SetError("Corrupt RLE surface header");
+        goto error;
+    }
+
+    if (ncolors) {
+        if (!surface->format->palette || ncolors > surface->format->palette->ncolors) {
+            SDL_SetError("Corrupt RLE surface palette");
+            goto error;
+        }
+        colors = (SDL_Color *) SDL_malloc(ncolors * sizeof(*colors));
+        if (!colors) {
+            SDL_OutOfMemory();
+            goto error;
+        }
+        for (i = 0; i < ncolors; ++i) {
+            colors[i].r = SDL_ReadU8(src);
+            colors[i].g = SDL_ReadU8(src);
+            colors[i].b = SDL_ReadU8(src);
+            colors[i].a = SDL_ReadU8(src);
+        }
+        SDL_SetPaletteColors(surface->format->palette, colors, 0, ncolors);
+        SDL_free(colors);
+    }
+
+    /* No valid encoding is larger than this, see the worst cases in the encoders */
+    size = SDL_ReadLE32(src);
+    maxsize = (Sint64)h * 8 * ((Sint64)w + 2) + 64;
+    if (size == 0 || size > maxsize) {
+        SDL_SetError("Corrupt RLE surface size");
+        goto error;
+    }
+    data = (Uint8 *) SDL_malloc(size);
+    if (!data) {
+        SDL_OutOfMemory();
+        goto error;
+    }
+    if (SDL_RWread(src, data, 1, size) != size) {
+        SDL_Error(SDL_EFREAD);
+        goto error;
+    }
+    if (RLEEncodingSize(data, size, w, h, kind, surface->format->BytesPerPixel) != size) {
+        SDL_SetError("Corrupt RLE surface encoding");
+        goto error;
+    }
+    if (kind == RLE_KIND_ALPHA && !RLEDestFormatValid((const RLEDestFormat *) data)) {
+        SDL_SetError("Corrupt RLE surface encoding");
+        goto error;
+    }
+
+    if (SDL_SetColorKey(surface, has_colorkey ? SDL_TRUE : SDL_FALSE, colorkey) < 0 ||
+        SDL_SetSurfaceBlendMode(surface, blendMode) < 0) {
+        goto error;
+    }
+    SDL_SetSurfaceRLE(surface, 1);
+
+    /* The encoding replaces the pixels, it is set up for blitting when the
+       surface is mapped, see SDL_KeepRLESurface() */
+    SDL_SIMDFree(surface->pixels);
+    surface->pixels = NULL;
+    surface->flags &= ~SDL_SIMD_ALIGNED;
+    surface->map->data = data;
+    surface->map->info.flags |= (kind == RLE_KIND_ALPHA) ? SDL_COPY_RLE_ALPHAKEY : SDL_COPY_RLE_COLORKEY;
+    surface->flags |= SDL_RLEACCEL;
+
+    return surface;
+
+error:
+    SDL_free(data);
+    SDL_FreeSurface(surface);
+    return NULL;
+}
+
 #endif /* SDL_HAVE_RLE */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -27,7 +27,11 @@
 /* Useful functions and variables from SDL_RLEaccel.c */
 
 extern int SDL_RLESurface(SDL_Surface * surface);
+extern SDL_bool SDL_CanRLESurface(SDL_Surface * surface);
 extern void SDL_UnRLESurface(SDL_Surface * surface, int recode);
+extern SDL_bool SDL_KeepRLESurface(SDL_Surface * surface);
+extern int SDL_WriteRLESurface(SDL_Surface * surface, SDL_RWops * dst);
+extern SDL_Surface *SDL_ReadRLESurface(SDL_RWops * src);
 
 #endif /* SDL_RLEaccel_c_h_ */
 
@@ -28,6 +28,264 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "../thread/SDL_systhread.h"
+
+#define SDL_BANDS_MAX_THREADS       64
+#define SDL_BANDS_DEFAULT_THRESHOLD (512 * 512)
+#define SDL_DEFAULT_FILL_STREAM_THRESHOLD (16 * 1024 * 1024)
+
+/* Worker threads for SDL_RunBands(), created on first use */
+typedef struct
+{
+    SDL_atomic_t initialized;
+    SDL_SpinLock init_lock;
+    SDL_mutex *lock;            /* held while a job runs, other callers run their jobs inline */
+    SDL_sem *work_sem;
+    SDL_sem *done_sem;
+    SDL_Thread *threads[SDL_BANDS_MAX_THREADS];
+    int num_threads;            /* not counting the calling thread */
+    SDL_bool shutdown;
+
+    /* Set from the hints */
+    int wanted_threads;
+    int threshold;
+    Sint64 fill_stream_threshold;
+
+    /* The job being run */
+    SDL_BandFunc func;
+    void *userdata;
+    int h;
+    int num_bands;
+    SDL_atomic_t next_band;
+} SDL_BandPool;
+
+static SDL_BandPool SDL_bands;
+
+static void SDLCALL
+SDL_BlitThreadsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    int threads = 1;
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "auto") == 0) {
+            threads = SDL_GetCPUCount();
+        } else {
+            threads = SDL_atoi(hint);
+        }
+    }
+    SDL_bands.wanted_threads = SDL_min(threads, SDL_BANDS_MAX_THREADS + 1);
+}
+
+static void SDLCALL
+SDL_BlitThreadThresholdChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    if (hint && *hint) {
+        SDL_bands.threshold = SDL_atoi(hint);
+    } else {
+        SDL_bands.threshold = SDL_BANDS_DEFAULT_THRESHOLD;
+    }
+}
+
+static void SDLCALL
+SDL_FillStreamThresholdChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    if (hint && *hint) {
+        SDL_bands.fill_stream_threshold = SDL_strtoll(hint, NULL, 10);
+    } else {
+        SDL_bands.fill_stream_threshold = SDL_DEFAULT_FILL_STREAM_THRESHOLD;
+    }
+}
+
+static void
+SDL_RunPendingBands(void)
+{
+    int i;
+
+    while ((i = SDL_AtomicAdd(&SDL_bands.next_band, 1)) < SDL_bands.num_bands) {
+        const int y1 = (SDL_bands.h * i) / SDL_bands.num_bands;
+        const int y2 = (SDL_bands.h * (i + 1)) / SDL_bands.num_bands;
+        SDL_bands.func(SDL_bands.userdata, y1, y2 - y1);
+    }
+}
+
+static int SDLCALL
+SDL_BandThread(void *userdata)
+{
+    for ( ; ; ) {
+        SDL_SemWait(SDL_bands.work_sem);
+        if (SDL_bands.shutdown) {
+            break;
+        }
+        SDL_RunPendingBands();
+        SDL_SemPost(SDL_bands.done_sem);
+    }
+    return 0;
+}
+
+static void
+SDL_StopBandThreads(void)
+{
+    int i;
+
+    SDL_bands.shutdown = SDL_TRUE;
+    for (i = 0; i < SDL_bands.num_threads; ++i) {
+        SDL_SemPost(SDL_bands.work_sem);
+    }
+    for (i = 0; i < SDL_bands.num_threads; ++i) {
+        SDL_WaitThread(SDL_bands.threads[i], NULL);
+        SDL_bands.threads[i] = NULL;
+    }
+    SDL_bands.num_threads = 0;
+    SDL_bands.shutdown = SDL_FALSE;
+}
+
+static void
+SDL_StartBandThreads(int num_threads)
+{
+    while (SDL_bands.num_threads < num_threads) {
+        char name[32];
+        SDL_Thread *thread;
+
+        SDL_snprintf(name, sizeof (name), "SDLBlit%d", SDL_bands.num_threads + 1);
+        thread = SDL_CreateThreadInternal(SDL_BandThread, name, 0, NULL);
+        if (!thread) {
+            /* Not fatal, the calling thread picks up the remaining bands */
+            break;
+        }
+        SDL_bands.threads[SDL_bands.num_threads++] = thread;
+    }
+}
+
+static void
+SDL_InitBands(void)
+{
+    SDL_AtomicLock(&SDL_bands.init_lock);
+    if (!SDL_AtomicGet(&SDL_bands.initialized)) {
+        SDL_bands.wanted_threads = 1;
+        SDL_bands.threshold = SDL_BANDS_DEFAULT_THRESHOLD;
+        SDL_bands.fill_stream_threshold = SDL_DEFAULT_FILL_STREAM_THRESHOLD;
+        SDL_bands.lock = SDL_CreateMutex();
+        SDL_bands.work_sem = SDL_CreateSemaphore(0);
+        SDL_bands.done_sem = SDL_CreateSemaphore(0);
+        if (SDL_bands.lock && SDL_bands.work_sem && SDL_bands.done_sem) {
+            SDL_AddHintCallback(SDL_HINT_BLIT_THREADS, SDL_BlitThreadsChanged, NULL);
+            SDL_AddHintCallback(SDL_HINT_BLIT_THREAD_THRESHOLD, SDL_BlitThreadThresholdChanged, NULL);
+            SDL_AddHintCallback(SDL_HINT_FILL_STREAM_THRESHOLD, SDL_FillStreamThresholdChanged, NULL);
+        }
+        SDL_AtomicSet(&SDL_bands.initialized, 1);
+    }
+    SDL_AtomicUnlock(&SDL_bands.init_lock);
+}
+
+void
+SDL_RunBands(SDL_BandFunc func, void *userdata, int w, int h)
+{
+    int num_bands, i;
+
+    if (!SDL_AtomicGet(&SDL_bands.initialized)) {
+        SDL_InitBands();
+    }
+
+    num_bands = SDL_min(SDL_bands.wanted_threads, h);
+    if (num_bands <= 1 || (Sint64)w * h < SDL_bands.threshold ||
+        SDL_TryLockMutex(SDL_bands.lock) != 0) {
+        func(userdata, 0, h);
+        return;
+    }
+
+    if (SDL_bands.num_threads != SDL_bands.wanted_threads - 1) {
+        SDL_StopBandThreads();
+        SDL_StartBandThreads(SDL_bands.wanted_threads - 1);
+    }
+
+    SDL_bands.func = func;
+    SDL_bands.userdata = userdata;
+    SDL_bands.h = h;
+    SDL_bands.num_bands = num_bands;
+    SDL_AtomicSet(&SDL_bands.next_band, 0);
+
+    /* The calling thread takes bands too, then waits for the others */
+    for (i = 0; i < SDL_bands.num_threads; ++i) {
+        SDL_SemPost(SDL_bands.work_sem);
+    }
+    SDL_RunPendingBands();
+    for (i = 0; i < SDL_bands.num_threads; ++i) {
+        SDL_SemWait(SDL_bands.done_sem);
+    }
+
+    SDL_UnlockMutex(SDL_bands.lock);
+}
+
+Sint64
+SDL_GetFillStreamThreshold(void)
+{
+    if (!SDL_AtomicGet(&SDL_bands.initialized)) {
+        SDL_InitBands();
+    }
+    return SDL_bands.fill_stream_threshold;
+}
+
+void
+SDL_QuitBands(void)
+{
+    if (!SDL_AtomicGet(&SDL_bands.initialized)) {
+        return;
+    }
+
+    if (SDL_bands.lock && SDL_bands.work_sem && SDL_bands.done_sem) {
+        SDL_DelHintCallback(SDL_HINT_BLIT_THREADS, SDL_BlitThreadsChanged, NULL);
+        SDL_DelHintCallback(SDL_HINT_BLIT_THREAD_THRESHOLD, SDL_BlitThreadThresholdChanged, NULL);
+        SDL_DelHintCallback(SDL_HINT_FILL_STREAM_THRESHOLD, SDL_FillStreamThresholdChanged, NULL);
+        SDL_StopBandThreads();
+    }
+    if (SDL_bands.lock) {
+        SDL_DestroyMutex(SDL_bands.lock);
+        SDL_bands.lock = NULL;
+    }
+    if (SDL_bands.work_sem) {
+        SDL_DestroySemaphore(SDL_bands.work_sem);
+        SDL_bands.work_sem = NULL;
+    }
+    if (SDL_bands.done_sem) {
+        SDL_DestroySemaphore(SDL_bands.done_sem);
+        SDL_bands.done_sem = NULL;
+    }
+    SDL_AtomicSet(&SDL_bands.initialized, 0);
+}
+
+/* The blit info of a band is a copy of the surface's, moved down y rows */
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+} SDL_BlitBandsData;
+
+static void
+SDL_BlitBand(void *userdata, int y, int h)
+{
+    const SDL_BlitBandsData *data = (const SDL_BlitBandsData *) userdata;
+    SDL_BlitInfo info = *data->info;
+
+    info.src += y * info.src_pitch;
+    info.dst += y * info.dst_pitch;
+    info.src_h = h;
+    info.dst_h = h;
+    data->blit(&info);
+}
+
+static SDL_bool
+SDL_SurfacesOverlap(const SDL_Surface * src, const SDL_Surface * dst)
+{
+    const Uint8 *src_start = (const Uint8 *) src->pixels;
+    const Uint8 *src_end = src_start + src->h * src->pitch;
+    const Uint8 *dst_start = (const Uint8 *) dst->pixels;
+    const Uint8 *dst_end = dst_start + dst->h * dst->pitch;
+
+    return (src_start < dst_end && dst_start < src_end) ? SDL_TRUE : SDL_FALSE;
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL
@@ -84,8 +342,18 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, split into bands if it's big. Scaled
+           blits step through the source rows, and blits within the same
+           pixels may read rows another band has already written. */
+        if (srcrect->w == dstrect->w && srcrect->h == dstrect->h &&
+            !SDL_SurfacesOverlap(src, dst)) {
+            SDL_BlitBandsData data;
+            data.blit = RunBlit;
+            data.info = info;
+            SDL_RunBands(SDL_BlitBand, &data, info->dst_w, info->dst_h);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -99,8 +367,6 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     return (okay ? 0 : -1);
 }
 
-#if SDL_HAVE_BLIT_AUTO
-
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -126,45 +392,60 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+int
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static int features = 0x7fffffff;
+    static int detected = 0x7fffffff;
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    int features = SDL_CPU_ANY;
 
     /* Get the available CPU features */
-    if (features == 0x7fffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
-
-        features = SDL_CPU_ANY;
-
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+    if (detected == 0x7fffffff) {
+        detected = SDL_CPU_ANY;
+        if (SDL_HasMMX()) {
+            detected |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            detected |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            detected |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            detected |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasAVX2()) {
+            detected |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            detected |= SDL_CPU_NEON;
+        }
+        if (SDL_HasAltiVec()) {
+            if (SDL_UseAltivecPrefetch()) {
+                detected |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                detected |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
 
+    /* Allow an override for testing, checked on every call so the
+       scalar and SIMD blitters can be compared in the same process */
+    if (override && *override) {
+        SDL_sscanf(override, "%u", &features);
+    } else {
+        features = detected;
+    }
+    return features;
+}
+
+#if SDL_HAVE_BLIT_AUTO
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int features,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
         if (src_format != entries[i].src_format) {
@@ -191,49 +472,21 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
 }
 #endif /* SDL_HAVE_BLIT_AUTO */
 
-/* Figure out which of many blit routines to set up on a surface */
-int
-SDL_CalculateBlit(SDL_Surface * surface)
+/* Pick the blit function for the surface's current mapping, this only looks
+   at the formats, the blit flags, map->identity and the CPU features */
+static SDL_BlitFunc
+SDL_ChooseBlit(SDL_Surface * surface, int features)
 {
     SDL_BlitFunc blit = NULL;
     SDL_BlitMap *map = surface->map;
     SDL_Surface *dst = map->dst;
 
-    /* We don't currently support blitting to < 8 bpp surfaces */
-    if (dst->format->BitsPerPixel < 8) {
-        SDL_InvalidateMap(map);
-        return SDL_SetError("Blit combination not supported");
-    }
-
-#if SDL_HAVE_RLE
-    /* Clean everything out to start */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
-    }
-#endif
-
-    map->blit = SDL_SoftBlit;
-    map->info.src_fmt = surface->format;
-    map->info.src_pitch = surface->pitch;
-    map->info.dst_fmt = dst->format;
-    map->info.dst_pitch = dst->pitch;
-
-#if SDL_HAVE_RLE
-    /* See if we can do RLE acceleration */
-    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
-        if (SDL_RLESurface(surface) == 0) {
-            return 0;
-        }
-    }
-#endif
-
     /* Choose a standard blit function */
     if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
         blit = SDL_BlitCopy;
     } else if (surface->format->Rloss > 8 || dst->format->Rloss > 8) {
         /* Greater than 8 bits per channel not supported yet */
-        SDL_InvalidateMap(map);
-        return SDL_SetError("Blit combination not supported");
+        return NULL;
     }
 #if SDL_HAVE_BLIT_0
     else if (surface->format->BitsPerPixel < 8 &&
@@ -248,7 +501,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
     }
 #endif
 #if SDL_HAVE_BLIT_A
-    else if (map->info.flags & SDL_COPY_BLEND) {
+    else if (map->info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED)) {
         blit = SDL_CalculateBlitA(surface);
     }
 #endif
@@ -263,7 +516,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
         Uint32 dst_format = dst->format->format;
 
         blit =
-            SDL_ChooseBlitFunc(src_format, dst_format, map->info.flags,
+            SDL_ChooseBlitFunc(src_format, dst_format, map->info.flags, features,
                                SDL_GeneratedBlitFuncTable);
     }
 #endif
@@ -282,10 +535,141 @@ SDL_CalculateBlit(SDL_Surface * surface)
             blit = SDL_Blit_Slow;
         }
     }
-    map->data = blit;
+    return blit;
+}
+
+/* The blit choices of all blit maps, so a source blitted to many new
+   destinations or remapped after palette changes doesn't search again */
+#define SDL_BLIT_CACHE_SIZE 256     /* must be a power of two */
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int flags;
+    int identity;
+    int features;
+    SDL_bool valid;
+    SDL_bool rle;               /* SDL_CanRLESurface(), if SDL_COPY_RLE_DESIRED is set */
+    SDL_BlitFunc blit;
+} SDL_BlitCacheEntry;
+
+static SDL_BlitCacheEntry SDL_blit_cache[SDL_BLIT_CACHE_SIZE];
+static SDL_SpinLock SDL_blit_cache_lock;
+static Uint64 SDL_blit_cache_hits;
+static Uint64 SDL_blit_cache_misses;
+
+static void
+SDL_LookupBlit(SDL_Surface * surface, SDL_BlitCacheEntry * result)
+{
+    SDL_BlitMap *map = surface->map;
+    SDL_BlitCacheEntry key;
+    SDL_BlitCacheEntry *entry;
+    Uint32 hash;
+
+    SDL_zero(key);
+    key.src_format = surface->format->format;
+    key.dst_format = map->dst->format->format;
+    key.flags = map->info.flags;
+    key.identity = map->identity;
+    key.features = SDL_GetBlitCPUFeatures();
+
+    hash = key.src_format;
+    hash = hash * 31 + key.dst_format;
+    hash = hash * 31 + (Uint32) key.flags;
+    hash = hash * 31 + (Uint32) key.identity;
+    hash = hash * 31 + (Uint32) key.features;
+    hash ^= (hash >> 16);
+    entry = &SDL_blit_cache[hash & (SDL_BLIT_CACHE_SIZE - 1)];
+
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    if (entry->valid &&
+        entry->src_format == key.src_format &&
+        entry->dst_format == key.dst_format &&
+        entry->flags == key.flags &&
+        entry->identity == key.identity &&
+        entry->features == key.features) {
+        *result = *entry;
+        ++SDL_blit_cache_hits;
+        SDL_AtomicUnlock(&SDL_blit_cache_lock);
+        return;
+    }
+    ++SDL_blit_cache_misses;
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+
+    key.valid = SDL_TRUE;
+#if SDL_HAVE_RLE
+    if (key.flags & SDL_COPY_RLE_DESIRED) {
+        key.rle = SDL_CanRLESurface(surface);
+    }
+#endif
+    key.blit = SDL_ChooseBlit(surface, key.features);
+
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    *entry = key;
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+
+    *result = key;
+}
+
+void
+SDL_GetBlitCacheStats(Uint64 *hits, Uint64 *misses)
+{
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    if (hits) {
+        *hits = SDL_blit_cache_hits;
+    }
+    if (misses) {
+        *misses = SDL_blit_cache_misses;
+    }
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+}
+
+/* Figure out which of many blit routines to set up on a surface */
+int
+SDL_CalculateBlit(SDL_Surface * surface)
+{
+    SDL_BlitMap *map = surface->map;
+    SDL_Surface *dst = map->dst;
+    SDL_BlitCacheEntry choice;
+
+    /* We don't currently support blitting to < 8 bpp surfaces */
+    if (dst->format->BitsPerPixel < 8) {
+        SDL_InvalidateMap(map);
+        return SDL_SetError("Blit combination not supported");
+    }
+
+    map->blit = SDL_SoftBlit;
+    map->info.src_fmt = surface->format;
+    map->info.src_pitch = surface->pitch;
+    map->info.dst_fmt = dst->format;
+    map->info.dst_pitch = dst->pitch;
+
+#if SDL_HAVE_RLE
+    /* Keep an encoding that still fits, otherwise clean everything out to start */
+    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+        if (SDL_KeepRLESurface(surface)) {
+            return 0;
+        }
+        SDL_UnRLESurface(surface, 1);
+    }
+#endif
+
+    SDL_LookupBlit(surface, &choice);
+
+#if SDL_HAVE_RLE
+    /* See if we can do RLE acceleration */
+    if (choice.rle) {
+        if (SDL_RLESurface(surface) == 0) {
+            return 0;
+        }
+    }
+#endif
+
+    map->data = choice.blit;
 
     /* Make sure we have a blit function */
-    if (blit == NULL) {
+    if (choice.blit == NULL) {
         SDL_InvalidateMap(map);
         return SDL_SetError("Blit combination not supported");
     }
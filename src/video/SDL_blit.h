@@ -39,6 +39,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_COPY_MUL                0x00000080
 #define SDL_COPY_COLORKEY           0x00000100
 #define SDL_COPY_NEAREST            0x00000200
+#define SDL_COPY_BLEND_PREMULTIPLIED 0x00000400
 #define SDL_COPY_RLE_DESIRED        0x00001000
 #define SDL_COPY_RLE_COLORKEY       0x00002000
 #define SDL_COPY_RLE_ALPHAKEY       0x00004000
@@ -52,6 +53,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
+#define SDL_CPU_NEON                0x00000080
 
 typedef struct
 {
@@ -96,10 +99,26 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* the source palette and its size when a palette --> bitfield table
+       was built, it can only be filled again in place for the same ones */
+    SDL_Palette *table_palette;
+    int table_ncolors;
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+/* The SDL_CPU_* flags the blitters may use, overridden by the
+   SDL_BLIT_CPU_FEATURES environment variable for testing */
+extern int SDL_GetBlitCPUFeatures(void);
+
+/* Calls func for horizontal bands covering the h rows of a w pixel wide
+   operation, on several threads when it's big enough, see SDL_HINT_BLIT_THREADS */
+typedef void (*SDL_BandFunc)(void *userdata, int y, int h);
+extern void SDL_RunBands(SDL_BandFunc func, void *userdata, int w, int h);
+/* Bytes a fill needs to use non-temporal stores, see SDL_HINT_FILL_STREAM_THRESHOLD */
+extern Sint64 SDL_GetFillStreamThreshold(void);
+extern void SDL_QuitBands(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -107,6 +126,12 @@ extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
 
+/* Functions found in SDL_surface.c, SDL_BlitScaled() with bilinear filtering if linear is set */
+extern int SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear);
+extern int SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear);
+
 /*
  * Useful macros for blitting routines
  */
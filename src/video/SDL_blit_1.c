@@ -520,11 +520,420 @@ static const SDL_BlitFunc one_blitkey[] = {
     (SDL_BlitFunc) NULL, Blit1to1Key, Blit1to2Key, Blit1to3Key, Blit1to4Key
 };
 
+/* Vectorized lookups for 2 and 4 byte destinations. Palettes of up to 16
+   colors are split into a 16 byte table per destination byte, so a byte
+   shuffle looks up a whole vector of pixels, and the bytes are interleaved
+   back into pixels. Larger palettes are looked up with gathers for 4 byte
+   destinations where the CPU has them. Like the scalar blitters, pixels
+   past the end of the palette have no defined result.
+ */
+#if SDL_AVX2_INTRINSICS || (defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_PALETTE_LOOKUP_BLITTERS 1
+
+static void
+GetPalettePlanes(const SDL_BlitInfo * info, Uint8 planes[4][16])
+{
+    const int bpp = (info->dst_fmt->BytesPerPixel == 4) ? 4 : 2;
+    const int ncolors = info->src_fmt->palette->ncolors;
+    int i, j;
+
+    SDL_memset(planes, 0, 4 * 16);
+    for (i = 0; i < ncolors && i < 16; ++i) {
+        for (j = 0; j < bpp; ++j) {
+            planes[j][i] = info->table[i * bpp + j];
+        }
+    }
+}
+
+/* The pixels at the end of a row that don't fill a vector */
+static void
+Blit1toNRow(const Uint8 * src, Uint8 * dst, const Uint8 * map, int bpp,
+            SDL_bool keyed, Uint32 ckey, int width)
+{
+    while (width--) {
+        if (!keyed || *src != ckey) {
+            if (bpp == 4) {
+                *(Uint32 *) dst = ((const Uint32 *) map)[*src];
+            } else {
+                *(Uint16 *) dst = ((const Uint16 *) map)[*src];
+            }
+        }
+        ++src;
+        dst += bpp;
+    }
+}
+
+/* The scalar blitters, for palettes the vectorized code can't handle */
+static void
+Blit1toNScalar(SDL_BlitInfo * info)
+{
+    if (info->flags & SDL_COPY_COLORKEY) {
+        one_blitkey[info->dst_fmt->BytesPerPixel](info);
+    } else {
+        one_blit[info->dst_fmt->BytesPerPixel](info);
+    }
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+/* Interleaves byte planes of 16 pixels into bpp vectors of pixels */
+static SDL_TARGETING("sse4.1") void
+InterleavePlanesSSE41(const __m128i planes[4], int bpp, __m128i pixels[4])
+{
+    const __m128i lo = _mm_unpacklo_epi8(planes[0], planes[1]);
+    const __m128i hi = _mm_unpackhi_epi8(planes[0], planes[1]);
+
+    if (bpp == 2) {
+        pixels[0] = lo;
+        pixels[1] = hi;
+        pixels[2] = pixels[3] = _mm_setzero_si128();
+    } else {
+        const __m128i lo23 = _mm_unpacklo_epi8(planes[2], planes[3]);
+        const __m128i hi23 = _mm_unpackhi_epi8(planes[2], planes[3]);
+        pixels[0] = _mm_unpacklo_epi16(lo, lo23);
+        pixels[1] = _mm_unpackhi_epi16(lo, lo23);
+        pixels[2] = _mm_unpacklo_epi16(hi, hi23);
+        pixels[3] = _mm_unpackhi_epi16(hi, hi23);
+    }
+}
+
+/* Keeps the destination pixels where the mask is set. The vectors are
+   written out one by one, as a loop over them turns into a memcpy() */
+static SDL_TARGETING("sse4.1") void
+BlendPixelsSSE41(const Uint8 * d, int bpp, __m128i pixels[4], const __m128i masks[4])
+{
+    pixels[0] = _mm_blendv_epi8(pixels[0], _mm_loadu_si128((const __m128i *) d), masks[0]);
+    pixels[1] = _mm_blendv_epi8(pixels[1], _mm_loadu_si128((const __m128i *) (d + 16)), masks[1]);
+    if (bpp == 4) {
+        pixels[2] = _mm_blendv_epi8(pixels[2], _mm_loadu_si128((const __m128i *) (d + 32)), masks[2]);
+        pixels[3] = _mm_blendv_epi8(pixels[3], _mm_loadu_si128((const __m128i *) (d + 48)), masks[3]);
+    }
+}
+
+static SDL_TARGETING("sse4.1") void
+StorePixelsSSE41(Uint8 * d, int bpp, const __m128i pixels[4])
+{
+    _mm_storeu_si128((__m128i *) d, pixels[0]);
+    _mm_storeu_si128((__m128i *) (d + 16), pixels[1]);
+    if (bpp == 4) {
+        _mm_storeu_si128((__m128i *) (d + 32), pixels[2]);
+        _mm_storeu_si128((__m128i *) (d + 48), pixels[3]);
+    }
+}
+
+static SDL_TARGETING("sse4.1") void
+Blit1toNSSE41(SDL_BlitInfo * info)
+{
+    const int bpp = (info->dst_fmt->BytesPerPixel == 4) ? 4 : 2;
+    const SDL_bool keyed = (info->flags & SDL_COPY_COLORKEY) ? SDL_TRUE : SDL_FALSE;
+    const Uint32 ckey = info->colorkey;
+    const __m128i vkey = _mm_set1_epi8((char) ckey);
+    const __m128i vkeyed = _mm_set1_epi8((keyed && ckey <= 0xFF) ? -1 : 0);
+    Uint8 planes[4][16];
+    __m128i vplanes[4];
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int i;
+
+    if (info->src_fmt->palette->ncolors > 16) {
+        Blit1toNScalar(info);
+        return;
+    }
+    GetPalettePlanes(info, planes);
+    for (i = 0; i < 4; ++i) {
+        vplanes[i] = _mm_loadu_si128((const __m128i *) planes[i]);
+    }
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 16) {
+            const __m128i index = _mm_loadu_si128((const __m128i *) s);
+            const __m128i keys = _mm_and_si128(_mm_cmpeq_epi8(index, vkey), vkeyed);
+            const int keymask = _mm_movemask_epi8(keys);
+            if (keymask != 0xFFFF) {
+                __m128i bytes[4], pixels[4], masks[4];
+                for (i = 0; i < bpp; ++i) {
+                    bytes[i] = _mm_shuffle_epi8(vplanes[i], index);
+                }
+                InterleavePlanesSSE41(bytes, bpp, pixels);
+                if (keymask) {
+                    bytes[0] = bytes[1] = bytes[2] = bytes[3] = keys;
+                    InterleavePlanesSSE41(bytes, bpp, masks);
+                    BlendPixelsSSE41(d, bpp, pixels, masks);
+                }
+                StorePixelsSSE41(d, bpp, pixels);
+            }
+            s += 16;
+            d += 16 * bpp;
+            n -= 16;
+        }
+        Blit1toNRow(s, d, info->table, bpp, keyed, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+/* As InterleavePlanesSSE41() for 32 pixels, _mm256_unpack*() stay within
+   128-bit lanes so the halves are put back in order afterwards */
+static SDL_TARGETING("avx2") void
+InterleavePlanesAVX2(const __m256i planes[4], int bpp, __m256i pixels[4])
+{
+    const __m256i lo = _mm256_unpacklo_epi8(planes[0], planes[1]);
+    const __m256i hi = _mm256_unpackhi_epi8(planes[0], planes[1]);
+
+    if (bpp == 2) {
+        pixels[0] = _mm256_permute2x128_si256(lo, hi, 0x20);
+        pixels[1] = _mm256_permute2x128_si256(lo, hi, 0x31);
+        pixels[2] = pixels[3] = _mm256_setzero_si256();
+    } else {
+        const __m256i lo23 = _mm256_unpacklo_epi8(planes[2], planes[3]);
+        const __m256i hi23 = _mm256_unpackhi_epi8(planes[2], planes[3]);
+        const __m256i p0 = _mm256_unpacklo_epi16(lo, lo23);
+        const __m256i p1 = _mm256_unpackhi_epi16(lo, lo23);
+        const __m256i p2 = _mm256_unpacklo_epi16(hi, hi23);
+        const __m256i p3 = _mm256_unpackhi_epi16(hi, hi23);
+        pixels[0] = _mm256_permute2x128_si256(p0, p1, 0x20);
+        pixels[1] = _mm256_permute2x128_si256(p2, p3, 0x20);
+        pixels[2] = _mm256_permute2x128_si256(p0, p1, 0x31);
+        pixels[3] = _mm256_permute2x128_si256(p2, p3, 0x31);
+    }
+}
+
+static SDL_TARGETING("avx2") void
+BlendPixelsAVX2(const Uint8 * d, int bpp, __m256i pixels[4], const __m256i masks[4])
+{
+    pixels[0] = _mm256_blendv_epi8(pixels[0], _mm256_loadu_si256((const __m256i *) d), masks[0]);
+    pixels[1] = _mm256_blendv_epi8(pixels[1], _mm256_loadu_si256((const __m256i *) (d + 32)), masks[1]);
+    if (bpp == 4) {
+        pixels[2] = _mm256_blendv_epi8(pixels[2], _mm256_loadu_si256((const __m256i *) (d + 64)), masks[2]);
+        pixels[3] = _mm256_blendv_epi8(pixels[3], _mm256_loadu_si256((const __m256i *) (d + 96)), masks[3]);
+    }
+}
+
+static SDL_TARGETING("avx2") void
+StorePixelsAVX2(Uint8 * d, int bpp, const __m256i pixels[4])
+{
+    _mm256_storeu_si256((__m256i *) d, pixels[0]);
+    _mm256_storeu_si256((__m256i *) (d + 32), pixels[1]);
+    if (bpp == 4) {
+        _mm256_storeu_si256((__m256i *) (d + 64), pixels[2]);
+        _mm256_storeu_si256((__m256i *) (d + 96), pixels[3]);
+    }
+}
+
+static SDL_TARGETING("avx2") void
+Blit1toNShuffleAVX2(SDL_BlitInfo * info)
+{
+    const int bpp = (info->dst_fmt->BytesPerPixel == 4) ? 4 : 2;
+    const SDL_bool keyed = (info->flags & SDL_COPY_COLORKEY) ? SDL_TRUE : SDL_FALSE;
+    const Uint32 ckey = info->colorkey;
+    const __m256i vkey = _mm256_set1_epi8((char) ckey);
+    const __m256i vkeyed = _mm256_set1_epi8((keyed && ckey <= 0xFF) ? -1 : 0);
+    Uint8 planes[4][16];
+    __m256i vplanes[4];
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int i;
+
+    GetPalettePlanes(info, planes);
+    for (i = 0; i < 4; ++i) {
+        vplanes[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) planes[i]));
+    }
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 32) {
+            const __m256i index = _mm256_loadu_si256((const __m256i *) s);
+            const __m256i keys = _mm256_and_si256(_mm256_cmpeq_epi8(index, vkey), vkeyed);
+            const int keymask = _mm256_movemask_epi8(keys);
+            if (keymask != -1) {
+                __m256i bytes[4], pixels[4], masks[4];
+                for (i = 0; i < bpp; ++i) {
+                    bytes[i] = _mm256_shuffle_epi8(vplanes[i], index);
+                }
+                InterleavePlanesAVX2(bytes, bpp, pixels);
+                if (keymask) {
+                    bytes[0] = bytes[1] = bytes[2] = bytes[3] = keys;
+                    InterleavePlanesAVX2(bytes, bpp, masks);
+                    BlendPixelsAVX2(d, bpp, pixels, masks);
+                }
+                StorePixelsAVX2(d, bpp, pixels);
+            }
+            s += 32;
+            d += 32 * bpp;
+            n -= 32;
+        }
+        Blit1toNRow(s, d, info->table, bpp, keyed, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+/* Gathers are only worth it for 32-bit entries */
+static SDL_TARGETING("avx2") void
+Blit1to4GatherAVX2(SDL_BlitInfo * info)
+{
+    const SDL_bool keyed = (info->flags & SDL_COPY_COLORKEY) ? SDL_TRUE : SDL_FALSE;
+    const Uint32 ckey = info->colorkey;
+    const int *map = (const int *) info->table;
+    const __m256i vkey = _mm256_set1_epi32((int) ckey);
+    const __m256i vkeyed = _mm256_set1_epi32(keyed ? -1 : 0);
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) s));
+            const __m256i keys = _mm256_and_si256(_mm256_cmpeq_epi32(index, vkey), vkeyed);
+            const int keymask = _mm256_movemask_epi8(keys);
+            if (keymask != -1) {
+                __m256i pixels = _mm256_i32gather_epi32(map, index, 4);
+                if (keymask) {
+                    pixels = _mm256_blendv_epi8(pixels, _mm256_loadu_si256((const __m256i *) d), keys);
+                }
+                _mm256_storeu_si256((__m256i *) d, pixels);
+            }
+            s += 8;
+            d += 32;
+            n -= 8;
+        }
+        Blit1toNRow(s, d, info->table, 4, keyed, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static void
+Blit1toNAVX2(SDL_BlitInfo * info)
+{
+    if (info->src_fmt->palette->ncolors <= 16) {
+        Blit1toNShuffleAVX2(info);
+    } else if (info->dst_fmt->BytesPerPixel == 4) {
+        Blit1to4GatherAVX2(info);
+    } else {
+        Blit1toNScalar(info);
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+/* vtbl2 looks up 8 pixels in each plane, and vst2/vst4 interleave them */
+static void
+Blit1toNNEON(SDL_BlitInfo * info)
+{
+    const int bpp = (info->dst_fmt->BytesPerPixel == 4) ? 4 : 2;
+    const SDL_bool keyed = (info->flags & SDL_COPY_COLORKEY) ? SDL_TRUE : SDL_FALSE;
+    const Uint32 ckey = info->colorkey;
+    const uint8x8_t vkey = vdup_n_u8((Uint8) ckey);
+    const uint8x8_t vkeyed = vdup_n_u8((keyed && ckey <= 0xFF) ? 0xFF : 0);
+    Uint8 planes[4][16];
+    uint8x8x2_t vplanes[4];
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int i;
+
+    if (info->src_fmt->palette->ncolors > 16) {
+        Blit1toNScalar(info);
+        return;
+    }
+    GetPalettePlanes(info, planes);
+    for (i = 0; i < 4; ++i) {
+        vplanes[i].val[0] = vld1_u8(planes[i]);
+        vplanes[i].val[1] = vld1_u8(planes[i] + 8);
+    }
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const uint8x8_t index = vld1_u8(s);
+            const uint8x8_t keys = vand_u8(vceq_u8(index, vkey), vkeyed);
+            const uint64_t keymask = vget_lane_u64(vreinterpret_u64_u8(keys), 0);
+            if (keymask != ~(uint64_t) 0) {
+                if (bpp == 4) {
+                    uint8x8x4_t pixels;
+                    for (i = 0; i < 4; ++i) {
+                        pixels.val[i] = vtbl2_u8(vplanes[i], index);
+                    }
+                    if (keymask) {
+                        const uint8x8x4_t prev = vld4_u8(d);
+                        for (i = 0; i < 4; ++i) {
+                            pixels.val[i] = vbsl_u8(keys, prev.val[i], pixels.val[i]);
+                        }
+                    }
+                    vst4_u8(d, pixels);
+                } else {
+                    uint8x8x2_t pixels;
+                    for (i = 0; i < 2; ++i) {
+                        pixels.val[i] = vtbl2_u8(vplanes[i], index);
+                    }
+                    if (keymask) {
+                        const uint8x8x2_t prev = vld2_u8(d);
+                        for (i = 0; i < 2; ++i) {
+                            pixels.val[i] = vbsl_u8(keys, prev.val[i], pixels.val[i]);
+                        }
+                    }
+                    vst2_u8(d, pixels);
+                }
+            }
+            s += 8;
+            d += 8 * bpp;
+            n -= 8;
+        }
+        Blit1toNRow(s, d, info->table, bpp, keyed, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif
+
+/* Returns the fastest lookup blitter the CPU supports, for 2 and 4 byte destinations */
+static SDL_BlitFunc
+GetPaletteLookupBlitter(int dstbpp)
+{
+#if HAVE_PALETTE_LOOKUP_BLITTERS
+    if (dstbpp != 2 && dstbpp != 4) {
+        return NULL;
+    }
+#if SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return Blit1toNAVX2;
+    }
+    if (SDL_HasSSE41()) {
+        return Blit1toNSSE41;
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_HasNEON()) {
+        return Blit1toNNEON;
+    }
+#endif
+#endif /* HAVE_PALETTE_LOOKUP_BLITTERS */
+    return NULL;
+}
+
 SDL_BlitFunc
 SDL_CalculateBlit1(SDL_Surface * surface)
 {
     int which;
     SDL_PixelFormat *dstfmt;
+    SDL_BlitFunc blitfun;
 
     dstfmt = surface->map->dst->format;
     if (dstfmt->BitsPerPixel < 8) {
@@ -534,10 +943,12 @@ SDL_CalculateBlit1(SDL_Surface * surface)
     }
     switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
     case 0:
-        return one_blit[which];
+        blitfun = GetPaletteLookupBlitter(which);
+        return blitfun ? blitfun : one_blit[which];
 
     case SDL_COPY_COLORKEY:
-        return one_blitkey[which];
+        blitfun = GetPaletteLookupBlitter(which);
+        return blitfun ? blitfun : one_blitkey[which];
 
     case SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
         /* Supporting 8bpp->8bpp alpha is doable but requires lots of
@@ -1331,6 +1331,244 @@ BlitNtoNPixelAlpha(SDL_BlitInfo * info)
 }
 
 
+/* Premultiplied alpha blending of 8888 pixels onto the same RGB layout,
+   dst = src + dst * (255 - srcA) / 255 per channel, saturating since the
+   source color isn't guaranteed to stay below its alpha. The division
+   uses (t + 1 + (t >> 8)) >> 8, which is exact for the products here, so
+   every path matches SDL_Blit_Slow(). Destinations without alpha get a
+   zero in their unused byte, like the other blitters leave it.
+ */
+#define PREMULTIPLIED_DIV255(t) (((t) + 1 + ((t) >> 8)) >> 8)
+
+static void
+BlitPremultipliedRow(const Uint32 * src, Uint32 * dst, int width,
+                     int Ashift, Uint32 dstmask)
+{
+    while (width--) {
+        const Uint32 s = *src;
+        const Uint32 inva = 255 - ((s >> Ashift) & 0xFF);
+
+        if (inva == 0) {
+            *dst = s & dstmask;
+        } else if (s) {
+            const Uint32 d = *dst;
+            Uint32 result = 0;
+            int shift;
+
+            for (shift = 0; shift < 32; shift += 8) {
+                const Uint32 t = ((d >> shift) & 0xFF) * inva;
+                Uint32 c = ((s >> shift) & 0xFF) + PREMULTIPLIED_DIV255(t);
+                if (c > 255) {
+                    c = 255;
+                }
+                result |= c << shift;
+            }
+            *dst = result & dstmask;
+        }
+        ++src;
+        ++dst;
+    }
+}
+
+static Uint32
+GetPremultipliedDstMask(const SDL_BlitInfo * info)
+{
+    const SDL_PixelFormat *df = info->dst_fmt;
+
+    return df->Amask ? 0xFFFFFFFF : (df->Rmask | df->Gmask | df->Bmask);
+}
+
+static void
+BlitRGBtoRGBPremultipliedPixelAlpha(SDL_BlitInfo * info)
+{
+    const int Ashift = info->src_fmt->Ashift;
+    const Uint32 dstmask = GetPremultipliedDstMask(info);
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        BlitPremultipliedRow((const Uint32 *) src, (Uint32 *) dst,
+                             info->dst_w, Ashift, dstmask);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_INTRINSICS
+/* The vectorized versions skip fully transparent vectors and copy fully
+   opaque ones, and otherwise widen to 16 bits with the inverted alpha
+   broadcast to every channel by a byte shuffle */
+static SDL_TARGETING("sse4.1") __m128i
+BlendPremultipliedSSE41(__m128i s, __m128i d, __m128i alphalo, __m128i alphahi)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i invlo = _mm_xor_si128(_mm_shuffle_epi8(s, alphalo), ff);
+    const __m128i invhi = _mm_xor_si128(_mm_shuffle_epi8(s, alphahi), ff);
+    __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), invlo);
+    __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), invhi);
+
+    lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+    return _mm_adds_epu8(s, _mm_packus_epi16(lo, hi));
+}
+
+static SDL_TARGETING("sse4.1") void
+BlitRGBtoRGBPremultipliedPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    const int Ashift = info->src_fmt->Ashift;
+    const char a = (char) (Ashift / 8);
+    const Uint32 dstmask = GetPremultipliedDstMask(info);
+    const __m128i vdstmask = _mm_set1_epi32((int) dstmask);
+    const __m128i valpha = _mm_set1_epi32((int) info->src_fmt->Amask);
+    const __m128i alphalo = _mm_setr_epi8(a, -1, a, -1, a, -1, a, -1,
+                                          a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1);
+    const __m128i alphahi = _mm_setr_epi8(a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1,
+                                          a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1);
+    const int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int n = width;
+
+        for (; n >= 4; n -= 4, s += 4, d += 4) {
+            const __m128i vs = _mm_loadu_si128((const __m128i *) s);
+
+            if (_mm_testz_si128(vs, vs)) {
+                continue;
+            }
+            if (_mm_testc_si128(vs, valpha)) {
+                _mm_storeu_si128((__m128i *) d, _mm_and_si128(vs, vdstmask));
+            } else {
+                const __m128i vd = _mm_loadu_si128((const __m128i *) d);
+                _mm_storeu_si128((__m128i *) d,
+                    _mm_and_si128(BlendPremultipliedSSE41(vs, vd, alphalo, alphahi), vdstmask));
+            }
+        }
+        BlitPremultipliedRow(s, d, n, Ashift, dstmask);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static SDL_TARGETING("avx2") __m256i
+BlendPremultipliedAVX2(__m256i s, __m256i d, __m256i alphalo, __m256i alphahi)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i ff = _mm256_set1_epi16(0xFF);
+    const __m256i invlo = _mm256_xor_si256(_mm256_shuffle_epi8(s, alphalo), ff);
+    const __m256i invhi = _mm256_xor_si256(_mm256_shuffle_epi8(s, alphahi), ff);
+    __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), invlo);
+    __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), invhi);
+
+    lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, one), _mm256_srli_epi16(lo, 8)), 8);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, one), _mm256_srli_epi16(hi, 8)), 8);
+    return _mm256_adds_epu8(s, _mm256_packus_epi16(lo, hi));
+}
+
+static SDL_TARGETING("avx2") void
+BlitRGBtoRGBPremultipliedPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    const int Ashift = info->src_fmt->Ashift;
+    const char a = (char) (Ashift / 8);
+    const Uint32 dstmask = GetPremultipliedDstMask(info);
+    const __m256i vdstmask = _mm256_set1_epi32((int) dstmask);
+    const __m256i valpha = _mm256_set1_epi32((int) info->src_fmt->Amask);
+    const __m256i alphalo = _mm256_setr_epi8(a, -1, a, -1, a, -1, a, -1,
+                                             a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1,
+                                             a, -1, a, -1, a, -1, a, -1,
+                                             a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1);
+    const __m256i alphahi = _mm256_setr_epi8(a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1,
+                                             a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1,
+                                             a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1,
+                                             a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1);
+    const int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int n = width;
+
+        for (; n >= 8; n -= 8, s += 8, d += 8) {
+            const __m256i vs = _mm256_loadu_si256((const __m256i *) s);
+
+            if (_mm256_testz_si256(vs, vs)) {
+                continue;
+            }
+            if (_mm256_testc_si256(vs, valpha)) {
+                _mm256_storeu_si256((__m256i *) d, _mm256_and_si256(vs, vdstmask));
+            } else {
+                const __m256i vd = _mm256_loadu_si256((const __m256i *) d);
+                _mm256_storeu_si256((__m256i *) d,
+                    _mm256_and_si256(BlendPremultipliedAVX2(vs, vd, alphalo, alphahi), vdstmask));
+            }
+        }
+        BlitPremultipliedRow(s, d, n, Ashift, dstmask);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+static uint8x8_t
+BlendPremultipliedChannelNEON(uint8x8_t s, uint8x8_t d, uint8x8_t inva)
+{
+    const uint16x8_t t = vmull_u8(d, inva);
+    const uint16x8_t q = vshrq_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+
+    return vqadd_u8(s, vmovn_u16(q));
+}
+
+static void
+BlitRGBtoRGBPremultipliedPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    const int Ashift = info->src_fmt->Ashift;
+    const int a = Ashift / 8;
+    const SDL_bool dstalpha = info->dst_fmt->Amask ? SDL_TRUE : SDL_FALSE;
+    const Uint32 dstmask = GetPremultipliedDstMask(info);
+    const int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *) src;
+        Uint32 *d = (Uint32 *) dst;
+        int n = width;
+
+        for (; n >= 8; n -= 8, s += 8, d += 8) {
+            const uint8x8x4_t vs = vld4_u8((const uint8_t *) s);
+            const uint8x8x4_t vd = vld4_u8((const uint8_t *) d);
+            const uint8x8_t inva = vmvn_u8(vs.val[a]);
+            uint8x8x4_t out;
+
+            out.val[0] = BlendPremultipliedChannelNEON(vs.val[0], vd.val[0], inva);
+            out.val[1] = BlendPremultipliedChannelNEON(vs.val[1], vd.val[1], inva);
+            out.val[2] = BlendPremultipliedChannelNEON(vs.val[2], vd.val[2], inva);
+            out.val[3] = BlendPremultipliedChannelNEON(vs.val[3], vd.val[3], inva);
+            if (!dstalpha) {
+                out.val[a] = vdup_n_u8(0);
+            }
+            vst4_u8((uint8_t *) d, out);
+        }
+        BlitPremultipliedRow(s, d, n, Ashift, dstmask);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif
+
 SDL_BlitFunc
 SDL_CalculateBlitA(SDL_Surface * surface)
 {
@@ -1471,6 +1709,34 @@ SDL_CalculateBlitA(SDL_Surface * surface)
         }
         break;
 
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        /* Byte aligned 8888 pixels with the same color layout, anything
+           else goes through the slow blitter */
+        if (sf->BytesPerPixel == 4 && df->BytesPerPixel == 4 &&
+            sf->Amask && sf->Rloss == 0 && sf->Gloss == 0 &&
+            sf->Bloss == 0 && sf->Aloss == 0 &&
+            sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 &&
+            sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 &&
+            sf->Rmask == df->Rmask && sf->Gmask == df->Gmask &&
+            sf->Bmask == df->Bmask &&
+            (df->Amask == sf->Amask || df->Amask == 0)) {
+#if SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2()) {
+                return BlitRGBtoRGBPremultipliedPixelAlphaAVX2;
+            }
+            if (SDL_HasSSE41()) {
+                return BlitRGBtoRGBPremultipliedPixelAlphaSSE41;
+            }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+            if (SDL_HasNEON()) {
+                return BlitRGBtoRGBPremultipliedPixelAlphaNEON;
+            }
+#endif
+            return BlitRGBtoRGBPremultipliedPixelAlpha;
+        }
+        break;
+
     case SDL_COPY_COLORKEY | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
         if (sf->Amask == 0) {
             if (df->BytesPerPixel == 1) {
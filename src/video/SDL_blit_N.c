@@ -3220,6 +3220,620 @@ Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo * info)
     }
 }
 
+/* Byte shuffle blitters: between 3 and 4 byte formats where every channel is
+   a whole byte, each destination byte is a source byte, zero for an unused
+   byte, or the alpha value when the source has no alpha. The table is in
+   memory order, so the same code works for either byte order.
+ */
+#if SDL_AVX2_INTRINSICS || (defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_BYTE_SHUFFLE_BLITTERS 1
+
+#define SHUFFLE_ZERO    0x80
+#define SHUFFLE_ALPHA   0x81
+
+static SDL_bool
+IsByteShuffleFormat(const SDL_PixelFormat * fmt)
+{
+    if (fmt->BytesPerPixel != 3 && fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    if (fmt->Rloss || fmt->Gloss || fmt->Bloss || (fmt->Amask && fmt->Aloss)) {
+        return SDL_FALSE;
+    }
+    if ((fmt->Rshift | fmt->Gshift | fmt->Bshift | fmt->Ashift) & 7) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static int
+GetByteIndex(const SDL_PixelFormat * fmt, int shift)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return shift / 8;
+#else
+    return fmt->BytesPerPixel - 1 - shift / 8;
+#endif
+}
+
+static void
+GetByteShuffle(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt, Uint8 shuffle[4])
+{
+    shuffle[0] = shuffle[1] = shuffle[2] = shuffle[3] = SHUFFLE_ZERO;
+    shuffle[GetByteIndex(dstfmt, dstfmt->Rshift)] = GetByteIndex(srcfmt, srcfmt->Rshift);
+    shuffle[GetByteIndex(dstfmt, dstfmt->Gshift)] = GetByteIndex(srcfmt, srcfmt->Gshift);
+    shuffle[GetByteIndex(dstfmt, dstfmt->Bshift)] = GetByteIndex(srcfmt, srcfmt->Bshift);
+    if (dstfmt->Amask) {
+        shuffle[GetByteIndex(dstfmt, dstfmt->Ashift)] =
+            srcfmt->Amask ? GetByteIndex(srcfmt, srcfmt->Ashift) : SHUFFLE_ALPHA;
+    }
+}
+
+/* The pixels at the end of a row that don't fill a vector */
+static void
+BlitByteShuffleRow(const Uint8 * src, int srcbpp, Uint8 * dst, int dstbpp,
+                   const Uint8 shuffle[4], Uint8 alpha, int width)
+{
+    int i;
+
+    while (width--) {
+        for (i = 0; i < dstbpp; ++i) {
+            if (shuffle[i] < 4) {
+                dst[i] = src[shuffle[i]];
+            } else if (shuffle[i] == SHUFFLE_ALPHA) {
+                dst[i] = alpha;
+            } else {
+                dst[i] = 0;
+            }
+        }
+        src += srcbpp;
+        dst += dstbpp;
+    }
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+/* The control bytes and alpha bytes for 4 pixels, the extra bytes of a 3 byte
+   destination are zeroed and overwritten by the next store */
+static void
+GetByteShuffleVector(const Uint8 shuffle[4], int srcbpp, int dstbpp, Uint8 alpha,
+                     Uint8 control[16], Uint8 alphas[16])
+{
+    int i, j;
+
+    SDL_memset(control, SHUFFLE_ZERO, 16);
+    SDL_memset(alphas, 0, 16);
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < dstbpp; ++j) {
+            if (shuffle[j] < 4) {
+                control[i * dstbpp + j] = (Uint8) (i * srcbpp + shuffle[j]);
+            } else if (shuffle[j] == SHUFFLE_ALPHA) {
+                alphas[i * dstbpp + j] = alpha;
+            }
+        }
+    }
+}
+
+/* A 3 byte row has to keep 2 more pixels than a vector covers for the
+   16 byte loads and stores not to run past its end */
+#define BYTE_SHUFFLE_SLACK(srcbpp, dstbpp) ((srcbpp == 3 || dstbpp == 3) ? 2 : 0)
+
+static SDL_TARGETING("ssse3") void
+Blit_ByteShuffleSSSE3(SDL_BlitInfo * info)
+{
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    const int slack = BYTE_SHUFFLE_SLACK(srcbpp, dstbpp);
+    Uint8 shuffle[4], control[16], alphas[16];
+    __m128i vcontrol, valphas;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+    GetByteShuffleVector(shuffle, srcbpp, dstbpp, info->a, control, alphas);
+    vcontrol = _mm_loadu_si128((const __m128i *) control);
+    valphas = _mm_loadu_si128((const __m128i *) alphas);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 4 + slack) {
+            const __m128i pixels = _mm_loadu_si128((const __m128i *) s);
+            _mm_storeu_si128((__m128i *) d, _mm_or_si128(_mm_shuffle_epi8(pixels, vcontrol), valphas));
+            s += 4 * srcbpp;
+            d += 4 * dstbpp;
+            n -= 4;
+        }
+        BlitByteShuffleRow(s, srcbpp, d, dstbpp, shuffle, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+/* _mm256_shuffle_epi8() stays within 128-bit lanes, so each lane gets the
+   same 4 pixel control and 3 byte rows are loaded and stored a lane at a time */
+static SDL_TARGETING("avx2") void
+Blit_ByteShuffleAVX2(SDL_BlitInfo * info)
+{
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    const int slack = BYTE_SHUFFLE_SLACK(srcbpp, dstbpp);
+    Uint8 shuffle[4], control[16], alphas[16];
+    __m256i vcontrol, valphas;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+    GetByteShuffleVector(shuffle, srcbpp, dstbpp, info->a, control, alphas);
+    vcontrol = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) control));
+    valphas = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) alphas));
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8 + slack) {
+            __m256i pixels;
+            if (srcbpp == 4) {
+                pixels = _mm256_loadu_si256((const __m256i *) s);
+            } else {
+                pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) s)),
+                                                 _mm_loadu_si128((const __m128i *) (s + 12)), 1);
+            }
+            pixels = _mm256_or_si256(_mm256_shuffle_epi8(pixels, vcontrol), valphas);
+            if (dstbpp == 4) {
+                _mm256_storeu_si256((__m256i *) d, pixels);
+            } else {
+                _mm_storeu_si128((__m128i *) d, _mm256_castsi256_si128(pixels));
+                _mm_storeu_si128((__m128i *) (d + 12), _mm256_extracti128_si256(pixels, 1));
+            }
+            s += 8 * srcbpp;
+            d += 8 * dstbpp;
+            n -= 8;
+        }
+        BlitByteShuffleRow(s, srcbpp, d, dstbpp, shuffle, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+/* vld3/vld4 split 8 pixels into a vector per byte, which are put back
+   together in the destination order by vst3/vst4 */
+static void
+Blit_ByteShuffleNEON(SDL_BlitInfo * info)
+{
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    const uint8x8_t zero = vdup_n_u8(0);
+    const uint8x8_t alpha = vdup_n_u8(info->a);
+    Uint8 shuffle[4];
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int i;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            uint8x8_t in[4], out[4];
+            if (srcbpp == 4) {
+                const uint8x8x4_t pixels = vld4_u8(s);
+                in[0] = pixels.val[0];
+                in[1] = pixels.val[1];
+                in[2] = pixels.val[2];
+                in[3] = pixels.val[3];
+            } else {
+                const uint8x8x3_t pixels = vld3_u8(s);
+                in[0] = pixels.val[0];
+                in[1] = pixels.val[1];
+                in[2] = pixels.val[2];
+                in[3] = zero;
+            }
+            for (i = 0; i < 4; ++i) {
+                if (shuffle[i] < 4) {
+                    out[i] = in[shuffle[i]];
+                } else if (shuffle[i] == SHUFFLE_ALPHA) {
+                    out[i] = alpha;
+                } else {
+                    out[i] = zero;
+                }
+            }
+            if (dstbpp == 4) {
+                uint8x8x4_t pixels;
+                pixels.val[0] = out[0];
+                pixels.val[1] = out[1];
+                pixels.val[2] = out[2];
+                pixels.val[3] = out[3];
+                vst4_u8(d, pixels);
+            } else {
+                uint8x8x3_t pixels;
+                pixels.val[0] = out[0];
+                pixels.val[1] = out[1];
+                pixels.val[2] = out[2];
+                vst3_u8(d, pixels);
+            }
+            s += 8 * srcbpp;
+            d += 8 * dstbpp;
+            n -= 8;
+        }
+        BlitByteShuffleRow(s, srcbpp, d, dstbpp, shuffle, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif
+
+/* Returns the fastest byte shuffle blitter the CPU supports, if the formats allow one */
+static SDL_BlitFunc
+GetByteShuffleBlitter(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+#if HAVE_BYTE_SHUFFLE_BLITTERS
+    if (!IsByteShuffleFormat(srcfmt) || !IsByteShuffleFormat(dstfmt)) {
+        return NULL;
+    }
+#if SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return Blit_ByteShuffleAVX2;
+    }
+    /* There's no separate check for SSSE3, every CPU with SSE4.1 has it */
+    if (SDL_HasSSE41()) {
+        return Blit_ByteShuffleSSSE3;
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_HasNEON()) {
+        return Blit_ByteShuffleNEON;
+    }
+#endif
+#endif /* HAVE_BYTE_SHUFFLE_BLITTERS */
+    return NULL;
+}
+
+/* Colorkey blitters: the color bits of each pixel are compared with the key
+   to build a per-pixel mask, and the destination is kept where it matches.
+   Vectors that are entirely transparent aren't written at all. The 32-bit
+   blitters convert with the byte shuffles above, so they cover the same
+   format and cross-format 4 byte pairs alike.
+ */
+#if HAVE_BYTE_SHUFFLE_BLITTERS
+static void
+BlitByteShuffleKeyRow(const Uint8 * src, Uint8 * dst, const Uint8 shuffle[4],
+                      Uint32 rgbmask, Uint32 ckey, Uint8 alpha, int width)
+{
+    while (width--) {
+        if ((*(const Uint32 *) src & rgbmask) != ckey) {
+            BlitByteShuffleRow(src, 4, dst, 4, shuffle, alpha, 1);
+        }
+        src += 4;
+        dst += 4;
+    }
+}
+
+static void
+Blit2to2KeyRow(const Uint16 * src, Uint16 * dst, Uint16 rgbmask, Uint16 ckey, int width)
+{
+    while (width--) {
+        if ((*src & rgbmask) != ckey) {
+            *dst = *src;
+        }
+        ++src;
+        ++dst;
+    }
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+static SDL_TARGETING("sse4.1") void
+Blit_ByteShuffleKeySSE41(SDL_BlitInfo * info)
+{
+    const Uint32 rgbmask = ~info->src_fmt->Amask;
+    const Uint32 ckey = info->colorkey & rgbmask;
+    Uint8 shuffle[4], control[16], alphas[16];
+    __m128i vcontrol, valphas, vrgbmask, vckey;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+    GetByteShuffleVector(shuffle, 4, 4, info->a, control, alphas);
+    vcontrol = _mm_loadu_si128((const __m128i *) control);
+    valphas = _mm_loadu_si128((const __m128i *) alphas);
+    vrgbmask = _mm_set1_epi32((int) rgbmask);
+    vckey = _mm_set1_epi32((int) ckey);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 4) {
+            const __m128i pixels = _mm_loadu_si128((const __m128i *) s);
+            const __m128i keyed = _mm_cmpeq_epi32(_mm_and_si128(pixels, vrgbmask), vckey);
+            const int keymask = _mm_movemask_epi8(keyed);
+            if (keymask != 0xFFFF) {
+                __m128i out = _mm_or_si128(_mm_shuffle_epi8(pixels, vcontrol), valphas);
+                if (keymask) {
+                    out = _mm_blendv_epi8(out, _mm_loadu_si128((const __m128i *) d), keyed);
+                }
+                _mm_storeu_si128((__m128i *) d, out);
+            }
+            s += 16;
+            d += 16;
+            n -= 4;
+        }
+        BlitByteShuffleKeyRow(s, d, shuffle, rgbmask, ckey, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static SDL_TARGETING("avx2") void
+Blit_ByteShuffleKeyAVX2(SDL_BlitInfo * info)
+{
+    const Uint32 rgbmask = ~info->src_fmt->Amask;
+    const Uint32 ckey = info->colorkey & rgbmask;
+    Uint8 shuffle[4], control[16], alphas[16];
+    __m256i vcontrol, valphas, vrgbmask, vckey;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+    GetByteShuffleVector(shuffle, 4, 4, info->a, control, alphas);
+    vcontrol = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) control));
+    valphas = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) alphas));
+    vrgbmask = _mm256_set1_epi32((int) rgbmask);
+    vckey = _mm256_set1_epi32((int) ckey);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const __m256i pixels = _mm256_loadu_si256((const __m256i *) s);
+            const __m256i keyed = _mm256_cmpeq_epi32(_mm256_and_si256(pixels, vrgbmask), vckey);
+            const int keymask = _mm256_movemask_epi8(keyed);
+            if (keymask != -1) {
+                __m256i out = _mm256_or_si256(_mm256_shuffle_epi8(pixels, vcontrol), valphas);
+                if (keymask) {
+                    out = _mm256_blendv_epi8(out, _mm256_loadu_si256((const __m256i *) d), keyed);
+                }
+                _mm256_storeu_si256((__m256i *) d, out);
+            }
+            s += 32;
+            d += 32;
+            n -= 8;
+        }
+        BlitByteShuffleKeyRow(s, d, shuffle, rgbmask, ckey, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static SDL_TARGETING("sse4.1") void
+Blit2to2KeySSE41(SDL_BlitInfo * info)
+{
+    const Uint16 rgbmask = (Uint16) ~info->src_fmt->Amask;
+    const Uint16 ckey = (Uint16) (info->colorkey & rgbmask);
+    const __m128i vrgbmask = _mm_set1_epi16((short) rgbmask);
+    const __m128i vckey = _mm_set1_epi16((short) ckey);
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint16 *s = (const Uint16 *) src;
+        Uint16 *d = (Uint16 *) dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const __m128i pixels = _mm_loadu_si128((const __m128i *) s);
+            const __m128i keyed = _mm_cmpeq_epi16(_mm_and_si128(pixels, vrgbmask), vckey);
+            const int keymask = _mm_movemask_epi8(keyed);
+            if (keymask != 0xFFFF) {
+                __m128i out = pixels;
+                if (keymask) {
+                    out = _mm_blendv_epi8(out, _mm_loadu_si128((const __m128i *) d), keyed);
+                }
+                _mm_storeu_si128((__m128i *) d, out);
+            }
+            s += 8;
+            d += 8;
+            n -= 8;
+        }
+        Blit2to2KeyRow(s, d, rgbmask, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static SDL_TARGETING("avx2") void
+Blit2to2KeyAVX2(SDL_BlitInfo * info)
+{
+    const Uint16 rgbmask = (Uint16) ~info->src_fmt->Amask;
+    const Uint16 ckey = (Uint16) (info->colorkey & rgbmask);
+    const __m256i vrgbmask = _mm256_set1_epi16((short) rgbmask);
+    const __m256i vckey = _mm256_set1_epi16((short) ckey);
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint16 *s = (const Uint16 *) src;
+        Uint16 *d = (Uint16 *) dst;
+        int n = info->dst_w;
+
+        while (n >= 16) {
+            const __m256i pixels = _mm256_loadu_si256((const __m256i *) s);
+            const __m256i keyed = _mm256_cmpeq_epi16(_mm256_and_si256(pixels, vrgbmask), vckey);
+            const int keymask = _mm256_movemask_epi8(keyed);
+            if (keymask != -1) {
+                __m256i out = pixels;
+                if (keymask) {
+                    out = _mm256_blendv_epi8(out, _mm256_loadu_si256((const __m256i *) d), keyed);
+                }
+                _mm256_storeu_si256((__m256i *) d, out);
+            }
+            s += 16;
+            d += 16;
+            n -= 16;
+        }
+        Blit2to2KeyRow(s, d, rgbmask, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+/* The key is compared a byte plane at a time, and the planes that match
+   in all four bytes select the destination pixel */
+static void
+Blit_ByteShuffleKeyNEON(SDL_BlitInfo * info)
+{
+    const Uint32 rgbmask = ~info->src_fmt->Amask;
+    const Uint32 ckey = info->colorkey & rgbmask;
+    const uint8x8_t zero = vdup_n_u8(0);
+    const uint8x8_t alpha = vdup_n_u8(info->a);
+    uint8x8_t vrgbmask[4], vckey[4];
+    Uint8 shuffle[4];
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int i;
+
+    GetByteShuffle(info->src_fmt, info->dst_fmt, shuffle);
+    for (i = 0; i < 4; ++i) {
+        vrgbmask[i] = vdup_n_u8((Uint8) (rgbmask >> (i * 8)));
+        vckey[i] = vdup_n_u8((Uint8) (ckey >> (i * 8)));
+    }
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const uint8x8x4_t pixels = vld4_u8(s);
+            uint8x8_t keyed = vceq_u8(vand_u8(pixels.val[0], vrgbmask[0]), vckey[0]);
+            for (i = 1; i < 4; ++i) {
+                keyed = vand_u8(keyed, vceq_u8(vand_u8(pixels.val[i], vrgbmask[i]), vckey[i]));
+            }
+            if (vget_lane_u64(vreinterpret_u64_u8(keyed), 0) != ~(uint64_t) 0) {
+                uint8x8x4_t out = vld4_u8(d);
+                for (i = 0; i < 4; ++i) {
+                    uint8x8_t value;
+                    if (shuffle[i] < 4) {
+                        value = pixels.val[shuffle[i]];
+                    } else if (shuffle[i] == SHUFFLE_ALPHA) {
+                        value = alpha;
+                    } else {
+                        value = zero;
+                    }
+                    out.val[i] = vbsl_u8(keyed, out.val[i], value);
+                }
+                vst4_u8(d, out);
+            }
+            s += 32;
+            d += 32;
+            n -= 8;
+        }
+        BlitByteShuffleKeyRow(s, d, shuffle, rgbmask, ckey, info->a, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static void
+Blit2to2KeyNEON(SDL_BlitInfo * info)
+{
+    const Uint16 rgbmask = (Uint16) ~info->src_fmt->Amask;
+    const Uint16 ckey = (Uint16) (info->colorkey & rgbmask);
+    const uint16x8_t vrgbmask = vdupq_n_u16(rgbmask);
+    const uint16x8_t vckey = vdupq_n_u16(ckey);
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        const Uint16 *s = (const Uint16 *) src;
+        Uint16 *d = (Uint16 *) dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const uint16x8_t pixels = vld1q_u16(s);
+            const uint16x8_t keyed = vceqq_u16(vandq_u16(pixels, vrgbmask), vckey);
+            vst1q_u16(d, vbslq_u16(keyed, vld1q_u16(d), pixels));
+            s += 8;
+            d += 8;
+            n -= 8;
+        }
+        Blit2to2KeyRow(s, d, rgbmask, ckey, n);
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif
+
+/* Returns the fastest 32-bit colorkey blitter the CPU supports, if the formats allow one */
+static SDL_BlitFunc
+GetByteShuffleKeyBlitter(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+#if HAVE_BYTE_SHUFFLE_BLITTERS
+    if (srcfmt->BytesPerPixel != 4 || dstfmt->BytesPerPixel != 4 ||
+        !IsByteShuffleFormat(srcfmt) || !IsByteShuffleFormat(dstfmt)) {
+        return NULL;
+    }
+#if SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return Blit_ByteShuffleKeyAVX2;
+    }
+    if (SDL_HasSSE41()) {
+        return Blit_ByteShuffleKeySSE41;
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_HasNEON()) {
+        return Blit_ByteShuffleKeyNEON;
+    }
+#endif
+#endif /* HAVE_BYTE_SHUFFLE_BLITTERS */
+    return NULL;
+}
+
+/* Returns the fastest 16-bit colorkey blitter the CPU supports */
+static SDL_BlitFunc
+Get2to2KeyBlitter(void)
+{
+#if SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return Blit2to2KeyAVX2;
+    }
+    if (SDL_HasSSE41()) {
+        return Blit2to2KeySSE41;
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_HasNEON()) {
+        return Blit2to2KeyNEON;
+    }
+#endif
+    return Blit2to2Key;
+}
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3394,6 +4008,13 @@ SDL_CalculateBlitN(SDL_Surface * surface)
         } else {
             /* Now the meat, choose the blitter we want */
             Uint32 a_need = NO_ALPHA;
+
+            /* Pure byte permutations are best done with a vector shuffle */
+            blitfun = GetByteShuffleBlitter(srcfmt, dstfmt);
+            if (blitfun) {
+                return blitfun;
+            }
+
             if (dstfmt->Amask)
                 a_need = srcfmt->Amask ? COPY_ALPHA : SET_ALPHA;
             table = normal_blit[srcfmt->BytesPerPixel - 1];
@@ -3446,10 +4067,14 @@ SDL_CalculateBlitN(SDL_Surface * surface)
            If a particular case turns out to be useful we'll add it. */
 
         if (srcfmt->BytesPerPixel == 2 && surface->map->identity)
-            return Blit2to2Key;
+            return Get2to2KeyBlitter();
         else if (dstfmt->BytesPerPixel == 1)
             return BlitNto1Key;
         else {
+            blitfun = GetByteShuffleKeyBlitter(srcfmt, dstfmt);
+            if (blitfun) {
+                return blitfun;
+            }
 #if SDL_ALTIVEC_BLITTERS
             if ((srcfmt->BytesPerPixel == 4) && (dstfmt->BytesPerPixel == 4)
                 && SDL_HasAltiVec()) {
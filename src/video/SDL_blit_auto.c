@@ -29,6 +29,426 @@
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+/* The SIMD variants of the unscaled modulate and blend blitters unpack the
+   channels of several pixels into separate vectors of 16-bit lanes and give
+   the same results as the scalar blitters, bit for bit. They only do the
+   blend, add and mod blend modes and fall back to the scalar blitter for mul.
+ */
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define SDL_BLIT_AUTO_NEON 1
+#else
+#define SDL_BLIT_AUTO_NEON 0
+#endif
+
+#if defined(__SSE2__) || SDL_AVX2_INTRINSICS || SDL_BLIT_AUTO_NEON
+
+typedef struct
+{
+    int r, g, b, a;     /* bit positions of the channels, a is -1 without alpha */
+} SDL_BlitAutoFormat;
+
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_RGB888 = { 16, 8, 0, -1 };
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_BGR888 = { 0, 8, 16, -1 };
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_ARGB8888 = { 16, 8, 0, 24 };
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_RGBA8888 = { 24, 16, 8, 0 };
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_ABGR8888 = { 0, 8, 16, 24 };
+static const SDL_BlitAutoFormat SDL_BlitAutoFormat_BGRA8888 = { 8, 16, 24, 0 };
+
+#define SDL_BLIT_AUTO_MODES (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)
+
+static SDL_bool
+SDL_BlitAuto_CanBlend(int flags)
+{
+    switch (flags & SDL_BLIT_AUTO_MODES) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_ADD:
+    case SDL_COPY_MOD:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+#endif
+
+#ifdef __SSE2__
+/* (x * y) / 255 for 16-bit lanes holding values up to 255 */
+static SDL_INLINE __m128i
+SDL_BlitAuto_MulDiv255_SSE2(__m128i x, __m128i y)
+{
+    const __m128i t = _mm_mullo_epi16(x, y);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+
+/* One channel of 8 pixels */
+static SDL_INLINE __m128i
+SDL_BlitAuto_Unpack_SSE2(__m128i p0, __m128i p1, __m128i shift)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(p0, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(p1, shift), mask));
+}
+
+static SDL_bool
+SDL_BlitAuto_SSE2(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i srcR = _mm_cvtsi32_si128(srcfmt->r);
+    const __m128i srcG = _mm_cvtsi32_si128(srcfmt->g);
+    const __m128i srcB = _mm_cvtsi32_si128(srcfmt->b);
+    const __m128i srcA = _mm_cvtsi32_si128(srcfmt->a);
+    const __m128i dstR = _mm_cvtsi32_si128(dstfmt->r);
+    const __m128i dstG = _mm_cvtsi32_si128(dstfmt->g);
+    const __m128i dstB = _mm_cvtsi32_si128(dstfmt->b);
+    const __m128i dstA = _mm_cvtsi32_si128(dstfmt->a);
+    const __m128i modR = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const __m128i modG = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const __m128i modB = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const __m128i modA = _mm_set1_epi16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[8], dstbuf[8];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m128i p0, p1, sR, sG, sB, sA;
+
+            if (count < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            p0 = _mm_loadu_si128((const __m128i *)s);
+            p1 = _mm_loadu_si128((const __m128i *)(s + 4));
+            sR = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcR);
+            sG = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcG);
+            sB = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcB);
+            sA = (srcfmt->a >= 0) ? SDL_BlitAuto_Unpack_SSE2(p0, p1, srcA) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_SSE2(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_SSE2(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_SSE2(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_SSE2(sA, modA);
+            }
+            if (blend) {
+                __m128i dR, dG, dB, dA;
+                p0 = _mm_loadu_si128((const __m128i *)d);
+                p1 = _mm_loadu_si128((const __m128i *)(d + 4));
+                dR = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstR);
+                dG = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstG);
+                dB = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstB);
+                dA = (dstfmt->a >= 0) ? SDL_BlitAuto_Unpack_SSE2(p0, p1, dstA) : zero;
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_SSE2(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_SSE2(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_SSE2(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const __m128i inv = _mm_sub_epi16(full, sA);
+                    sR = _mm_add_epi16(sR, SDL_BlitAuto_MulDiv255_SSE2(dR, inv));
+                    sG = _mm_add_epi16(sG, SDL_BlitAuto_MulDiv255_SSE2(dG, inv));
+                    sB = _mm_add_epi16(sB, SDL_BlitAuto_MulDiv255_SSE2(dB, inv));
+                    sA = _mm_add_epi16(sA, SDL_BlitAuto_MulDiv255_SSE2(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = _mm_min_epi16(_mm_add_epi16(sR, dR), full);
+                    sG = _mm_min_epi16(_mm_add_epi16(sG, dG), full);
+                    sB = _mm_min_epi16(_mm_add_epi16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_SSE2(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_SSE2(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_SSE2(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            p0 = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(sR, zero), dstR),
+                                           _mm_sll_epi32(_mm_unpacklo_epi16(sG, zero), dstG)),
+                              _mm_sll_epi32(_mm_unpacklo_epi16(sB, zero), dstB));
+            p1 = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(sR, zero), dstR),
+                                           _mm_sll_epi32(_mm_unpackhi_epi16(sG, zero), dstG)),
+                              _mm_sll_epi32(_mm_unpackhi_epi16(sB, zero), dstB));
+            if (dstfmt->a >= 0) {
+                p0 = _mm_or_si128(p0, _mm_sll_epi32(_mm_unpacklo_epi16(sA, zero), dstA));
+                p1 = _mm_or_si128(p1, _mm_sll_epi32(_mm_unpackhi_epi16(sA, zero), dstA));
+            }
+            _mm_storeu_si128((__m128i *)d, p0);
+            _mm_storeu_si128((__m128i *)(d + 4), p1);
+
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* __SSE2__ */
+
+#if SDL_AVX2_INTRINSICS
+static SDL_TARGETING("avx2") __m256i
+SDL_BlitAuto_MulDiv255_AVX2(__m256i x, __m256i y)
+{
+    const __m256i t = _mm256_mullo_epi16(x, y);
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(1)), _mm256_srli_epi16(t, 8)), 8);
+}
+
+/* One channel of 16 pixels, in the lane order _mm256_unpacklo/hi_epi16() undo */
+static SDL_TARGETING("avx2") __m256i
+SDL_BlitAuto_Unpack_AVX2(__m256i p0, __m256i p1, __m128i shift)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    return _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(p0, shift), mask),
+                              _mm256_and_si256(_mm256_srl_epi32(p1, shift), mask));
+}
+
+static SDL_TARGETING("avx2") SDL_bool
+SDL_BlitAuto_AVX2(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i full = _mm256_set1_epi16(255);
+    const __m128i srcR = _mm_cvtsi32_si128(srcfmt->r);
+    const __m128i srcG = _mm_cvtsi32_si128(srcfmt->g);
+    const __m128i srcB = _mm_cvtsi32_si128(srcfmt->b);
+    const __m128i srcA = _mm_cvtsi32_si128(srcfmt->a);
+    const __m128i dstR = _mm_cvtsi32_si128(dstfmt->r);
+    const __m128i dstG = _mm_cvtsi32_si128(dstfmt->g);
+    const __m128i dstB = _mm_cvtsi32_si128(dstfmt->b);
+    const __m128i dstA = _mm_cvtsi32_si128(dstfmt->a);
+    const __m256i modR = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const __m256i modG = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const __m256i modB = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const __m256i modA = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[16], dstbuf[16];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 16);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m256i p0, p1, sR, sG, sB, sA;
+
+            if (count < 16) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            p0 = _mm256_loadu_si256((const __m256i *)s);
+            p1 = _mm256_loadu_si256((const __m256i *)(s + 8));
+            sR = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcR);
+            sG = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcG);
+            sB = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcB);
+            sA = (srcfmt->a >= 0) ? SDL_BlitAuto_Unpack_AVX2(p0, p1, srcA) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_AVX2(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_AVX2(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_AVX2(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_AVX2(sA, modA);
+            }
+            if (blend) {
+                __m256i dR, dG, dB, dA;
+                p0 = _mm256_loadu_si256((const __m256i *)d);
+                p1 = _mm256_loadu_si256((const __m256i *)(d + 8));
+                dR = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstR);
+                dG = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstG);
+                dB = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstB);
+                dA = (dstfmt->a >= 0) ? SDL_BlitAuto_Unpack_AVX2(p0, p1, dstA) : zero;
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_AVX2(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_AVX2(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_AVX2(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const __m256i inv = _mm256_sub_epi16(full, sA);
+                    sR = _mm256_add_epi16(sR, SDL_BlitAuto_MulDiv255_AVX2(dR, inv));
+                    sG = _mm256_add_epi16(sG, SDL_BlitAuto_MulDiv255_AVX2(dG, inv));
+                    sB = _mm256_add_epi16(sB, SDL_BlitAuto_MulDiv255_AVX2(dB, inv));
+                    sA = _mm256_add_epi16(sA, SDL_BlitAuto_MulDiv255_AVX2(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = _mm256_min_epi16(_mm256_add_epi16(sR, dR), full);
+                    sG = _mm256_min_epi16(_mm256_add_epi16(sG, dG), full);
+                    sB = _mm256_min_epi16(_mm256_add_epi16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_AVX2(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_AVX2(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_AVX2(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            p0 = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpacklo_epi16(sR, zero), dstR),
+                                                 _mm256_sll_epi32(_mm256_unpacklo_epi16(sG, zero), dstG)),
+                                 _mm256_sll_epi32(_mm256_unpacklo_epi16(sB, zero), dstB));
+            p1 = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpackhi_epi16(sR, zero), dstR),
+                                                 _mm256_sll_epi32(_mm256_unpackhi_epi16(sG, zero), dstG)),
+                                 _mm256_sll_epi32(_mm256_unpackhi_epi16(sB, zero), dstB));
+            if (dstfmt->a >= 0) {
+                p0 = _mm256_or_si256(p0, _mm256_sll_epi32(_mm256_unpacklo_epi16(sA, zero), dstA));
+                p1 = _mm256_or_si256(p1, _mm256_sll_epi32(_mm256_unpackhi_epi16(sA, zero), dstA));
+            }
+            _mm256_storeu_si256((__m256i *)d, p0);
+            _mm256_storeu_si256((__m256i *)(d + 8), p1);
+
+            if (count < 16) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_BLIT_AUTO_NEON
+static SDL_INLINE uint16x8_t
+SDL_BlitAuto_MulDiv255_NEON(uint16x8_t x, uint16x8_t y)
+{
+    const uint16x8_t t = vmulq_u16(x, y);
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+}
+
+/* The channels are the planes vld4_u8() splits the pixels into, by byte */
+static SDL_bool
+SDL_BlitAuto_NEON(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const uint16x8_t full = vdupq_n_u16(255);
+    const uint16x8_t modR = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const uint16x8_t modG = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const uint16x8_t modB = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const uint16x8_t modA = vdupq_n_u16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[8], dstbuf[8];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            uint8x8x4_t pixels;
+            uint16x8_t sR, sG, sB, sA;
+
+            if (count < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            sR = vmovl_u8(pixels.val[srcfmt->r / 8]);
+            sG = vmovl_u8(pixels.val[srcfmt->g / 8]);
+            sB = vmovl_u8(pixels.val[srcfmt->b / 8]);
+            sA = (srcfmt->a >= 0) ? vmovl_u8(pixels.val[srcfmt->a / 8]) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_NEON(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_NEON(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_NEON(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_NEON(sA, modA);
+            }
+            if (blend) {
+                uint16x8_t dR, dG, dB, dA;
+                pixels = vld4_u8((const Uint8 *)d);
+                dR = vmovl_u8(pixels.val[dstfmt->r / 8]);
+                dG = vmovl_u8(pixels.val[dstfmt->g / 8]);
+                dB = vmovl_u8(pixels.val[dstfmt->b / 8]);
+                dA = (dstfmt->a >= 0) ? vmovl_u8(pixels.val[dstfmt->a / 8]) : vdupq_n_u16(0);
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_NEON(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_NEON(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_NEON(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const uint16x8_t inv = vsubq_u16(full, sA);
+                    sR = vaddq_u16(sR, SDL_BlitAuto_MulDiv255_NEON(dR, inv));
+                    sG = vaddq_u16(sG, SDL_BlitAuto_MulDiv255_NEON(dG, inv));
+                    sB = vaddq_u16(sB, SDL_BlitAuto_MulDiv255_NEON(dB, inv));
+                    sA = vaddq_u16(sA, SDL_BlitAuto_MulDiv255_NEON(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = vminq_u16(vaddq_u16(sR, dR), full);
+                    sG = vminq_u16(vaddq_u16(sG, dG), full);
+                    sB = vminq_u16(vaddq_u16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_NEON(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_NEON(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_NEON(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            pixels.val[0] = pixels.val[1] = pixels.val[2] = pixels.val[3] = vdup_n_u8(0);
+            pixels.val[dstfmt->r / 8] = vmovn_u16(sR);
+            pixels.val[dstfmt->g / 8] = vmovn_u16(sG);
+            pixels.val[dstfmt->b / 8] = vmovn_u16(sB);
+            if (dstfmt->a >= 0) {
+                pixels.val[dstfmt->a / 8] = vmovn_u16(sA);
+            }
+            vst4_u8((Uint8 *)d, pixels);
+
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* SDL_BLIT_AUTO_NEON */
+
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
     int srcy, srcx;
@@ -116,6 +536,33 @@ static void SDL_Blit_RGB888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -217,6 +664,33 @@ static void SDL_Blit_RGB888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -336,6 +810,33 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -516,6 +1017,33 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -617,6 +1145,33 @@ static void SDL_Blit_RGB888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -736,6 +1291,33 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -919,6 +1501,33 @@ static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1024,6 +1633,33 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1147,6 +1783,33 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGB888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGB888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1329,6 +1992,33 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1430,6 +2120,33 @@ static void SDL_Blit_BGR888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1549,6 +2266,33 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1724,6 +2468,33 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1825,6 +2596,33 @@ static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1944,6 +2742,33 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2127,6 +2952,33 @@ static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2232,6 +3084,33 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2355,6 +3234,33 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGR888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGR888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2545,6 +3451,33 @@ static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2654,6 +3587,33 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2775,6 +3735,33 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2965,6 +3952,33 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3074,6 +4088,33 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3195,6 +4236,33 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3382,6 +4450,33 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3497,6 +4592,33 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3624,6 +4746,33 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ARGB8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3816,6 +4965,33 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3925,6 +5101,33 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4046,6 +5249,33 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4236,6 +5466,33 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4345,6 +5602,33 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4466,6 +5750,33 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4658,6 +5969,33 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4773,6 +6111,33 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4900,6 +6265,33 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_RGBA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5092,6 +6484,33 @@ static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5201,6 +6620,33 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5322,6 +6768,33 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5512,6 +6985,33 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5621,6 +7121,33 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5742,6 +7269,33 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5934,6 +7488,33 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6049,6 +7630,33 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6176,6 +7784,33 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_ABGR8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6368,6 +8003,33 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6477,6 +8139,33 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6598,6 +8287,33 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_RGB888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_RGB888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6788,6 +8504,33 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6897,6 +8640,33 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7018,6 +8788,33 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_BGR888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_BGR888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7210,6 +9007,33 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_FALSE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7325,6 +9149,33 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_FALSE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7452,6 +9303,33 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_AVX2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#ifdef __SSE2__
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_SSE2(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
+#if SDL_BLIT_AUTO_NEON
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    if (!SDL_BlitAuto_NEON(info, &SDL_BlitAutoFormat_BGRA8888, &SDL_BlitAutoFormat_ARGB8888, SDL_TRUE, SDL_TRUE)) {
+        SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(info);
+    }
+}
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7546,129 +9424,615 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
@@ -109,6 +109,12 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
+                /* Premultiplied color fades together with its alpha */
+                if (flags & SDL_COPY_BLEND_PREMULTIPLIED) {
+                    srcR = (srcR * modulateA) / 255;
+                    srcG = (srcG * modulateA) / 255;
+                    srcB = (srcB * modulateA) / 255;
+                }
             }
             if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
@@ -118,7 +124,7 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+            switch (flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
             case 0:
                 dstR = srcR;
                 dstG = srcG;
@@ -131,6 +137,20 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_BLEND_PREMULTIPLIED:
+                /* The source color was premultiplied when it was loaded,
+                   but it isn't guaranteed to stay below its alpha */
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                if (dstR > 255)
+                    dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                if (dstG > 255)
+                    dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                if (dstB > 255)
+                    dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR;
                 if (dstR > 255)
@@ -25,8 +25,66 @@
 #include "SDL_cpuinfo.h"
 
 
-#ifdef __SSE__
+/*
+ * The x86 SIMD fills work on rows of bytes, so they take the width in bytes.
+ * The color holds the pixel value repeated across 32 bits, and as long as the
+ * pixels are aligned to their size, every 4 byte aligned address starts with
+ * the first byte of it. Large fills use non-temporal stores, which bypass the
+ * cache, see SDL_HINT_FILL_STREAM_THRESHOLD.
+ */
 /* *INDENT-OFF* */
+#if defined(__SSE__) || SDL_AVX2_INTRINSICS
+
+#define FILL_BYTE(p) \
+    *(p) = ((const Uint8 *)&color)[(uintptr_t)(p) & 3]
+
+#define DEFINE_SIMD_FILLRECT(name, target, BEGIN, STORE, align, END) \
+static target void \
+SDL_FillRect##name(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+{ \
+    BEGIN; \
+ \
+    while (h--) { \
+        Uint8 *p = pixels; \
+        int n = w; \
+ \
+        while (n && ((uintptr_t)p & 3)) { \
+            FILL_BYTE(p); \
+            ++p; \
+            --n; \
+        } \
+        while (n >= 4 && ((uintptr_t)p & ((align) - 1))) { \
+            *(Uint32 *)p = color; \
+            p += 4; \
+            n -= 4; \
+        } \
+        for (; n >= 4 * (align); n -= 4 * (align), p += 4 * (align)) { \
+            STORE(p); \
+            STORE(p + (align)); \
+            STORE(p + 2 * (align)); \
+            STORE(p + 3 * (align)); \
+        } \
+        for (; n >= (align); n -= (align), p += (align)) { \
+            STORE(p); \
+        } \
+        for (; n >= 4; n -= 4, p += 4) { \
+            *(Uint32 *)p = color; \
+        } \
+        for (; n; --n, ++p) { \
+            FILL_BYTE(p); \
+        } \
+        pixels += pitch; \
+    } \
+ \
+    END; \
+}
+
+#define FILL_NOTHING
+#define FILL_SFENCE _mm_sfence()
+
+#endif /* __SSE__ || SDL_AVX2_INTRINSICS */
+
+#ifdef __SSE__
 
 #ifdef _MSC_VER
 #define SSE_BEGIN \
@@ -46,90 +104,37 @@
     c128 = *(__m128 *)cccc;
 #endif
 
-#define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
-    }
+#define SSE_STORE(p)    _mm_store_ps((float *)(p), c128)
+#define SSE_STREAM(p)   _mm_stream_ps((float *)(p), c128)
 
-#define SSE_END
+DEFINE_SIMD_FILLRECT(SSE, FILL_NOTHING, SSE_BEGIN, SSE_STORE, 16, FILL_NOTHING)
+DEFINE_SIMD_FILLRECT(SSEStream, FILL_NOTHING, SSE_BEGIN, SSE_STREAM, 16, FILL_SFENCE)
 
-#define DEFINE_SSE_FILLRECT(bpp, type) \
-static void \
-SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
-{ \
-    int i, n; \
-    Uint8 *p = NULL; \
- \
-    SSE_BEGIN; \
- \
-    while (h--) { \
-        n = w * bpp; \
-        p = pixels; \
- \
-        if (n > 63) { \
-            int adjust = 16 - ((uintptr_t)p & 15); \
-            if (adjust < 16) { \
-                n -= adjust; \
-                adjust /= bpp; \
-                while (adjust--) { \
-                    *((type *)p) = (type)color; \
-                    p += bpp; \
-                } \
-            } \
-            SSE_WORK; \
-        } \
-        if (n & 63) { \
-            int remainder = (n & 63); \
-            remainder /= bpp; \
-            while (remainder--) { \
-                *((type *)p) = (type)color; \
-                p += bpp; \
-            } \
-        } \
-        pixels += pitch; \
-    } \
- \
-    SSE_END; \
-}
+#endif /* __SSE__ */
 
-static void
-SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
-{
-    int i, n;
+#if SDL_AVX2_INTRINSICS
 
-    SSE_BEGIN;
-    while (h--) {
-        Uint8 *p = pixels;
-        n = w;
+#define AVX2_BEGIN      const __m256i c256 = _mm256_set1_epi32((int)color)
+#define AVX2_STORE(p)   _mm256_store_si256((__m256i *)(p), c256)
+#define AVX2_STREAM(p)  _mm256_stream_si256((__m256i *)(p), c256)
 
-        if (n > 63) {
-            int adjust = 16 - ((uintptr_t)p & 15);
-            if (adjust) {
-                n -= adjust;
-                SDL_memset(p, color, adjust);
-                p += adjust;
-            }
-            SSE_WORK;
-        }
-        if (n & 63) {
-            int remainder = (n & 63);
-            SDL_memset(p, color, remainder);
-        }
-        pixels += pitch;
-    }
+DEFINE_SIMD_FILLRECT(AVX2, SDL_TARGETING("avx2"), AVX2_BEGIN, AVX2_STORE, 32, FILL_NOTHING)
+DEFINE_SIMD_FILLRECT(AVX2Stream, SDL_TARGETING("avx2"), AVX2_BEGIN, AVX2_STREAM, 32, FILL_SFENCE)
 
-    SSE_END;
-}
-/* DEFINE_SSE_FILLRECT(1, Uint8) */
-DEFINE_SSE_FILLRECT(2, Uint16)
-DEFINE_SSE_FILLRECT(4, Uint32)
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_AVX512F_INTRINSICS
+
+#define AVX512_BEGIN        const __m512i c512 = _mm512_set1_epi32((int)color)
+#define AVX512_STORE(p)     _mm512_store_si512((void *)(p), c512)
+#define AVX512_STREAM(p)    _mm512_stream_si512((void *)(p), c512)
+
+DEFINE_SIMD_FILLRECT(AVX512, SDL_TARGETING("avx512f"), AVX512_BEGIN, AVX512_STORE, 64, FILL_NOTHING)
+DEFINE_SIMD_FILLRECT(AVX512Stream, SDL_TARGETING("avx512f"), AVX512_BEGIN, AVX512_STREAM, 64, FILL_SFENCE)
+
+#endif /* SDL_AVX512F_INTRINSICS */
 
 /* *INDENT-ON* */
-#endif /* __SSE__ */
 
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
@@ -295,15 +300,54 @@ static void fill_32_simd(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 }
 #endif
 
+typedef void (*SDL_FillRectFunc)(Uint8 * pixels, int pitch, Uint32 color, int w, int h);
+
+typedef struct
+{
+    SDL_FillRectFunc fill_function;
+    Uint8 *pixels;
+    int pitch;
+    Uint32 color;
+    int w;
+} SDL_FillRectBandData;
+
+static void
+SDL_FillRectBand(void *userdata, int y, int h)
+{
+    const SDL_FillRectBandData *data = (const SDL_FillRectBandData *) userdata;
+
+    data->fill_function(data->pixels + y * data->pitch, data->pitch, data->color, data->w, h);
+}
+
+/* Orders rects top to bottom, then left to right */
+static int SDLCALL
+SDL_CompareRectRows(const void *a, const void *b)
+{
+    const SDL_Rect *A = (const SDL_Rect *) a;
+    const SDL_Rect *B = (const SDL_Rect *) b;
+
+    if (A->y != B->y) {
+        return (A->y < B->y) ? -1 : 1;
+    }
+    if (A->x != B->x) {
+        return (A->x < B->x) ? -1 : 1;
+    }
+    return 0;
+}
+
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    SDL_Rect clipped;
-    Uint8 *pixels;
+    SDL_Rect local_rects[16];
+    SDL_Rect *clipped;
     const SDL_Rect* rect;
-    void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
-    int i;
+    SDL_FillRectFunc fill_function = NULL;
+    SDL_FillRectBandData data;
+    int bpp, width_scale = 1;
+    int i, num_clipped;
+    Sint64 total = 0;
+    SDL_bool sorted = SDL_TRUE;
 
     if (!dst) {
         return SDL_SetError("Passed NULL destination surface");
@@ -323,9 +367,37 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
 
+    /* Clip everything first, the total size decides how the pixels are stored */
+    if (count <= (int)SDL_arraysize(local_rects)) {
+        clipped = local_rects;
+    } else {
+        clipped = (SDL_Rect *) SDL_malloc(count * sizeof(*clipped));
+        if (!clipped) {
+            return SDL_OutOfMemory();
+        }
+    }
+    bpp = dst->format->BytesPerPixel;
+    num_clipped = 0;
+    for (i = 0; i < count; ++i) {
+        SDL_Rect *r = &clipped[num_clipped];
+        if (!SDL_IntersectRect(&rects[i], &dst->clip_rect, r)) {
+            continue;
+        }
+        if (num_clipped > 0 && SDL_CompareRectRows(r - 1, r) > 0) {
+            sorted = SDL_FALSE;
+        }
+        total += (Sint64)r->w * r->h * bpp;
+        ++num_clipped;
+    }
+
+    /* Fill batches top to bottom so neighbouring rects share cache lines */
+    if (!sorted) {
+        SDL_qsort(clipped, num_clipped, sizeof(*clipped), SDL_CompareRectRows);
+    }
+
 #if SDL_ARM_NEON_BLITTERS
-    if (SDL_HasNEON() && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
-        switch (dst->format->BytesPerPixel) {
+    if (SDL_HasNEON() && bpp != 3 && fill_function == NULL) {
+        switch (bpp) {
         case 1:
             fill_function = fill_8_neon;
             break;
@@ -339,8 +411,8 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
     }
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-    if (SDL_HasARMSIMD() && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
-        switch (dst->format->BytesPerPixel) {
+    if (SDL_HasARMSIMD() && bpp != 3 && fill_function == NULL) {
+        switch (bpp) {
         case 1:
             fill_function = fill_8_simd;
             break;
@@ -355,70 +427,75 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
 #endif
 
     if (fill_function == NULL) {
-        switch (dst->format->BytesPerPixel) {
+        switch (bpp) {
         case 1:
-            {
-                color |= (color << 8);
-                color |= (color << 16);
-#ifdef __SSE__
-                if (SDL_HasSSE()) {
-                    fill_function = SDL_FillRect1SSE;
-                    break;
-                }
-#endif
-                fill_function = SDL_FillRect1;
-                break;
-            }
+            color &= 0xFF;
+            color |= (color << 8);
+            color |= (color << 16);
+            fill_function = SDL_FillRect1;
+            break;
 
         case 2:
-            {
-                color |= (color << 16);
-#ifdef __SSE__
-                if (SDL_HasSSE()) {
-                    fill_function = SDL_FillRect2SSE;
-                    break;
-                }
-#endif
-                fill_function = SDL_FillRect2;
-                break;
-            }
+            color &= 0xFFFF;
+            color |= (color << 16);
+            fill_function = SDL_FillRect2;
+            break;
 
         case 3:
             /* 24-bit RGB is a slow path, at least for now. */
-            {
-                fill_function = SDL_FillRect3;
-                break;
-            }
+            fill_function = SDL_FillRect3;
+            break;
 
         case 4:
-            {
-#ifdef __SSE__
-                if (SDL_HasSSE()) {
-                    fill_function = SDL_FillRect4SSE;
-                    break;
-                }
-#endif
-                fill_function = SDL_FillRect4;
-                break;
-            }
+            fill_function = SDL_FillRect4;
+            break;
 
         default:
+            if (clipped != local_rects) {
+                SDL_free(clipped);
+            }
             return SDL_SetError("Unsupported pixel format");
         }
-    }
 
-    for (i = 0; i < count; ++i) {
-        rect = &rects[i];
-        /* Perform clipping */
-        if (!SDL_IntersectRect(rect, &dst->clip_rect, &clipped)) {
-            continue;
+        /* The SIMD fills need pixels aligned to their size */
+        if (bpp != 3 && (((uintptr_t)dst->pixels | (uintptr_t)dst->pitch) & (bpp - 1)) == 0) {
+            const SDL_bool stream = (total >= SDL_GetFillStreamThreshold());
+            SDL_FillRectFunc simd_function = NULL;
+
+#if SDL_AVX512F_INTRINSICS
+            if (!simd_function && SDL_HasAVX512F()) {
+                simd_function = stream ? SDL_FillRectAVX512Stream : SDL_FillRectAVX512;
+            }
+#endif
+#if SDL_AVX2_INTRINSICS
+            if (!simd_function && SDL_HasAVX2()) {
+                simd_function = stream ? SDL_FillRectAVX2Stream : SDL_FillRectAVX2;
+            }
+#endif
+#ifdef __SSE__
+            if (!simd_function && SDL_HasSSE()) {
+                simd_function = stream ? SDL_FillRectSSEStream : SDL_FillRectSSE;
+            }
+#endif
+            if (simd_function) {
+                fill_function = simd_function;
+                width_scale = bpp;
+            }
         }
-        rect = &clipped;
+    }
 
-        pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
-                                         rect->x * dst->format->BytesPerPixel;
+    data.fill_function = fill_function;
+    data.pitch = dst->pitch;
+    data.color = color;
+    for (i = 0; i < num_clipped; ++i) {
+        rect = &clipped[i];
+        data.pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch + rect->x * bpp;
+        data.w = rect->w * width_scale;
+        SDL_RunBands(SDL_FillRectBand, &data, rect->w, rect->h);
+    }
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+    if (clipped != local_rects) {
+        SDL_free(clipped);
     }
 
     /* We're done! */
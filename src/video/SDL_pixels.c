@@ -125,6 +125,8 @@ SDL_GetPixelFormatName(Uint32 format)
     CASE(SDL_PIXELFORMAT_YVYU)
     CASE(SDL_PIXELFORMAT_NV12)
     CASE(SDL_PIXELFORMAT_NV21)
+    CASE(SDL_PIXELFORMAT_P010)
+    CASE(SDL_PIXELFORMAT_P016)
 #undef CASE
     default:
         return "SDL_PIXELFORMAT_UNKNOWN";
@@ -961,21 +963,15 @@ Map1to1(SDL_Palette * src, SDL_Palette * dst, int *identical)
 }
 
 /* Map from Palette to BitField */
-static Uint8 *
-Map1toN(SDL_PixelFormat * src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod, Uint8 Amod,
-        SDL_PixelFormat * dst)
+static void
+Fill1toN(Uint8 * map, SDL_PixelFormat * src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod, Uint8 Amod,
+         SDL_PixelFormat * dst)
 {
-    Uint8 *map;
     int i;
     int bpp;
     SDL_Palette *pal = src->palette;
 
     bpp = ((dst->BytesPerPixel == 3) ? 4 : dst->BytesPerPixel);
-    map = (Uint8 *) SDL_malloc(pal->ncolors * bpp);
-    if (map == NULL) {
-        SDL_OutOfMemory();
-        return (NULL);
-    }
 
     /* We memory copy to the pixel map so the endianness is preserved */
     for (i = 0; i < pal->ncolors; ++i) {
@@ -985,6 +981,23 @@ Map1toN(SDL_PixelFormat * src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod, Uint8 Amod,
         Uint8 A = (Uint8) ((pal->colors[i].a * Amod) / 255);
         ASSEMBLE_RGBA(&map[i * bpp], dst->BytesPerPixel, dst, R, G, B, A);
     }
+}
+
+static Uint8 *
+Map1toN(SDL_PixelFormat * src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod, Uint8 Amod,
+        SDL_PixelFormat * dst)
+{
+    Uint8 *map;
+    int bpp;
+    SDL_Palette *pal = src->palette;
+
+    bpp = ((dst->BytesPerPixel == 3) ? 4 : dst->BytesPerPixel);
+    map = (Uint8 *) SDL_malloc(pal->ncolors * bpp);
+    if (map == NULL) {
+        SDL_OutOfMemory();
+        return (NULL);
+    }
+    Fill1toN(map, src, Rmod, Gmod, Bmod, Amod, dst);
     return (map);
 }
 
@@ -1040,6 +1053,8 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->dst_palette_version = 0;
     SDL_free(map->info.table);
     map->info.table = NULL;
+    map->table_palette = NULL;
+    map->table_ncolors = 0;
 }
 
 int
@@ -1049,13 +1064,9 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Clear out any previous mapping, SDL_CalculateBlit() decides whether
+       an RLE encoding can be kept */
     map = src->map;
-#if SDL_HAVE_RLE
-    if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(src, 1);
-    }
-#endif
     SDL_InvalidateMap(map);
 
     /* Figure out what kind of mapping we're doing */
@@ -1082,6 +1093,8 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
             if (map->info.table == NULL) {
                 return (-1);
             }
+            map->table_palette = srcfmt->palette;
+            map->table_ncolors = srcfmt->palette->ncolors;
         }
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
@@ -1130,6 +1143,30 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     return (SDL_CalculateBlit(src));
 }
 
+/* A paletted source whose colors changed only needs its table filled again,
+   the table and the blitter chosen for it stay the same. This keeps palette
+   animation from reallocating the map and choosing the blit every frame.
+   A different palette, e.g. from SDL_SetPixelFormatPalette(), may not fit
+   in the table and needs a new map. */
+SDL_bool
+SDL_RemapSurfacePalette(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_BlitMap *map = src->map;
+
+    if (map->dst != dst || !map->info.table || !map->src_palette_version ||
+        (src->flags & SDL_RLEACCEL) ||
+        map->table_palette != src->format->palette ||
+        map->table_ncolors != src->format->palette->ncolors ||
+        !SDL_ISPIXELFORMAT_INDEXED(src->format->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(dst->format->format)) {
+        return SDL_FALSE;
+    }
+    Fill1toN((Uint8 *) map->info.table, src->format, map->info.r, map->info.g,
+             map->info.b, map->info.a, dst->format);
+    map->src_palette_version = src->format->palette->version;
+    return SDL_TRUE;
+}
+
 void
 SDL_FreeBlitMap(SDL_BlitMap * map)
 {
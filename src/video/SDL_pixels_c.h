@@ -35,6 +35,7 @@ extern int SDL_InitFormat(SDL_PixelFormat * format, Uint32 pixel_format);
 extern SDL_BlitMap *SDL_AllocBlitMap(void);
 extern void SDL_InvalidateMap(SDL_BlitMap * map);
 extern int SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst);
+extern SDL_bool SDL_RemapSurfacePalette(SDL_Surface * src, SDL_Surface * dst);
 extern void SDL_FreeBlitMap(SDL_BlitMap * map);
 
 /* Miscellaneous functions */
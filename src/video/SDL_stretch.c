@@ -196,22 +196,15 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
-/* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
-*/
-int
-SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
-                SDL_Surface * dst, const SDL_Rect * dstrect)
+static int
+SDL_LowerSoftStretchNearest(SDL_Surface * src, const SDL_Rect * srcrect,
+                            SDL_Surface * dst, const SDL_Rect * dstrect)
 {
-    int src_locked;
-    int dst_locked;
     int pos, inc;
     int dst_maxrow;
     int src_row, dst_row;
     Uint8 *srcp = NULL;
     Uint8 *dstp;
-    SDL_Rect full_src;
-    SDL_Rect full_dst;
 #ifdef USE_ASM_STRETCH
     SDL_bool use_asm = SDL_TRUE;
 #ifdef __GNUC__
@@ -220,58 +213,6 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 #endif /* USE_ASM_STRETCH */
     const int bpp = dst->format->BytesPerPixel;
 
-    if (src->format->format != dst->format->format) {
-        return SDL_SetError("Only works with same format surfaces");
-    }
-
-    /* Verify the blit rectangles */
-    if (srcrect) {
-        if ((srcrect->x < 0) || (srcrect->y < 0) ||
-            ((srcrect->x + srcrect->w) > src->w) ||
-            ((srcrect->y + srcrect->h) > src->h)) {
-            return SDL_SetError("Invalid source blit rectangle");
-        }
-    } else {
-        full_src.x = 0;
-        full_src.y = 0;
-        full_src.w = src->w;
-        full_src.h = src->h;
-        srcrect = &full_src;
-    }
-    if (dstrect) {
-        if ((dstrect->x < 0) || (dstrect->y < 0) ||
-            ((dstrect->x + dstrect->w) > dst->w) ||
-            ((dstrect->y + dstrect->h) > dst->h)) {
-            return SDL_SetError("Invalid destination blit rectangle");
-        }
-    } else {
-        full_dst.x = 0;
-        full_dst.y = 0;
-        full_dst.w = dst->w;
-        full_dst.h = dst->h;
-        dstrect = &full_dst;
-    }
-
-    /* Lock the destination if it's in hardware */
-    dst_locked = 0;
-    if (SDL_MUSTLOCK(dst)) {
-        if (SDL_LockSurface(dst) < 0) {
-            return SDL_SetError("Unable to lock destination surface");
-        }
-        dst_locked = 1;
-    }
-    /* Lock the source if it's in hardware */
-    src_locked = 0;
-    if (SDL_MUSTLOCK(src)) {
-        if (SDL_LockSurface(src) < 0) {
-            if (dst_locked) {
-                SDL_UnlockSurface(dst);
-            }
-            return SDL_SetError("Unable to lock source surface");
-        }
-        src_locked = 1;
-    }
-
     /* Set up the data... */
     pos = 0x10000;
     inc = (srcrect->h << 16) / dstrect->h;
@@ -339,6 +280,313 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
             }
         pos += inc;
     }
+    return 0;
+}
+
+/* Bilinear filtering of 32-bit pixels.
+
+   Sample positions are pixel centers mapped into the source, kept in 16.16
+   fixed point and clamped to the edges.  The two horizontal interpolations
+   and the vertical one each work on 8-bit channels with 8-bit weights and
+   round to nearest, so the SIMD versions below produce exactly the same
+   pixels as the C version.
+*/
+typedef struct
+{
+    int *x0;        /* left source column of each destination column */
+    int *x1;        /* right source column of each destination column */
+    int *frac;      /* weight of the right column, 0..255 */
+} SDL_StretchLinearColumns;
+
+static void
+SDL_StretchLinearPosition(int i, int src_size, int dst_size, int *p0, int *p1, int *frac)
+{
+    Sint64 pos = ((((Sint64)(2 * i + 1) * src_size) << 16) / (2 * dst_size)) - 0x8000;
+
+    if (pos < 0) {
+        pos = 0;
+    }
+    *p0 = (int)(pos >> 16);
+    *frac = (int)((pos >> 8) & 0xFF);
+    if (*p0 >= src_size - 1) {
+        *p0 = src_size - 1;
+        *frac = 0;
+    }
+    *p1 = (*p0 < src_size - 1) ? (*p0 + 1) : *p0;
+}
+
+static SDL_INLINE Uint32
+SDL_LerpPixel(Uint32 a, Uint32 b, int f)
+{
+    const Uint32 g = 256 - f;
+    /* Two channels at a time, each product fits in its 16-bit half */
+    const Uint32 rb = ((a & 0x00FF00FF) * g + (b & 0x00FF00FF) * f + 0x00800080) >> 8;
+    const Uint32 ag = ((a >> 8) & 0x00FF00FF) * g + ((b >> 8) & 0x00FF00FF) * f + 0x00800080;
+    return (rb & 0x00FF00FF) | (ag & 0xFF00FF00);
+}
+
+static void
+SDL_StretchRowLinear(const Uint32 *src0, const Uint32 *src1, Uint32 *dst,
+                     const SDL_StretchLinearColumns *cols, int start, int width, int fy)
+{
+    int i;
+
+    for (i = start; i < width; ++i) {
+        const int x0 = cols->x0[i];
+        const int x1 = cols->x1[i];
+        const int fx = cols->frac[i];
+        dst[i] = SDL_LerpPixel(SDL_LerpPixel(src0[x0], src0[x1], fx),
+                               SDL_LerpPixel(src1[x0], src1[x1], fx), fy);
+    }
+}
+
+#if SDL_SSE2_INTRINSICS
+static void
+SDL_StretchRowLinear_SSE2(const Uint32 *src0, const Uint32 *src1, Uint32 *dst,
+                          const SDL_StretchLinearColumns *cols, int width, int fy)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i f256 = _mm_set1_epi16(256);
+    const __m128i vfy = _mm_set1_epi16((short)fy);
+    const __m128i vgy = _mm_sub_epi16(f256, vfy);
+    int i;
+
+    for (i = 0; i + 4 <= width; i += 4) {
+        const int *x0 = &cols->x0[i];
+        const int *x1 = &cols->x1[i];
+        const int *fx = &cols->frac[i];
+        __m128i tl = _mm_setr_epi32(src0[x0[0]], src0[x0[1]], src0[x0[2]], src0[x0[3]]);
+        __m128i tr = _mm_setr_epi32(src0[x1[0]], src0[x1[1]], src0[x1[2]], src0[x1[3]]);
+        __m128i bl = _mm_setr_epi32(src1[x0[0]], src1[x0[1]], src1[x0[2]], src1[x0[3]]);
+        __m128i br = _mm_setr_epi32(src1[x1[0]], src1[x1[1]], src1[x1[2]], src1[x1[3]]);
+        __m128i f_lo = _mm_setr_epi16((short)fx[0], (short)fx[0], (short)fx[0], (short)fx[0],
+                                      (short)fx[1], (short)fx[1], (short)fx[1], (short)fx[1]);
+        __m128i f_hi = _mm_setr_epi16((short)fx[2], (short)fx[2], (short)fx[2], (short)fx[2],
+                                      (short)fx[3], (short)fx[3], (short)fx[3], (short)fx[3]);
+        __m128i g_lo = _mm_sub_epi16(f256, f_lo);
+        __m128i g_hi = _mm_sub_epi16(f256, f_hi);
+        __m128i top_lo, top_hi, bot_lo, bot_hi, out_lo, out_hi;
+
+        /* The products wrap as signed 16-bit values but the sums fit unsigned */
+        top_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(tl, zero), g_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(tr, zero), f_lo));
+        top_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(tl, zero), g_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(tr, zero), f_hi));
+        bot_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(bl, zero), g_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(br, zero), f_lo));
+        bot_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(bl, zero), g_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(br, zero), f_hi));
+        top_lo = _mm_srli_epi16(_mm_add_epi16(top_lo, round), 8);
+        top_hi = _mm_srli_epi16(_mm_add_epi16(top_hi, round), 8);
+        bot_lo = _mm_srli_epi16(_mm_add_epi16(bot_lo, round), 8);
+        bot_hi = _mm_srli_epi16(_mm_add_epi16(bot_hi, round), 8);
+
+        out_lo = _mm_add_epi16(_mm_mullo_epi16(top_lo, vgy), _mm_mullo_epi16(bot_lo, vfy));
+        out_hi = _mm_add_epi16(_mm_mullo_epi16(top_hi, vgy), _mm_mullo_epi16(bot_hi, vfy));
+        out_lo = _mm_srli_epi16(_mm_add_epi16(out_lo, round), 8);
+        out_hi = _mm_srli_epi16(_mm_add_epi16(out_hi, round), 8);
+
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packus_epi16(out_lo, out_hi));
+    }
+
+    SDL_StretchRowLinear(src0, src1, dst, cols, i, width, fy);
+}
+#endif /* SDL_SSE2_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+static SDL_TARGETING("avx2") void
+SDL_StretchRowLinear_AVX2(const Uint32 *src0, const Uint32 *src1, Uint32 *dst,
+                          const SDL_StretchLinearColumns *cols, int width, int fy)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    const __m256i f256 = _mm256_set1_epi16(256);
+    const __m256i vfy = _mm256_set1_epi16((short)fy);
+    const __m256i vgy = _mm256_sub_epi16(f256, vfy);
+    int i;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        const __m256i x0 = _mm256_loadu_si256((const __m256i *) &cols->x0[i]);
+        const __m256i x1 = _mm256_loadu_si256((const __m256i *) &cols->x1[i]);
+        const __m256i fx = _mm256_loadu_si256((const __m256i *) &cols->frac[i]);
+        const __m256i tl = _mm256_i32gather_epi32((const int *) src0, x0, 4);
+        const __m256i tr = _mm256_i32gather_epi32((const int *) src0, x1, 4);
+        const __m256i bl = _mm256_i32gather_epi32((const int *) src1, x0, 4);
+        const __m256i br = _mm256_i32gather_epi32((const int *) src1, x1, 4);
+        /* Spread each weight over the four 16-bit channels of its pixel,
+           matching the in-lane order of the byte unpacks below */
+        const __m256i fx2 = _mm256_or_si256(fx, _mm256_slli_epi32(fx, 16));
+        const __m256i f_lo = _mm256_unpacklo_epi32(fx2, fx2);
+        const __m256i f_hi = _mm256_unpackhi_epi32(fx2, fx2);
+        const __m256i g_lo = _mm256_sub_epi16(f256, f_lo);
+        const __m256i g_hi = _mm256_sub_epi16(f256, f_hi);
+        __m256i top_lo, top_hi, bot_lo, bot_hi, out_lo, out_hi;
+
+        top_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(tl, zero), g_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(tr, zero), f_lo));
+        top_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(tl, zero), g_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(tr, zero), f_hi));
+        bot_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(bl, zero), g_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(br, zero), f_lo));
+        bot_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(bl, zero), g_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(br, zero), f_hi));
+        top_lo = _mm256_srli_epi16(_mm256_add_epi16(top_lo, round), 8);
+        top_hi = _mm256_srli_epi16(_mm256_add_epi16(top_hi, round), 8);
+        bot_lo = _mm256_srli_epi16(_mm256_add_epi16(bot_lo, round), 8);
+        bot_hi = _mm256_srli_epi16(_mm256_add_epi16(bot_hi, round), 8);
+
+        out_lo = _mm256_add_epi16(_mm256_mullo_epi16(top_lo, vgy), _mm256_mullo_epi16(bot_lo, vfy));
+        out_hi = _mm256_add_epi16(_mm256_mullo_epi16(top_hi, vgy), _mm256_mullo_epi16(bot_hi, vfy));
+        out_lo = _mm256_srli_epi16(_mm256_add_epi16(out_lo, round), 8);
+        out_hi = _mm256_srli_epi16(_mm256_add_epi16(out_hi, round), 8);
+
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_packus_epi16(out_lo, out_hi));
+    }
+
+    SDL_StretchRowLinear(src0, src1, dst, cols, i, width, fy);
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+static int
+SDL_LowerSoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                           SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    SDL_StretchLinearColumns cols;
+    int *buffer;
+    int i, y0, y1, fy;
+    int simd = 0;
+
+    buffer = (int *) SDL_malloc(3 * dstrect->w * sizeof (int));
+    if (!buffer) {
+        return SDL_OutOfMemory();
+    }
+    cols.x0 = buffer;
+    cols.x1 = buffer + dstrect->w;
+    cols.frac = buffer + 2 * dstrect->w;
+    for (i = 0; i < dstrect->w; ++i) {
+        SDL_StretchLinearPosition(i, srcrect->w, dstrect->w, &cols.x0[i], &cols.x1[i], &cols.frac[i]);
+    }
+
+#if SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        simd = 2;
+    } else
+#endif
+#if SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        simd = 1;
+    }
+#endif
+
+    for (i = 0; i < dstrect->h; ++i) {
+        const Uint8 *src_pixels = (const Uint8 *) src->pixels + srcrect->x * 4;
+        const Uint32 *src0, *src1;
+        Uint32 *dstp;
+
+        SDL_StretchLinearPosition(i, srcrect->h, dstrect->h, &y0, &y1, &fy);
+        src0 = (const Uint32 *) (src_pixels + (srcrect->y + y0) * src->pitch);
+        src1 = (const Uint32 *) (src_pixels + (srcrect->y + y1) * src->pitch);
+        dstp = (Uint32 *) ((Uint8 *) dst->pixels + (dstrect->y + i) * dst->pitch + dstrect->x * 4);
+
+        switch (simd) {
+#if SDL_AVX2_INTRINSICS
+        case 2:
+            SDL_StretchRowLinear_AVX2(src0, src1, dstp, &cols, dstrect->w, fy);
+            break;
+#endif
+#if SDL_SSE2_INTRINSICS
+        case 1:
+            SDL_StretchRowLinear_SSE2(src0, src1, dstp, &cols, dstrect->w, fy);
+            break;
+#endif
+        default:
+            SDL_StretchRowLinear(src0, src1, dstp, &cols, 0, dstrect->w, fy);
+            break;
+        }
+    }
+
+    SDL_free(buffer);
+    return 0;
+}
+
+static int
+SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                     SDL_Surface * dst, const SDL_Rect * dstrect, SDL_bool linear)
+{
+    int src_locked;
+    int dst_locked;
+    int retval;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+
+    if (linear) {
+        if (src->format->BytesPerPixel != 4 || SDL_ISPIXELFORMAT_INDEXED(src->format->format)) {
+            return SDL_SetError("Linear scaling only works with 32-bit surfaces");
+        }
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+
+    if (dstrect->w <= 0 || dstrect->h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return 0;
+    }
+
+    /* Lock the destination if it's in hardware */
+    dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            return SDL_SetError("Unable to lock destination surface");
+        }
+        dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+    if (linear) {
+        retval = SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect);
+    } else {
+        retval = SDL_LowerSoftStretchNearest(src, srcrect, dst, dstrect);
+    }
 
     /* We need to unlock the surfaces if they're locked */
     if (dst_locked) {
@@ -347,7 +595,27 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     if (src_locked) {
         SDL_UnlockSurface(src);
     }
-    return (0);
+    return retval;
+}
+
+/* Perform a stretch blit between two surfaces of the same format.
+   NOTE:  This function is not safe to call from multiple threads!
+*/
+int
+SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    return SDL_UpperSoftStretch(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+/* Perform a bilinear filtered stretch blit between two 32-bit surfaces of
+   the same format.  Unlike SDL_SoftStretch() this is thread-safe.
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    return SDL_UpperSoftStretch(src, srcrect, dst, dstrect, SDL_TRUE);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
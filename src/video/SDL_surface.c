@@ -51,6 +51,181 @@ SDL_CalculatePitch(Uint32 format, int width)
     return pitch;
 }
 
+/*
+ * Pool of released pixel buffers, keyed by size and pixel format.
+ *
+ * Each entry owns a SIMD aligned pixel buffer and a reference to the pixel
+ * format it was created with, so a surface created with the same size and
+ * format picks both back up without going through the allocator.  Entries are
+ * kept most recently released first and evicted from the tail.
+ */
+typedef struct SDL_SurfacePoolEntry
+{
+    int w, h;
+    SDL_PixelFormat *format;
+    void *pixels;
+    size_t size;
+    struct SDL_SurfacePoolEntry *next;
+} SDL_SurfacePoolEntry;
+
+#define SDL_SURFACE_POOL_MAX_ENTRIES    256
+
+static SDL_SpinLock SDL_surface_pool_lock;
+static SDL_SurfacePoolEntry *SDL_surface_pool;
+static size_t SDL_surface_pool_size;
+static size_t SDL_surface_pool_limit;
+static int SDL_surface_pool_count;
+
+static void
+SDL_FreeSurfacePoolEntries(SDL_SurfacePoolEntry *entry)
+{
+    while (entry) {
+        SDL_SurfacePoolEntry *next = entry->next;
+        SDL_FreeFormat(entry->format);
+        SDL_SIMDFree(entry->pixels);
+        SDL_free(entry);
+        entry = next;
+    }
+}
+
+/* Unlink entries past the given size and return them, call with the lock held */
+static SDL_SurfacePoolEntry *
+SDL_EvictSurfacePoolEntries(size_t size, int count)
+{
+    SDL_SurfacePoolEntry **prev = &SDL_surface_pool;
+    SDL_SurfacePoolEntry *evicted;
+    size_t kept = 0;
+    int n = 0;
+
+    while (*prev && kept + (*prev)->size <= size && n < count) {
+        kept += (*prev)->size;
+        ++n;
+        prev = &(*prev)->next;
+    }
+    evicted = *prev;
+    *prev = NULL;
+    SDL_surface_pool_size = kept;
+    SDL_surface_pool_count = n;
+    return evicted;
+}
+
+static void *
+SDL_TakePooledPixels(int width, int height, Uint32 format, SDL_PixelFormat **pformat)
+{
+    SDL_SurfacePoolEntry **prev;
+    SDL_SurfacePoolEntry *entry = NULL;
+    void *pixels;
+
+    if (!SDL_surface_pool) {
+        return NULL;
+    }
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    for (prev = &SDL_surface_pool; *prev; prev = &(*prev)->next) {
+        if ((*prev)->w == width && (*prev)->h == height &&
+            (*prev)->format->format == format) {
+            entry = *prev;
+            *prev = entry->next;
+            SDL_surface_pool_size -= entry->size;
+            --SDL_surface_pool_count;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    if (!entry) {
+        return NULL;
+    }
+    *pformat = entry->format;
+    pixels = entry->pixels;
+    SDL_free(entry);
+    return pixels;
+}
+
+/* Hand the pixels and format of a surface being freed over to the pool */
+static SDL_bool
+SDL_PoolSurfacePixels(SDL_Surface * surface)
+{
+    SDL_SurfacePoolEntry *entry;
+    SDL_SurfacePoolEntry *evicted;
+    size_t size;
+
+    if (!SDL_surface_pool_limit || !surface->pixels ||
+        (surface->flags & (SDL_PREALLOC | SDL_SIMD_ALIGNED)) != SDL_SIMD_ALIGNED ||
+        surface->pitch != SDL_CalculatePitch(surface->format->format, surface->w)) {
+        return SDL_FALSE;
+    }
+
+    size = (size_t)surface->h * surface->pitch;
+    if (size > SDL_surface_pool_limit) {
+        return SDL_FALSE;
+    }
+
+    entry = (SDL_SurfacePoolEntry *) SDL_malloc(sizeof(*entry));
+    if (!entry) {
+        return SDL_FALSE;
+    }
+    entry->w = surface->w;
+    entry->h = surface->h;
+    entry->format = surface->format;
+    entry->pixels = surface->pixels;
+    entry->size = size;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    entry->next = SDL_surface_pool;
+    SDL_surface_pool = entry;
+    SDL_surface_pool_size += size;
+    ++SDL_surface_pool_count;
+    evicted = NULL;
+    if (SDL_surface_pool_size > SDL_surface_pool_limit ||
+        SDL_surface_pool_count > SDL_SURFACE_POOL_MAX_ENTRIES) {
+        evicted = SDL_EvictSurfacePoolEntries(SDL_surface_pool_limit, SDL_SURFACE_POOL_MAX_ENTRIES);
+    }
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreeSurfacePoolEntries(evicted);
+
+    surface->format = NULL;
+    surface->pixels = NULL;
+    return SDL_TRUE;
+}
+
+void
+SDL_SetSurfacePoolLimit(size_t limit)
+{
+    SDL_SurfacePoolEntry *evicted;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    SDL_surface_pool_limit = limit;
+    evicted = SDL_EvictSurfacePoolEntries(limit, SDL_SURFACE_POOL_MAX_ENTRIES);
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreeSurfacePoolEntries(evicted);
+}
+
+void
+SDL_TrimSurfacePool(size_t size)
+{
+    SDL_SurfacePoolEntry *evicted;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    evicted = SDL_EvictSurfacePoolEntries(size, SDL_SURFACE_POOL_MAX_ENTRIES);
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreeSurfacePoolEntries(evicted);
+}
+
+size_t
+SDL_GetSurfacePoolSize(void)
+{
+    size_t size;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    size = SDL_surface_pool_size;
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+    return size;
+}
+
 /*
  * Create an empty RGB surface of the appropriate depth using the given
  * enum SDL_PIXELFORMAT_* format
@@ -79,7 +254,12 @@ SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height, int depth,
         return NULL;
     }
 
-    surface->format = SDL_AllocFormat(format);
+    surface->pixels = SDL_TakePooledPixels(width, height, format, &surface->format);
+    if (surface->pixels) {
+        surface->flags |= SDL_SIMD_ALIGNED;
+    } else {
+        surface->format = SDL_AllocFormat(format);
+    }
     if (!surface->format) {
         SDL_FreeSurface(surface);
         return NULL;
@@ -120,13 +300,15 @@ SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height, int depth,
             return NULL;
         }
 
-        surface->pixels = SDL_SIMDAlloc((size_t)size);
         if (!surface->pixels) {
-            SDL_FreeSurface(surface);
-            SDL_OutOfMemory();
-            return NULL;
+            surface->pixels = SDL_SIMDAlloc((size_t)size);
+            if (!surface->pixels) {
+                SDL_FreeSurface(surface);
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            surface->flags |= SDL_SIMD_ALIGNED;
         }
-        surface->flags |= SDL_SIMD_ALIGNED;
         /* This is important for bitmaps */
         SDL_memset(surface->pixels, 0, surface->h * surface->pitch);
     }
@@ -249,6 +431,87 @@ SDL_SetSurfaceRLE(SDL_Surface * surface, int flag)
     return 0;
 }
 
+int
+SDL_PrepareSurfaceRLE(SDL_Surface * surface, Uint32 format)
+{
+#if SDL_HAVE_RLE
+    SDL_Surface *dst;
+    int retval;
+
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+
+    /* An empty surface stands in for the destination of the first blit */
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 0, 0, 0, format);
+    if (!dst) {
+        return -1;
+    }
+    if (surface->format->palette && dst->format->palette &&
+        dst->format->format == surface->format->format) {
+        /* Paletted surfaces are encoded for blitting onto the same palette */
+        SDL_SetSurfacePalette(dst, surface->format->palette);
+    }
+
+    SDL_SetSurfaceRLE(surface, 1);
+    retval = SDL_MapSurface(surface, dst);
+    if (retval == 0 && !(surface->flags & SDL_RLEACCEL)) {
+        retval = SDL_SetError("Surface can't be RLE encoded for this format");
+    }
+
+    /* The encoding is kept when the surface is mapped to a real destination */
+    SDL_InvalidateMap(surface->map);
+    SDL_FreeSurface(dst);
+    return retval;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
+int
+SDL_SaveRLE_RW(SDL_Surface * surface, SDL_RWops * dst, int freedst)
+{
+    int retval;
+
+    if (!dst) {
+        return -1;
+    }
+    if (!surface) {
+        retval = SDL_InvalidParamError("surface");
+    } else {
+#if SDL_HAVE_RLE
+        retval = SDL_WriteRLESurface(surface, dst);
+#else
+        retval = SDL_Unsupported();
+#endif
+    }
+    if (freedst) {
+        SDL_RWclose(dst);
+    }
+    return retval;
+}
+
+SDL_Surface *
+SDL_LoadRLE_RW(SDL_RWops * src, int freesrc)
+{
+    SDL_Surface *surface;
+
+    if (!src) {
+        SDL_SetError("NULL RWops");
+        return NULL;
+    }
+#if SDL_HAVE_RLE
+    surface = SDL_ReadRLESurface(src);
+#else
+    SDL_Unsupported();
+    surface = NULL;
+#endif
+    if (freesrc) {
+        SDL_RWclose(src);
+    }
+    return surface;
+}
+
 int
 SDL_SetColorKey(SDL_Surface * surface, int flag, Uint32 key)
 {
@@ -267,6 +530,16 @@ SDL_SetColorKey(SDL_Surface * surface, int flag, Uint32 key)
     }
 
     flags = surface->map->info.flags;
+
+#if SDL_HAVE_RLE
+    /* A colorkey encoding has to be decoded with the key it was made with */
+    if ((surface->flags & SDL_RLEACCEL) &&
+        (surface->map->info.flags & SDL_COPY_RLE_COLORKEY) &&
+        (!flag || key != surface->map->info.colorkey)) {
+        SDL_UnRLESurface(surface, 1);
+    }
+#endif
+
     if (flag) {
         surface->map->info.flags |= SDL_COPY_COLORKEY;
         surface->map->info.colorkey = key;
@@ -503,13 +776,17 @@ SDL_SetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode blendMode)
     status = 0;
     flags = surface->map->info.flags;
     surface->map->info.flags &=
-        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+        ~(SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED |
+          SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
     switch (blendMode) {
     case SDL_BLENDMODE_NONE:
         break;
     case SDL_BLENDMODE_BLEND:
         surface->map->info.flags |= SDL_COPY_BLEND;
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        surface->map->info.flags |= SDL_COPY_BLEND_PREMULTIPLIED;
+        break;
     case SDL_BLENDMODE_ADD:
         surface->map->info.flags |= SDL_COPY_ADD;
         break;
@@ -543,10 +820,14 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     }
 
     switch (surface->map->
-            info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+            info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED |
+                          SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
     case SDL_COPY_BLEND:
         *blendMode = SDL_BLENDMODE_BLEND;
         break;
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        *blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+        break;
     case SDL_COPY_ADD:
         *blendMode = SDL_BLENDMODE_ADD;
         break;
@@ -616,7 +897,7 @@ SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
          src->map->dst_palette_version != dst->format->palette->version) ||
         (src->format->palette &&
          src->map->src_palette_version != src->format->palette->version)) {
-        if (SDL_MapSurface(src, dst) < 0) {
+        if (!SDL_RemapSurfacePalette(src, dst) && SDL_MapSurface(src, dst) < 0) {
             return (-1);
         }
         /* just here for debugging */
@@ -731,6 +1012,13 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateUpperBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+int
+SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     double src_x0, src_y0, src_x1, src_y1;
     double dst_x0, dst_y0, dst_x1, dst_y1;
@@ -875,7 +1163,7 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
         return 0;
     }
 
-    return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
+    return SDL_PrivateLowerBlitScaled(src, &final_src, dst, &final_dst, linear);
 }
 
 /**
@@ -885,13 +1173,74 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
                 SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+/* Filter into a temporary surface of the source format, then let the
+ * regular blitter take care of blending, modulation and conversion.
+ */
+static int
+SDL_LowerBlitScaledLinear(SDL_Surface * src, SDL_Rect * srcrect,
+                          SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_Surface *tmp;
+    SDL_Rect tmp_rect;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    Uint32 colorkey = 0;
+    int retval;
+
+    tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h,
+                                         src->format->BitsPerPixel, src->format->format);
+    if (!tmp) {
+        return -1;
+    }
+
+    retval = SDL_SoftStretchLinear(src, srcrect, tmp, NULL);
+    if (retval == 0) {
+        SDL_GetSurfaceBlendMode(src, &blendMode);
+        SDL_GetSurfaceColorMod(src, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(src, &a);
+        SDL_SetSurfaceBlendMode(tmp, blendMode);
+        SDL_SetSurfaceColorMod(tmp, r, g, b);
+        SDL_SetSurfaceAlphaMod(tmp, a);
+        if (SDL_GetColorKey(src, &colorkey) == 0) {
+            SDL_SetColorKey(tmp, SDL_TRUE, colorkey);
+        }
+        tmp_rect.x = 0;
+        tmp_rect.y = 0;
+        tmp_rect.w = dstrect->w;
+        tmp_rect.h = dstrect->h;
+        retval = SDL_LowerBlit(tmp, &tmp_rect, dst, dstrect);
+    }
+    SDL_FreeSurface(tmp);
+    return retval;
+}
+
+int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
-        SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL |
+        SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED |
+        SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL |
         SDL_COPY_COLORKEY
     );
 
+    /* Only 32-bit formats can be filtered, everything else is scaled with nearest sampling */
+    if (linear &&
+        src->format->BytesPerPixel == 4 && !SDL_ISPIXELFORMAT_INDEXED(src->format->format) &&
+        !SDL_ISPIXELFORMAT_FOURCC(src->format->format)) {
+        if ( !(src->map->info.flags & complex_copy_flags) &&
+             src->format->format == dst->format->format ) {
+            return SDL_SoftStretchLinear( src, srcrect, dst, dstrect );
+        } else {
+            return SDL_LowerBlitScaledLinear( src, srcrect, dst, dstrect );
+        }
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -1179,10 +1528,12 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_SetClipRect(convert, &surface->clip_rect);
 
     /* Enable alpha blending by default if the new surface has an
-     * alpha channel or alpha modulation */
-    if ((surface->format->Amask && format->Amask) ||
-        (palette_has_alpha && format->Amask) ||
-        (copy_flags & SDL_COPY_MODULATE_ALPHA)) {
+     * alpha channel or alpha modulation, unless the pixels were
+     * already premultiplied and keep blending that way */
+    if (!(copy_flags & SDL_COPY_BLEND_PREMULTIPLIED) &&
+        ((surface->format->Amask && format->Amask) ||
+         (palette_has_alpha && format->Amask) ||
+         (copy_flags & SDL_COPY_MODULATE_ALPHA))) {
         SDL_SetSurfaceBlendMode(convert, SDL_BLENDMODE_BLEND);
     }
     if ((copy_flags & SDL_COPY_RLE_DESIRED) || (flags & SDL_RLEACCEL)) {
@@ -1247,6 +1598,29 @@ SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
     return SDL_TRUE;
 }
 
+typedef struct
+{
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *dst;
+    int dst_pitch;
+    int length;
+} SDL_CopyPixelsData;
+
+static void
+SDL_CopyPixelsBand(void *userdata, int y, int h)
+{
+    const SDL_CopyPixelsData *data = (const SDL_CopyPixelsData *) userdata;
+    const Uint8 *src = data->src + y * data->src_pitch;
+    Uint8 *dst = data->dst + y * data->dst_pitch;
+
+    while (h--) {
+        SDL_memcpy(dst, src, data->length);
+        src += data->src_pitch;
+        dst += data->dst_pitch;
+    }
+}
+
 /*
  * Copy a block of pixels of one format to another format
  */
@@ -1285,14 +1659,13 @@ int SDL_ConvertPixels(int width, int height,
 
     /* Fast path for same format copy */
     if (src_format == dst_format) {
-        int i;
-        const int bpp = SDL_BYTESPERPIXEL(src_format);
-        width *= bpp;
-        for (i = height; i--;) {
-            SDL_memcpy(dst, src, width);
-            src = (const Uint8*)src + src_pitch;
-            dst = (Uint8*)dst + dst_pitch;
-        }
+        SDL_CopyPixelsData data;
+        data.src = (const Uint8 *) src;
+        data.src_pitch = src_pitch;
+        data.dst = (Uint8 *) dst;
+        data.dst_pitch = dst_pitch;
+        data.length = width * SDL_BYTESPERPIXEL(src_format);
+        SDL_RunBands(SDL_CopyPixelsBand, &data, width, height);
         return 0;
     }
 
@@ -1314,6 +1687,155 @@ int SDL_ConvertPixels(int width, int height,
     return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
 }
 
+/* The position of alpha in the 8888 formats premultiplied in place */
+static int
+SDL_GetPremultiplyAlphaShift(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return 24;
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+typedef struct
+{
+    Uint8 *pixels;
+    int pitch;
+    int width;
+    int Ashift;
+} SDL_PremultiplyData;
+
+static void
+SDL_PremultiplyBand(void *userdata, int y, int h)
+{
+    const SDL_PremultiplyData *data = (const SDL_PremultiplyData *) userdata;
+    const int Ashift = data->Ashift;
+    Uint8 *row = data->pixels + y * data->pitch;
+
+    while (h--) {
+        Uint32 *pixel = (Uint32 *) row;
+        int n;
+
+        for (n = data->width; n--; ++pixel) {
+            const Uint32 a = (*pixel >> Ashift) & 0xFF;
+            Uint32 result;
+            int shift;
+
+            if (a == 0xFF) {
+                continue;
+            }
+            /* This rounds like the straight alpha blitters, so blending
+               the result is the same as blending the original pixels */
+            result = a << Ashift;
+            for (shift = 0; shift < 32; shift += 8) {
+                if (shift != Ashift) {
+                    result |= ((((*pixel >> shift) & 0xFF) * a) / 255) << shift;
+                }
+            }
+            *pixel = result;
+        }
+        row += data->pitch;
+    }
+}
+
+/*
+ * Premultiply the alpha on a block of pixels, converting to 8888 if needed
+ */
+int SDL_PremultiplyAlpha(int width, int height,
+                         Uint32 src_format, const void * src, int src_pitch,
+                         Uint32 dst_format, void * dst, int dst_pitch)
+{
+    SDL_PremultiplyData data;
+    void *tmp = NULL;
+    int status = 0;
+
+    if (!src) {
+        return SDL_InvalidParamError("src");
+    }
+    if (!src_pitch) {
+        return SDL_InvalidParamError("src_pitch");
+    }
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (!dst_pitch) {
+        return SDL_InvalidParamError("dst_pitch");
+    }
+    if (src == dst && (src_format != dst_format || src_pitch != dst_pitch)) {
+        /* Converting would overwrite pixels before they are read */
+        return SDL_SetError("In place premultiplying needs the same format and pitch");
+    }
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    data.width = width;
+    data.Ashift = SDL_GetPremultiplyAlphaShift(dst_format);
+    if (data.Ashift >= 0) {
+        /* Premultiply in the destination, src == dst needs no conversion */
+        if (src != dst &&
+            SDL_ConvertPixels(width, height, src_format, src, src_pitch,
+                              dst_format, dst, dst_pitch) < 0) {
+            return -1;
+        }
+        data.pixels = (Uint8 *) dst;
+        data.pitch = dst_pitch;
+        SDL_RunBands(SDL_PremultiplyBand, &data, width, height);
+        return 0;
+    }
+
+    /* Premultiply in an ARGB8888 copy */
+    tmp = SDL_malloc((size_t) width * height * 4);
+    if (!tmp) {
+        return SDL_OutOfMemory();
+    }
+    data.pixels = (Uint8 *) tmp;
+    data.pitch = width * 4;
+    data.Ashift = 24;
+    status = SDL_ConvertPixels(width, height, src_format, src, src_pitch,
+                               SDL_PIXELFORMAT_ARGB8888, tmp, data.pitch);
+    if (status == 0) {
+        SDL_RunBands(SDL_PremultiplyBand, &data, width, height);
+        status = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888,
+                                   tmp, data.pitch, dst_format, dst, dst_pitch);
+    }
+    SDL_free(tmp);
+    return status;
+}
+
+int
+SDL_PremultiplySurfaceAlpha(SDL_Surface * surface)
+{
+    int status;
+
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+    if (!surface->format->Amask) {
+        return SDL_SetError("Surface doesn't have an alpha channel");
+    }
+
+    if (SDL_LockSurface(surface) < 0) {
+        return -1;
+    }
+    status = SDL_PremultiplyAlpha(surface->w, surface->h,
+                                  surface->format->format,
+                                  surface->pixels, surface->pitch,
+                                  surface->format->format,
+                                  surface->pixels, surface->pitch);
+    SDL_UnlockSurface(surface);
+    if (status < 0) {
+        return status;
+    }
+    return SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+}
+
 /*
  * Free a surface created by the above function.
  */
@@ -1341,8 +1863,10 @@ SDL_FreeSurface(SDL_Surface * surface)
 #endif
     if (surface->format) {
         SDL_SetSurfacePalette(surface, NULL);
-        SDL_FreeFormat(surface->format);
-        surface->format = NULL;
+        if (!SDL_PoolSurfacePixels(surface)) {
+            SDL_FreeFormat(surface->format);
+            surface->format = NULL;
+        }
     }
     if (surface->flags & SDL_PREALLOC) {
         /* Don't free */
@@ -20,13 +20,25 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_cpuinfo.h"
 #include "SDL_endian.h"
 #include "SDL_video.h"
+#include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
+/* The SIMD RGB to YUV conversions match the scalar ones only if multiplies
+   and adds aren't fused into FMA instructions, see SDL_RGB2YUV_SIMD */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#elif defined(_MSC_VER)
+#pragma fp_contract (off)
+#endif
+
 #define SDL_YUV_SD_THRESHOLD    576
 
 
@@ -91,6 +103,12 @@ static SDL_bool IsPacked4Format(Uint32 format)
             format == SDL_PIXELFORMAT_YVYU);
 }
 
+static SDL_bool IsP01xFormat(Uint32 format)
+{
+    return (format == SDL_PIXELFORMAT_P010 ||
+            format == SDL_PIXELFORMAT_P016);
+}
+
 static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, int yuv_pitch,
                         const Uint8 **y, const Uint8 **u, const Uint8 **v, Uint32 *y_stride, Uint32 *uv_stride)
 {
@@ -120,6 +138,13 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         planes[0] = (const Uint8 *)yuv;
         planes[1] = planes[0] + pitches[0] * height;
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        pitches[0] = yuv_pitch;
+        pitches[1] = 4 * ((pitches[0] + 3) / 4);
+        planes[0] = (const Uint8 *)yuv;
+        planes[1] = planes[0] + pitches[0] * height;
+        break;
     default:
         return SDL_SetError("GetYUVPlanes(): Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
     }
@@ -174,6 +199,14 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         *u = *v + 1;
         *uv_stride = pitches[1];
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        *y = planes[0];
+        *y_stride = pitches[0];
+        *u = planes[1];
+        *v = *u + 2;
+        *uv_stride = pitches[1];
+        break;
     default:
         /* Should have caught this above */
         return SDL_SetError("GetYUVPlanes[2]: Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
@@ -181,15 +214,193 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
+/* Converts rows y to y + h of a width x height frame. YUV destinations are
+   passed as the whole frame, RGB destinations start at row y. */
+typedef void (*SDL_YUVBandFunc)(int width, int height, int y, int h,
+                                Uint32 src_format, const void *src, int src_pitch,
+                                Uint32 dst_format, void *dst, int dst_pitch);
+
+typedef struct
+{
+    SDL_YUVBandFunc func;
+    int width;
+    int height;
+    int y;          /* the range of rows to convert */
+    int h;
+    int rows;       /* the bands start on a multiple of this */
+    Uint32 src_format;
+    const void *src;
+    int src_pitch;
+    Uint32 dst_format;
+    void *dst;
+    int dst_pitch;
+} SDL_YUVBandData;
+
+static void
+SDL_YUVBand(void *userdata, int y, int h)
+{
+    const SDL_YUVBandData *data = (const SDL_YUVBandData *)userdata;
+    const int y1 = data->y + y * data->rows;
+    const int y2 = SDL_min(data->y + (y + h) * data->rows, data->y + data->h);
+    void *dst = data->dst;
+
+    if (!SDL_ISPIXELFORMAT_FOURCC(data->dst_format)) {
+        dst = (Uint8 *)dst + (y1 - data->y) * data->dst_pitch;
+    }
+    data->func(data->width, data->height, y1, y2 - y1,
+               data->src_format, data->src, data->src_pitch,
+               data->dst_format, dst, data->dst_pitch);
+}
+
+/* Runs a conversion of rows y to y + h in bands on the SDL_RunBands()
+   threads. With vertically subsampled chroma y must be even and the bands
+   start on even rows, so each band reads and writes whole chroma rows and
+   only the last one has an odd row. */
+static void
+SDL_RunYUVBands(SDL_YUVBandFunc func, int width, int height, int y, int h,
+                Uint32 src_format, const void *src, int src_pitch,
+                Uint32 dst_format, void *dst, int dst_pitch)
+{
+    SDL_YUVBandData data;
+
+    data.func = func;
+    data.width = width;
+    data.height = height;
+    data.y = y;
+    data.h = h;
+    data.rows = (IsPlanar2x2Format(src_format) || IsPlanar2x2Format(dst_format) || IsP01xFormat(src_format)) ? 2 : 1;
+    data.src_format = src_format;
+    data.src = src;
+    data.src_pitch = src_pitch;
+    data.dst_format = dst_format;
+    data.dst = dst;
+    data.dst_pitch = dst_pitch;
+    SDL_RunBands(SDL_YUVBand, &data, width, (h + data.rows - 1) / data.rows);
+}
+
+static SDL_bool yuv_rgb_avx2(
+    int features, Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height, 
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
+    Uint8 *rgb, Uint32 rgb_stride, 
+    YCbCrType yuv_type)
+{
+#if SDL_AVX2_INTRINSICS
+    if (!(features & SDL_CPU_AVX2)) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_sse(
-    Uint32 src_format, Uint32 dst_format,
+    int features, Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height, 
     const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
     Uint8 *rgb, Uint32 rgb_stride, 
     YCbCrType yuv_type)
 {
+#if SDL_AVX2_INTRINSICS
+    if (yuv_rgb_avx2(features, src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+#endif
 #ifdef __SSE2__
-    if (!SDL_HasSSE2()) {
+    if (!(features & SDL_CPU_SSE2)) {
         return SDL_FALSE;
     }
 
@@ -290,6 +501,30 @@ static SDL_bool yuv_rgb_sse(
     return SDL_FALSE;
 }
 
+/* Whether yuv_rgb_sse() and yuv_rgb_std() handle this conversion */
+static SDL_bool yuv_rgb_supported(Uint32 src_format, Uint32 dst_format)
+{
+    if (!IsPlanar2x2Format(src_format) && !IsPacked4Format(src_format)) {
+        return SDL_FALSE;
+    }
+
+    switch (dst_format) {
+    case SDL_PIXELFORMAT_RGB565:
+    case SDL_PIXELFORMAT_RGB24:
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
 static SDL_bool yuv_rgb_std(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height, 
@@ -393,8 +628,303 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+static void
+SDL_ConvertPixels_YUV_to_RGB_Band(int width, int height, int row, int rows,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const Uint8 *y = NULL;
+    const Uint8 *u = NULL;
+    const Uint8 *v = NULL;
+    Uint32 y_stride = 0;
+    Uint32 uv_stride = 0;
+    YCbCrType yuv_type = YCBCR_601;
+    Uint8 *rgb = (Uint8 *)dst;
+
+    /* Checked by SDL_ConvertPixels_YUV_to_RGB() before starting */
+    GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride);
+    GetYUVConversionType(width, height, &yuv_type);
+
+    y += row * y_stride;
+    if (IsPlanar2x2Format(src_format)) {
+        u += (row / 2) * uv_stride;
+        v += (row / 2) * uv_stride;
+    } else {
+        u += row * uv_stride;
+        v += row * uv_stride;
+    }
+
+    if (!yuv_rgb_sse(SDL_GetBlitCPUFeatures(), src_format, dst_format, width, rows, y, u, v, y_stride, uv_stride, rgb, dst_pitch, yuv_type)) {
+        yuv_rgb_std(src_format, dst_format, width, rows, y, u, v, y_stride, uv_stride, rgb, dst_pitch, yuv_type);
+    }
+}
+
+/* P010 and P016 keep their samples in the high bits of little endian 16 bit
+   words, both are converted from the top 10 bits. The factors are scaled by
+   1 << 13 and give 10 bit RGB values. */
+struct YUV2RGB10Factors
+{
+    Sint16 y_offset;
+    Sint16 y_factor;
+    Sint16 v_r_factor;
+    Sint16 u_g_factor;
+    Sint16 v_g_factor;
+    Sint16 u_b_factor;
+};
+
+static const struct YUV2RGB10Factors YUV2RGB10FactorTables[] =
+{
+    /* ITU-T T.871 (JPEG) */
+    { 0, 8192, 11485, -2819, -5850, 14516 },
+    /* ITU-R BT.601-7 */
+    { 64, 9567, 13113, -3219, -6679, 16574 },
+    /* ITU-R BT.709-6 */
+    { 64, 9567, 14729, -1752, -4378, 17356 },
+};
+
+/* Two rows of P010 or P016 are narrowed to NV12 this many pixels at a time */
+#define P01X_BLOCK_WIDTH    512
+
+#define P01X_CLAMP(x) (Uint32)((x) < 0 ? 0 : ((x) > 1023 ? 1023 : (x)))
+
+static void
+P01x_to_ARGB2101010_Std(const struct YUV2RGB10Factors *cvt, const Uint16 *src_y, const Uint16 *src_uv, Uint32 *dst, int x, int width)
+{
+    for (; x < width; ++x) {
+        const int y = ((SDL_SwapLE16(src_y[x]) >> 6) - cvt->y_offset) * cvt->y_factor + (1 << 12);
+        const int u = (SDL_SwapLE16(src_uv[x & ~1]) >> 6) - 512;
+        const int v = (SDL_SwapLE16(src_uv[(x & ~1) + 1]) >> 6) - 512;
+        const int r = (y + v * cvt->v_r_factor) >> 13;
+        const int g = (y + u * cvt->u_g_factor + v * cvt->v_g_factor) >> 13;
+        const int b = (y + u * cvt->u_b_factor) >> 13;
+
+        dst[x] = 0xC0000000 | (P01X_CLAMP(r) << 20) | (P01X_CLAMP(g) << 10) | P01X_CLAMP(b);
+    }
+}
+
+static void
+P01x_to_8bit_Std(const Uint16 *src, Uint8 *dst, int i, int count)
+{
+    for (; i < count; ++i) {
+        const Uint16 value = SDL_SwapLE16(src[i]);
+        dst[i] = (value >= 0xFF80) ? 0xFF : (Uint8)((value + 0x80) >> 8);
+    }
+}
+
+/* The SIMD versions below give the same results as the functions above, they
+   convert as much of the row as they can and return the number of values done */
+#ifdef __SSE2__
+static __m128i
+PackARGB2101010_SSE2(__m128i r, __m128i g, __m128i b)
+{
+    return _mm_or_si128(_mm_or_si128(_mm_set1_epi32((int)0xC0000000), _mm_slli_epi32(r, 20)),
+                        _mm_or_si128(_mm_slli_epi32(g, 10), b));
+}
+
+/* Adds the chroma of 8 pixels to their scaled luma in y_lo and y_hi */
+#define P01X_CHANNEL_SSE2(factor) \
+    _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32( \
+        _mm_srai_epi32(_mm_add_epi32(y_lo, _mm_madd_epi16(uv_lo, factor)), 13), \
+        _mm_srai_epi32(_mm_add_epi32(y_hi, _mm_madd_epi16(uv_hi, factor)), 13)), zero), max)
+
+static int
+P01x_to_ARGB2101010_Row_SSE2(const struct YUV2RGB10Factors *cvt, const Uint16 *src_y, const Uint16 *src_uv, Uint32 *dst, int width)
+{
+    /* Each 32 bit lane multiplies [Y, 1] or [U, V] with a pair of factors */
+    const __m128i y_factor = _mm_unpacklo_epi16(_mm_set1_epi16(cvt->y_factor), _mm_set1_epi16(1 << 12));
+    const __m128i r_factor = _mm_unpacklo_epi16(_mm_setzero_si128(), _mm_set1_epi16(cvt->v_r_factor));
+    const __m128i g_factor = _mm_unpacklo_epi16(_mm_set1_epi16(cvt->u_g_factor), _mm_set1_epi16(cvt->v_g_factor));
+    const __m128i b_factor = _mm_unpacklo_epi16(_mm_set1_epi16(cvt->u_b_factor), _mm_setzero_si128());
+    const __m128i y_offset = _mm_set1_epi16(cvt->y_offset);
+    const __m128i uv_offset = _mm_set1_epi16(512);
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(1023);
+    int i;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        const __m128i y = _mm_sub_epi16(_mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src_y + i)), 6), y_offset);
+        const __m128i uv = _mm_sub_epi16(_mm_srli_epi16(_mm_loadu_si128((const __m128i *)(src_uv + i)), 6), uv_offset);
+        const __m128i y_lo = _mm_madd_epi16(_mm_unpacklo_epi16(y, one), y_factor);
+        const __m128i y_hi = _mm_madd_epi16(_mm_unpackhi_epi16(y, one), y_factor);
+        const __m128i uv_lo = _mm_unpacklo_epi32(uv, uv);
+        const __m128i uv_hi = _mm_unpackhi_epi32(uv, uv);
+        const __m128i r = P01X_CHANNEL_SSE2(r_factor);
+        const __m128i g = P01X_CHANNEL_SSE2(g_factor);
+        const __m128i b = P01X_CHANNEL_SSE2(b_factor);
+
+        _mm_storeu_si128((__m128i *)(dst + i), PackARGB2101010_SSE2(
+            _mm_unpacklo_epi16(r, zero), _mm_unpacklo_epi16(g, zero), _mm_unpacklo_epi16(b, zero)));
+        _mm_storeu_si128((__m128i *)(dst + i + 4), PackARGB2101010_SSE2(
+            _mm_unpackhi_epi16(r, zero), _mm_unpackhi_epi16(g, zero), _mm_unpackhi_epi16(b, zero)));
+    }
+    return i;
+}
+
+#undef P01X_CHANNEL_SSE2
+
+static int
+P01x_to_8bit_Row_SSE2(const Uint16 *src, Uint8 *dst, int count)
+{
+    const __m128i rounding = _mm_set1_epi16(0x80);
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_srli_epi16(_mm_adds_epu16(_mm_loadu_si128((const __m128i *)(src + i)), rounding), 8);
+        const __m128i b = _mm_srli_epi16(_mm_adds_epu16(_mm_loadu_si128((const __m128i *)(src + i + 8)), rounding), 8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+/* Converts 4 pixels with scaled luma y */
+static uint32x4_t
+P01x_to_ARGB2101010_NEON(const struct YUV2RGB10Factors *cvt, int32x4_t y, int16x4_t u, int16x4_t v)
+{
+    const uint16x4_t max = vdup_n_u16(1023);
+    const uint32x4_t r = vmovl_u16(vmin_u16(vqshrun_n_s32(vmlal_n_s16(y, v, cvt->v_r_factor), 13), max));
+    const uint32x4_t g = vmovl_u16(vmin_u16(vqshrun_n_s32(vmlal_n_s16(vmlal_n_s16(y, u, cvt->u_g_factor), v, cvt->v_g_factor), 13), max));
+    const uint32x4_t b = vmovl_u16(vmin_u16(vqshrun_n_s32(vmlal_n_s16(y, u, cvt->u_b_factor), 13), max));
+
+    return vorrq_u32(vorrq_u32(vdupq_n_u32(0xC0000000), vshlq_n_u32(r, 20)), vorrq_u32(vshlq_n_u32(g, 10), b));
+}
+
+static int
+P01x_to_ARGB2101010_Row_NEON(const struct YUV2RGB10Factors *cvt, const Uint16 *src_y, const Uint16 *src_uv, Uint32 *dst, int width)
+{
+    const int16x8_t y_offset = vdupq_n_s16(cvt->y_offset);
+    const int16x4_t uv_offset = vdup_n_s16(512);
+    const int32x4_t rounding = vdupq_n_s32(1 << 12);
+    int i;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        const int16x8_t y = vsubq_s16(vreinterpretq_s16_u16(vshrq_n_u16(vld1q_u16(src_y + i), 6)), y_offset);
+        const uint16x4x2_t uv = vld2_u16(src_uv + i);
+        const int16x4_t u4 = vsub_s16(vreinterpret_s16_u16(vshr_n_u16(uv.val[0], 6)), uv_offset);
+        const int16x4_t v4 = vsub_s16(vreinterpret_s16_u16(vshr_n_u16(uv.val[1], 6)), uv_offset);
+        const int16x4x2_t u = vzip_s16(u4, u4);
+        const int16x4x2_t v = vzip_s16(v4, v4);
+
+        vst1q_u32(dst + i, P01x_to_ARGB2101010_NEON(cvt, vmlal_n_s16(rounding, vget_low_s16(y), cvt->y_factor), u.val[0], v.val[0]));
+        vst1q_u32(dst + i + 4, P01x_to_ARGB2101010_NEON(cvt, vmlal_n_s16(rounding, vget_high_s16(y), cvt->y_factor), u.val[1], v.val[1]));
+    }
+    return i;
+}
+
+static int
+P01x_to_8bit_Row_NEON(const Uint16 *src, Uint8 *dst, int count)
+{
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        vst1q_u8(dst + i, vcombine_u8(vqrshrn_n_u16(vld1q_u16(src + i), 8), vqrshrn_n_u16(vld1q_u16(src + i + 8), 8)));
+    }
+    return i;
+}
+#endif /* __ARM_NEON */
+
+static int
+P01x_to_ARGB2101010_Row(int features, const struct YUV2RGB10Factors *cvt, const Uint16 *src_y, const Uint16 *src_uv, Uint32 *dst, int width)
+{
+#ifdef __SSE2__
+    if (features & SDL_CPU_SSE2) {
+        return P01x_to_ARGB2101010_Row_SSE2(cvt, src_y, src_uv, dst, width);
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (features & SDL_CPU_NEON) {
+        return P01x_to_ARGB2101010_Row_NEON(cvt, src_y, src_uv, dst, width);
+    }
+#endif
+    return 0;
+}
+
+static int
+P01x_to_8bit_Row(int features, const Uint16 *src, Uint8 *dst, int count)
+{
+#ifdef __SSE2__
+    if (features & SDL_CPU_SSE2) {
+        return P01x_to_8bit_Row_SSE2(src, dst, count);
+    }
+#endif
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (features & SDL_CPU_NEON) {
+        return P01x_to_8bit_Row_NEON(src, dst, count);
+    }
+#endif
+    return 0;
+}
+
+static void
+P01x_to_8bit(int features, const Uint16 *src, Uint8 *dst, int count)
+{
+    P01x_to_8bit_Std(src, dst, P01x_to_8bit_Row(features, src, dst, count), count);
+}
+
+/* ARGB2101010 keeps all 10 bits, the other formats are converted by the NV12
+   kernels from blocks narrowed to 8 bits on the stack, so the frame is only
+   read once */
+static void
+SDL_ConvertPixels_P01x_to_RGB_Band(int width, int height, int row, int rows,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const Uint8 *y = NULL;
+    const Uint8 *u = NULL;
+    const Uint8 *v = NULL;
+    Uint32 y_stride = 0;
+    Uint32 uv_stride = 0;
+    YCbCrType yuv_type = YCBCR_601;
+    const int features = SDL_GetBlitCPUFeatures();
+    int i, j;
+
+    /* Checked by SDL_ConvertPixels_YUV_to_RGB() before starting */
+    GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride);
+    GetYUVConversionType(width, height, &yuv_type);
+
+    y += row * y_stride;
+    u += (row / 2) * uv_stride;
+
+    if (dst_format == SDL_PIXELFORMAT_ARGB2101010) {
+        const struct YUV2RGB10Factors *cvt = &YUV2RGB10FactorTables[yuv_type];
+
+        for (j = 0; j < rows; ++j) {
+            const Uint16 *src_y = (const Uint16 *)(y + j * y_stride);
+            const Uint16 *src_uv = (const Uint16 *)(u + (j / 2) * uv_stride);
+            Uint32 *argb = (Uint32 *)((Uint8 *)dst + j * dst_pitch);
+
+            i = P01x_to_ARGB2101010_Row(features, cvt, src_y, src_uv, argb, width);
+            P01x_to_ARGB2101010_Std(cvt, src_y, src_uv, argb, i, width);
+        }
+    } else {
+        Uint8 block[P01X_BLOCK_WIDTH * 3];
+        Uint8 *block_uv = block + P01X_BLOCK_WIDTH * 2;
+        const int bpp = SDL_BYTESPERPIXEL(dst_format);
+        int x, w, h;
+
+        for (j = 0; j < rows; j += 2) {
+            h = SDL_min(rows - j, 2);
+            for (x = 0; x < width; x += P01X_BLOCK_WIDTH) {
+                Uint8 *rgb = (Uint8 *)dst + j * dst_pitch + x * bpp;
+
+                w = SDL_min(width - x, P01X_BLOCK_WIDTH);
+                for (i = 0; i < h; ++i) {
+                    P01x_to_8bit(features, (const Uint16 *)(y + (j + i) * y_stride) + x, block + i * P01X_BLOCK_WIDTH, w);
+                }
+                P01x_to_8bit(features, (const Uint16 *)(u + (j / 2) * uv_stride) + x, block_uv, 2 * ((w + 1) / 2));
+
+                if (!yuv_rgb_sse(features, SDL_PIXELFORMAT_NV12, dst_format, w, h, block, block_uv, block_uv + 1, P01X_BLOCK_WIDTH, P01X_BLOCK_WIDTH, rgb, dst_pitch, yuv_type)) {
+                    yuv_rgb_std(SDL_PIXELFORMAT_NV12, dst_format, w, h, block, block_uv, block_uv + 1, P01X_BLOCK_WIDTH, P01X_BLOCK_WIDTH, rgb, dst_pitch, yuv_type);
+                }
+            }
+        }
+    }
+}
+
 int
-SDL_ConvertPixels_YUV_to_RGB(int width, int height,
+SDL_ConvertPixels_YUV_to_RGB_Rows(int width, int height, int row, int rows,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -413,11 +943,21 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
+    if (row < 0 || rows < 0 || row + rows > height) {
+        return SDL_SetError("Rows %d to %d are outside the image", row, row + rows);
+    }
+    if ((IsPlanar2x2Format(src_format) || IsP01xFormat(src_format)) && (row & 1)) {
+        return SDL_SetError("Rows must start on an even row for %s", SDL_GetPixelFormatName(src_format));
+    }
+
+    if (IsP01xFormat(src_format) &&
+        (dst_format == SDL_PIXELFORMAT_ARGB2101010 || yuv_rgb_supported(SDL_PIXELFORMAT_NV12, dst_format))) {
+        SDL_RunYUVBands(SDL_ConvertPixels_P01x_to_RGB_Band, width, height, row, rows, src_format, src, src_pitch, dst_format, dst, dst_pitch);
         return 0;
     }
 
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb_supported(src_format, dst_format)) {
+        SDL_RunYUVBands(SDL_ConvertPixels_YUV_to_RGB_Band, width, height, row, rows, src_format, src, src_pitch, dst_format, dst, dst_pitch);
         return 0;
     }
 
@@ -427,20 +967,24 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         void *tmp;
         int tmp_pitch = (width * sizeof(Uint32));
 
-        tmp = SDL_malloc(tmp_pitch * height);
+        if (rows == 0) {
+            return 0;
+        }
+
+        tmp = SDL_malloc(tmp_pitch * rows);
         if (tmp == NULL) {
             return SDL_OutOfMemory();
         }
 
         /* convert src/src_format to tmp/ARGB8888 */
-        ret = SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
+        ret = SDL_ConvertPixels_YUV_to_RGB_Rows(width, height, row, rows, src_format, src, src_pitch, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
         if (ret < 0) {
             SDL_free(tmp);
             return ret;
         }
 
         /* convert tmp/ARGB8888 to dst/RGB */
-        ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        ret = SDL_ConvertPixels(width, rows, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
         SDL_free(tmp);
         return ret;
     }
@@ -448,6 +992,14 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     return SDL_SetError("Unsupported YUV conversion");
 }
 
+int
+SDL_ConvertPixels_YUV_to_RGB(int width, int height,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    return SDL_ConvertPixels_YUV_to_RGB_Rows(width, height, 0, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+}
+
 struct RGB2YUVFactors
 {
     int y_offset;
@@ -456,6 +1008,525 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
+/* The SIMD versions of SDL_ConvertPixels_ARGB8888_to_YUV() below use the
+   same single precision float operations in the same order as the MAKE_Y,
+   MAKE_U and MAKE_V macros, so they produce exactly the same bytes. Each row
+   function converts as much of the row as it can and returns the number of
+   pixels (or chroma samples) done, the caller finishes the row.
+
+   This relies on the compiler not fusing the multiplies and adds of the
+   macros, which the FP contraction pragma at the top of this file prevents,
+   and on it rounding each operation to single precision. x87 math doesn't, so the
+   SIMD rows are left out when floats are evaluated in higher precision.
+ */
+#if defined(__FLT_EVAL_METHOD__) && (__FLT_EVAL_METHOD__ != 0)
+#define SDL_RGB2YUV_SIMD 0
+#else
+#define SDL_RGB2YUV_SIMD 1
+#endif
+
+#if SDL_RGB2YUV_SIMD && defined(__SSE2__)
+static __m128i
+RGB2YUV_SSE2(const float *factors, int offset, __m128i r, __m128i g, __m128i b)
+{
+    __m128 sum = _mm_mul_ps(_mm_set1_ps(factors[0]), _mm_cvtepi32_ps(r));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(factors[1]), _mm_cvtepi32_ps(g)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(factors[2]), _mm_cvtepi32_ps(b)));
+    sum = _mm_add_ps(sum, _mm_set1_ps(0.5f));
+    /* Keep the low byte, like the (Uint8) cast does */
+    return _mm_and_si128(_mm_add_epi32(_mm_cvttps_epi32(sum), _mm_set1_epi32(offset)), _mm_set1_epi32(0xFF));
+}
+
+/* Adds the values of horizontally adjacent pixels in a and b */
+static __m128i
+SumPairs_SSE2(__m128i a, __m128i b)
+{
+    const __m128 fa = _mm_castsi128_ps(a);
+    const __m128 fb = _mm_castsi128_ps(b);
+    return _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                         _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))));
+}
+
+/* Converts 16 pixels to 16 Y values */
+static __m128i
+ARGB8888_to_Y_SSE2(const struct RGB2YUVFactors *cvt, const Uint8 *src)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i y[4];
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)src + k);
+        y[k] = RGB2YUV_SSE2(cvt->y, cvt->y_offset,
+                            _mm_and_si128(_mm_srli_epi32(p, 16), mask),
+                            _mm_and_si128(_mm_srli_epi32(p, 8), mask),
+                            _mm_and_si128(p, mask));
+    }
+    return _mm_packus_epi16(_mm_packs_epi32(y[0], y[1]), _mm_packs_epi32(y[2], y[3]));
+}
+
+/* Converts 16 pixels of curr_row, averaged with next_row if it isn't NULL,
+   to 8 U and 8 V values in the low half of u and v */
+static void
+ARGB8888_to_UV_SSE2(const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row, __m128i *u, __m128i *v)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const int shift = next_row ? 2 : 1;
+    __m128i us[2], vs[2];
+    int k;
+
+    for (k = 0; k < 2; ++k) {
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)curr_row + 2 * k);
+        const __m128i p2 = _mm_loadu_si128((const __m128i *)curr_row + 2 * k + 1);
+        __m128i r1 = _mm_and_si128(_mm_srli_epi32(p1, 16), mask);
+        __m128i g1 = _mm_and_si128(_mm_srli_epi32(p1, 8), mask);
+        __m128i b1 = _mm_and_si128(p1, mask);
+        __m128i r2 = _mm_and_si128(_mm_srli_epi32(p2, 16), mask);
+        __m128i g2 = _mm_and_si128(_mm_srli_epi32(p2, 8), mask);
+        __m128i b2 = _mm_and_si128(p2, mask);
+        __m128i r, g, b;
+
+        if (next_row) {
+            const __m128i p3 = _mm_loadu_si128((const __m128i *)next_row + 2 * k);
+            const __m128i p4 = _mm_loadu_si128((const __m128i *)next_row + 2 * k + 1);
+            r1 = _mm_add_epi32(r1, _mm_and_si128(_mm_srli_epi32(p3, 16), mask));
+            g1 = _mm_add_epi32(g1, _mm_and_si128(_mm_srli_epi32(p3, 8), mask));
+            b1 = _mm_add_epi32(b1, _mm_and_si128(p3, mask));
+            r2 = _mm_add_epi32(r2, _mm_and_si128(_mm_srli_epi32(p4, 16), mask));
+            g2 = _mm_add_epi32(g2, _mm_and_si128(_mm_srli_epi32(p4, 8), mask));
+            b2 = _mm_add_epi32(b2, _mm_and_si128(p4, mask));
+        }
+        r = _mm_srli_epi32(SumPairs_SSE2(r1, r2), shift);
+        g = _mm_srli_epi32(SumPairs_SSE2(g1, g2), shift);
+        b = _mm_srli_epi32(SumPairs_SSE2(b1, b2), shift);
+        us[k] = RGB2YUV_SSE2(cvt->u, 128, r, g, b);
+        vs[k] = RGB2YUV_SSE2(cvt->v, 128, r, g, b);
+    }
+    *u = _mm_packs_epi32(us[0], us[1]);
+    *u = _mm_packus_epi16(*u, *u);
+    *v = _mm_packs_epi32(vs[0], vs[1]);
+    *v = _mm_packus_epi16(*v, *v);
+}
+
+static int
+ARGB8888_to_YUV_Y_Row_SSE2(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint8 *plane_y, int width)
+{
+    int i;
+
+    for (i = 0; (i + 16) <= width; i += 16) {
+        _mm_storeu_si128((__m128i *)(plane_y + i), ARGB8888_to_Y_SSE2(cvt, src + i * 4));
+    }
+    return i;
+}
+
+static int
+ARGB8888_to_YUV_UV_Row_SSE2(const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row,
+                            Uint32 dst_format, Uint8 *plane_u, Uint8 *plane_v, Uint8 *plane_interleaved_uv, int width_half)
+{
+    __m128i u, v;
+    int i;
+
+    for (i = 0; (i + 8) <= width_half; i += 8) {
+        ARGB8888_to_UV_SSE2(cvt, curr_row + i * 8, next_row ? next_row + i * 8 : NULL, &u, &v);
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2), _mm_unpacklo_epi8(u, v));
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2), _mm_unpacklo_epi8(v, u));
+        } else {
+            _mm_storel_epi64((__m128i *)(plane_u + i), u);
+            _mm_storel_epi64((__m128i *)(plane_v + i), v);
+        }
+    }
+    return i;
+}
+
+static int
+ARGB8888_to_YUV_Packed_Row_SSE2(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint32 dst_format, Uint8 *plane, int width_half)
+{
+    __m128i y, u, v, uv, out1, out2;
+    int i;
+
+    for (i = 0; (i + 8) <= width_half; i += 8) {
+        y = ARGB8888_to_Y_SSE2(cvt, src + i * 8);
+        ARGB8888_to_UV_SSE2(cvt, src + i * 8, NULL, &u, &v);
+        if (dst_format == SDL_PIXELFORMAT_YUY2) {
+            /* Y U Y1 V */
+            uv = _mm_unpacklo_epi8(u, v);
+            out1 = _mm_unpacklo_epi8(y, uv);
+            out2 = _mm_unpackhi_epi8(y, uv);
+        } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            /* U Y V Y1 */
+            uv = _mm_unpacklo_epi8(u, v);
+            out1 = _mm_unpacklo_epi8(uv, y);
+            out2 = _mm_unpackhi_epi8(uv, y);
+        } else {
+            /* Y V Y1 U */
+            uv = _mm_unpacklo_epi8(v, u);
+            out1 = _mm_unpacklo_epi8(y, uv);
+            out2 = _mm_unpackhi_epi8(y, uv);
+        }
+        _mm_storeu_si128((__m128i *)(plane + i * 4), out1);
+        _mm_storeu_si128((__m128i *)(plane + i * 4 + 16), out2);
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#if SDL_RGB2YUV_SIMD && SDL_AVX2_INTRINSICS
+static SDL_TARGETING("avx2") __m256i
+RGB2YUV_AVX2(const float *factors, int offset, __m256i r, __m256i g, __m256i b)
+{
+    __m256 sum = _mm256_mul_ps(_mm256_set1_ps(factors[0]), _mm256_cvtepi32_ps(r));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(factors[1]), _mm256_cvtepi32_ps(g)));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(factors[2]), _mm256_cvtepi32_ps(b)));
+    sum = _mm256_add_ps(sum, _mm256_set1_ps(0.5f));
+    return _mm256_and_si256(_mm256_add_epi32(_mm256_cvttps_epi32(sum), _mm256_set1_epi32(offset)), _mm256_set1_epi32(0xFF));
+}
+
+/* The shuffles work within 128 bit lanes, the permute puts the sums back in pixel order */
+static SDL_TARGETING("avx2") __m256i
+SumPairs_AVX2(__m256i a, __m256i b)
+{
+    const __m256 fa = _mm256_castsi256_ps(a);
+    const __m256 fb = _mm256_castsi256_ps(b);
+    const __m256i sum = _mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                                         _mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* Packs 32 values in pixel order to bytes */
+static SDL_TARGETING("avx2") __m256i
+PackYUV_AVX2(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+    return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+/* Converts 32 pixels to 32 Y values */
+static SDL_TARGETING("avx2") __m256i
+ARGB8888_to_Y_AVX2(const struct RGB2YUVFactors *cvt, const Uint8 *src)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    __m256i y[4];
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+        const __m256i p = _mm256_loadu_si256((const __m256i *)src + k);
+        y[k] = RGB2YUV_AVX2(cvt->y, cvt->y_offset,
+                            _mm256_and_si256(_mm256_srli_epi32(p, 16), mask),
+                            _mm256_and_si256(_mm256_srli_epi32(p, 8), mask),
+                            _mm256_and_si256(p, mask));
+    }
+    return PackYUV_AVX2(y[0], y[1], y[2], y[3]);
+}
+
+/* Converts 32 pixels of curr_row, averaged with next_row if it isn't NULL,
+   to 16 U and 16 V values */
+static SDL_TARGETING("avx2") void
+ARGB8888_to_UV_AVX2(const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row, __m128i *u, __m128i *v)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    const int shift = next_row ? 2 : 1;
+    __m256i us[2], vs[2];
+    int k;
+
+    for (k = 0; k < 2; ++k) {
+        const __m256i p1 = _mm256_loadu_si256((const __m256i *)curr_row + 2 * k);
+        const __m256i p2 = _mm256_loadu_si256((const __m256i *)curr_row + 2 * k + 1);
+        __m256i r1 = _mm256_and_si256(_mm256_srli_epi32(p1, 16), mask);
+        __m256i g1 = _mm256_and_si256(_mm256_srli_epi32(p1, 8), mask);
+        __m256i b1 = _mm256_and_si256(p1, mask);
+        __m256i r2 = _mm256_and_si256(_mm256_srli_epi32(p2, 16), mask);
+        __m256i g2 = _mm256_and_si256(_mm256_srli_epi32(p2, 8), mask);
+        __m256i b2 = _mm256_and_si256(p2, mask);
+        __m256i r, g, b;
+
+        if (next_row) {
+            const __m256i p3 = _mm256_loadu_si256((const __m256i *)next_row + 2 * k);
+            const __m256i p4 = _mm256_loadu_si256((const __m256i *)next_row + 2 * k + 1);
+            r1 = _mm256_add_epi32(r1, _mm256_and_si256(_mm256_srli_epi32(p3, 16), mask));
+            g1 = _mm256_add_epi32(g1, _mm256_and_si256(_mm256_srli_epi32(p3, 8), mask));
+            b1 = _mm256_add_epi32(b1, _mm256_and_si256(p3, mask));
+            r2 = _mm256_add_epi32(r2, _mm256_and_si256(_mm256_srli_epi32(p4, 16), mask));
+            g2 = _mm256_add_epi32(g2, _mm256_and_si256(_mm256_srli_epi32(p4, 8), mask));
+            b2 = _mm256_add_epi32(b2, _mm256_and_si256(p4, mask));
+        }
+        r = _mm256_srli_epi32(SumPairs_AVX2(r1, r2), shift);
+        g = _mm256_srli_epi32(SumPairs_AVX2(g1, g2), shift);
+        b = _mm256_srli_epi32(SumPairs_AVX2(b1, b2), shift);
+        us[k] = RGB2YUV_AVX2(cvt->u, 128, r, g, b);
+        vs[k] = RGB2YUV_AVX2(cvt->v, 128, r, g, b);
+    }
+    *u = _mm256_castsi256_si128(PackYUV_AVX2(us[0], us[1], us[0], us[1]));
+    *v = _mm256_castsi256_si128(PackYUV_AVX2(vs[0], vs[1], vs[0], vs[1]));
+}
+
+static SDL_TARGETING("avx2") int
+ARGB8888_to_YUV_Y_Row_AVX2(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint8 *plane_y, int width)
+{
+    int i;
+
+    for (i = 0; (i + 32) <= width; i += 32) {
+        _mm256_storeu_si256((__m256i *)(plane_y + i), ARGB8888_to_Y_AVX2(cvt, src + i * 4));
+    }
+    return i;
+}
+
+static SDL_TARGETING("avx2") int
+ARGB8888_to_YUV_UV_Row_AVX2(const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row,
+                            Uint32 dst_format, Uint8 *plane_u, Uint8 *plane_v, Uint8 *plane_interleaved_uv, int width_half)
+{
+    __m128i u, v;
+    int i;
+
+    for (i = 0; (i + 16) <= width_half; i += 16) {
+        ARGB8888_to_UV_AVX2(cvt, curr_row + i * 8, next_row ? next_row + i * 8 : NULL, &u, &v);
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2), _mm_unpacklo_epi8(u, v));
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2 + 16), _mm_unpackhi_epi8(u, v));
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2), _mm_unpacklo_epi8(v, u));
+            _mm_storeu_si128((__m128i *)(plane_interleaved_uv + i * 2 + 16), _mm_unpackhi_epi8(v, u));
+        } else {
+            _mm_storeu_si128((__m128i *)(plane_u + i), u);
+            _mm_storeu_si128((__m128i *)(plane_v + i), v);
+        }
+    }
+    return i;
+}
+
+static SDL_TARGETING("avx2") int
+ARGB8888_to_YUV_Packed_Row_AVX2(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint32 dst_format, Uint8 *plane, int width_half)
+{
+    __m256i y, uv, out1, out2;
+    __m128i u, v;
+    int i;
+
+    for (i = 0; (i + 16) <= width_half; i += 16) {
+        y = ARGB8888_to_Y_AVX2(cvt, src + i * 8);
+        ARGB8888_to_UV_AVX2(cvt, src + i * 8, NULL, &u, &v);
+        /* The chroma for pixels 0-15 goes in the low lane and for pixels 16-31 in the high lane */
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            uv = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(v, u)), _mm_unpackhi_epi8(v, u), 1);
+        } else {
+            uv = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(u, v)), _mm_unpackhi_epi8(u, v), 1);
+        }
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            /* U Y V Y1 */
+            out1 = _mm256_unpacklo_epi8(uv, y);
+            out2 = _mm256_unpackhi_epi8(uv, y);
+        } else {
+            /* Y U Y1 V, or Y V Y1 U */
+            out1 = _mm256_unpacklo_epi8(y, uv);
+            out2 = _mm256_unpackhi_epi8(y, uv);
+        }
+        _mm256_storeu_si256((__m256i *)(plane + i * 4), _mm256_permute2x128_si256(out1, out2, 0x20));
+        _mm256_storeu_si256((__m256i *)(plane + i * 4 + 32), _mm256_permute2x128_si256(out1, out2, 0x31));
+    }
+    return i;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_RGB2YUV_SIMD && defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+static uint32x4_t
+RGB2YUV_NEON(const float *factors, int offset, uint32x4_t r, uint32x4_t g, uint32x4_t b)
+{
+    float32x4_t sum = vmulq_n_f32(vcvtq_f32_u32(r), factors[0]);
+    sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_u32(g), factors[1]));
+    sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_u32(b), factors[2]));
+    sum = vaddq_f32(sum, vdupq_n_f32(0.5f));
+    return vreinterpretq_u32_s32(vaddq_s32(vcvtq_s32_f32(sum), vdupq_n_s32(offset)));
+}
+
+/* Narrows 8 values to bytes, keeping the low byte like the (Uint8) cast does */
+static uint8x8_t
+PackYUV_NEON(uint32x4_t a, uint32x4_t b)
+{
+    return vmovn_u16(vcombine_u16(vmovn_u32(a), vmovn_u32(b)));
+}
+
+/* Converts 8 values of each channel */
+#define RGB2YUV_8_NEON(factors, offset, r, g, b) \
+    PackYUV_NEON(RGB2YUV_NEON(factors, offset, vmovl_u16(vget_low_u16(r)), vmovl_u16(vget_low_u16(g)), vmovl_u16(vget_low_u16(b))), \
+                 RGB2YUV_NEON(factors, offset, vmovl_u16(vget_high_u16(r)), vmovl_u16(vget_high_u16(g)), vmovl_u16(vget_high_u16(b))))
+
+/* Converts 16 pixels to 16 Y values */
+static uint8x16_t
+ARGB8888_to_Y_NEON(const struct RGB2YUVFactors *cvt, const uint8x16x4_t *p)
+{
+    const uint16x8_t r_lo = vmovl_u8(vget_low_u8(p->val[2]));
+    const uint16x8_t g_lo = vmovl_u8(vget_low_u8(p->val[1]));
+    const uint16x8_t b_lo = vmovl_u8(vget_low_u8(p->val[0]));
+    const uint16x8_t r_hi = vmovl_u8(vget_high_u8(p->val[2]));
+    const uint16x8_t g_hi = vmovl_u8(vget_high_u8(p->val[1]));
+    const uint16x8_t b_hi = vmovl_u8(vget_high_u8(p->val[0]));
+    return vcombine_u8(RGB2YUV_8_NEON(cvt->y, cvt->y_offset, r_lo, g_lo, b_lo),
+                       RGB2YUV_8_NEON(cvt->y, cvt->y_offset, r_hi, g_hi, b_hi));
+}
+
+/* Converts 16 pixels of curr_row, averaged with next_row if it isn't NULL,
+   to 8 U and 8 V values */
+static void
+ARGB8888_to_UV_NEON(const struct RGB2YUVFactors *cvt, const uint8x16x4_t *curr, const Uint8 *next_row, uint8x8_t *u, uint8x8_t *v)
+{
+    uint16x8_t r = vpaddlq_u8(curr->val[2]);
+    uint16x8_t g = vpaddlq_u8(curr->val[1]);
+    uint16x8_t b = vpaddlq_u8(curr->val[0]);
+
+    if (next_row) {
+        const uint8x16x4_t next = vld4q_u8(next_row);
+        r = vshrq_n_u16(vpadalq_u8(r, next.val[2]), 2);
+        g = vshrq_n_u16(vpadalq_u8(g, next.val[1]), 2);
+        b = vshrq_n_u16(vpadalq_u8(b, next.val[0]), 2);
+    } else {
+        r = vshrq_n_u16(r, 1);
+        g = vshrq_n_u16(g, 1);
+        b = vshrq_n_u16(b, 1);
+    }
+    *u = RGB2YUV_8_NEON(cvt->u, 128, r, g, b);
+    *v = RGB2YUV_8_NEON(cvt->v, 128, r, g, b);
+}
+
+static int
+ARGB8888_to_YUV_Y_Row_NEON(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint8 *plane_y, int width)
+{
+    int i;
+
+    for (i = 0; (i + 16) <= width; i += 16) {
+        const uint8x16x4_t p = vld4q_u8(src + i * 4);
+        vst1q_u8(plane_y + i, ARGB8888_to_Y_NEON(cvt, &p));
+    }
+    return i;
+}
+
+static int
+ARGB8888_to_YUV_UV_Row_NEON(const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row,
+                            Uint32 dst_format, Uint8 *plane_u, Uint8 *plane_v, Uint8 *plane_interleaved_uv, int width_half)
+{
+    uint8x8x2_t uv;
+    int i;
+
+    for (i = 0; (i + 8) <= width_half; i += 8) {
+        const uint8x16x4_t p = vld4q_u8(curr_row + i * 8);
+        ARGB8888_to_UV_NEON(cvt, &p, next_row ? next_row + i * 8 : NULL, &uv.val[0], &uv.val[1]);
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            vst2_u8(plane_interleaved_uv + i * 2, uv);
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            const uint8x8_t u = uv.val[0];
+            uv.val[0] = uv.val[1];
+            uv.val[1] = u;
+            vst2_u8(plane_interleaved_uv + i * 2, uv);
+        } else {
+            vst1_u8(plane_u + i, uv.val[0]);
+            vst1_u8(plane_v + i, uv.val[1]);
+        }
+    }
+    return i;
+}
+
+static int
+ARGB8888_to_YUV_Packed_Row_NEON(const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint32 dst_format, Uint8 *plane, int width_half)
+{
+    uint8x8x4_t out;
+    uint8x8x2_t y;
+    uint8x8_t u, v;
+    int i;
+
+    for (i = 0; (i + 8) <= width_half; i += 8) {
+        const uint8x16x4_t p = vld4q_u8(src + i * 8);
+        const uint8x16_t y16 = ARGB8888_to_Y_NEON(cvt, &p);
+        ARGB8888_to_UV_NEON(cvt, &p, NULL, &u, &v);
+        /* Split Y into even and odd pixels */
+        y = vuzp_u8(vget_low_u8(y16), vget_high_u8(y16));
+        if (dst_format == SDL_PIXELFORMAT_YUY2) {
+            /* Y U Y1 V */
+            out.val[0] = y.val[0];
+            out.val[1] = u;
+            out.val[2] = y.val[1];
+            out.val[3] = v;
+        } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            /* U Y V Y1 */
+            out.val[0] = u;
+            out.val[1] = y.val[0];
+            out.val[2] = v;
+            out.val[3] = y.val[1];
+        } else {
+            /* Y V Y1 U */
+            out.val[0] = y.val[0];
+            out.val[1] = v;
+            out.val[2] = y.val[1];
+            out.val[3] = u;
+        }
+        vst4_u8(plane + i * 4, out);
+    }
+    return i;
+}
+#endif /* __ARM_NEON */
+
+static int
+ARGB8888_to_YUV_Y_Row(int features, const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint8 *plane_y, int width)
+{
+#if SDL_RGB2YUV_SIMD && SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return ARGB8888_to_YUV_Y_Row_AVX2(cvt, src, plane_y, width);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return ARGB8888_to_YUV_Y_Row_SSE2(cvt, src, plane_y, width);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (features & SDL_CPU_NEON) {
+        return ARGB8888_to_YUV_Y_Row_NEON(cvt, src, plane_y, width);
+    }
+#endif
+    return 0;
+}
+
+static int
+ARGB8888_to_YUV_UV_Row(int features, const struct RGB2YUVFactors *cvt, const Uint8 *curr_row, const Uint8 *next_row,
+                       Uint32 dst_format, Uint8 *plane_u, Uint8 *plane_v, Uint8 *plane_interleaved_uv, int width_half)
+{
+#if SDL_RGB2YUV_SIMD && SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return ARGB8888_to_YUV_UV_Row_AVX2(cvt, curr_row, next_row, dst_format, plane_u, plane_v, plane_interleaved_uv, width_half);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return ARGB8888_to_YUV_UV_Row_SSE2(cvt, curr_row, next_row, dst_format, plane_u, plane_v, plane_interleaved_uv, width_half);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (features & SDL_CPU_NEON) {
+        return ARGB8888_to_YUV_UV_Row_NEON(cvt, curr_row, next_row, dst_format, plane_u, plane_v, plane_interleaved_uv, width_half);
+    }
+#endif
+    return 0;
+}
+
+static int
+ARGB8888_to_YUV_Packed_Row(int features, const struct RGB2YUVFactors *cvt, const Uint8 *src, Uint32 dst_format, Uint8 *plane, int width_half)
+{
+#if SDL_RGB2YUV_SIMD && SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return ARGB8888_to_YUV_Packed_Row_AVX2(cvt, src, dst_format, plane, width_half);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return ARGB8888_to_YUV_Packed_Row_SSE2(cvt, src, dst_format, plane, width_half);
+    }
+#endif
+#if SDL_RGB2YUV_SIMD && defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (features & SDL_CPU_NEON) {
+        return ARGB8888_to_YUV_Packed_Row_NEON(cvt, src, dst_format, plane, width_half);
+    }
+#endif
+    return 0;
+}
+
 static int
 SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -491,6 +1562,7 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
         },
     };
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    const int features = SDL_GetBlitCPUFeatures();
 
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
 #define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
@@ -565,7 +1637,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
 
             /* Write Y plane */
             for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
+                i = ARGB8888_to_YUV_Y_Row(features, cvt, curr_row, plane_y, width);
+                plane_y += i;
+                for (; i < width; i++) {
                     const Uint32 p1 = ((const Uint32 *)curr_row)[i];
                     const Uint32 r = (p1 & 0x00ff0000) >> 16;
                     const Uint32 g = (p1 & 0x0000ff00) >> 8;
@@ -585,7 +1659,10 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                 /* Write UV planes, not interleaved */
                 uv_skip = (uv_stride - (width + 1)/2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, next_row, dst_format, plane_u, plane_v, NULL, width_half);
+                    plane_u += i;
+                    plane_v += i;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
                         *plane_u++ = MAKE_U(r, g, b);
                         *plane_v++ = MAKE_V(r, g, b);
@@ -601,7 +1678,10 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, NULL, dst_format, plane_u, plane_v, NULL, width_half);
+                    plane_u += i;
+                    plane_v += i;
+                    for (; i < width_half; i++) {
                         READ_1x2_PIXELS;
                         *plane_u++ = MAKE_U(r, g, b);
                         *plane_v++ = MAKE_V(r, g, b);
@@ -619,7 +1699,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             {
                 uv_skip = (uv_stride - ((width + 1)/2)*2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, next_row, dst_format, NULL, NULL, plane_interleaved_uv, width_half);
+                    plane_interleaved_uv += 2 * i;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
                         *plane_interleaved_uv++ = MAKE_U(r, g, b);
                         *plane_interleaved_uv++ = MAKE_V(r, g, b);
@@ -634,7 +1716,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, NULL, dst_format, NULL, NULL, plane_interleaved_uv, width_half);
+                    plane_interleaved_uv += 2 * i;
+                    for (; i < width_half; i++) {
                         READ_1x2_PIXELS;
                         *plane_interleaved_uv++ = MAKE_U(r, g, b);
                         *plane_interleaved_uv++ = MAKE_V(r, g, b);
@@ -650,7 +1734,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             {
                 uv_skip = (uv_stride - ((width + 1)/2)*2);
                 for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, next_row, dst_format, NULL, NULL, plane_interleaved_uv, width_half);
+                    plane_interleaved_uv += 2 * i;
+                    for (; i < width_half; i++) {
                         READ_2x2_PIXELS;
                         *plane_interleaved_uv++ = MAKE_V(r, g, b);
                         *plane_interleaved_uv++ = MAKE_U(r, g, b);
@@ -665,7 +1751,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
                     next_row += src_pitch_x_2;
                 }
                 if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_UV_Row(features, cvt, curr_row, NULL, dst_format, NULL, NULL, plane_interleaved_uv, width_half);
+                    plane_interleaved_uv += 2 * i;
+                    for (; i < width_half; i++) {
                         READ_1x2_PIXELS;
                         *plane_interleaved_uv++ = MAKE_V(r, g, b);
                         *plane_interleaved_uv++ = MAKE_U(r, g, b);
@@ -698,7 +1786,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             if (dst_format == SDL_PIXELFORMAT_YUY2) 
             {
                 for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_Packed_Row(features, cvt, curr_row, dst_format, plane, width_half);
+                    plane += 4 * i;
+                    for (; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* Y U Y1 V */
                         *plane++ = MAKE_Y(r, g, b);
@@ -721,7 +1811,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             else if (dst_format == SDL_PIXELFORMAT_UYVY)
             {
                 for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_Packed_Row(features, cvt, curr_row, dst_format, plane, width_half);
+                    plane += 4 * i;
+                    for (; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* U Y V Y1 */
                         *plane++ = MAKE_U(R, G, B);
@@ -744,7 +1836,9 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             else if (dst_format == SDL_PIXELFORMAT_YVYU)
             {
                 for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
+                    i = ARGB8888_to_YUV_Packed_Row(features, cvt, curr_row, dst_format, plane, width_half);
+                    plane += 4 * i;
+                    for (; i < width_half; i++) {
                         READ_TWO_RGB_PIXELS;
                         /* Y V Y1 U */
                         *plane++ = MAKE_Y(r, g, b);
@@ -891,6 +1985,27 @@ SDL_ConvertPixels_YUV_to_YUV_Copy(int width, int height, Uint32 format,
         return 0;
     }
 
+    if (IsP01xFormat(format)) {
+        /* Y plane of 16 bit samples */
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, width * 2);
+            src = (const Uint8*)src + src_pitch;
+            dst = (Uint8*)dst + dst_pitch;
+        }
+
+        /* U/V plane is half the height of the Y plane, rounded up */
+        height = (height + 1) / 2;
+        width = 4 * ((width + 1) / 2);
+        src_pitch = 4 * ((src_pitch + 3) / 4);
+        dst_pitch = 4 * ((dst_pitch + 3) / 4);
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, width);
+            src = (const Uint8*)src + src_pitch;
+            dst = (Uint8*)dst + dst_pitch;
+        }
+        return 0;
+    }
+
     return SDL_SetError("SDL_ConvertPixels_YUV_to_YUV_Copy: Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
 }
 
@@ -1536,8 +2651,17 @@ SDL_ConvertPixels_Packed4_to_Packed4(int width, int height,
     return SDL_SetError("SDL_ConvertPixels_Packed4_to_Packed4: Unsupported YUV conversion: %s -> %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
 }
 
-static int
-SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
+static void
+SDL_ConvertPixels_Packed4_to_Packed4_Band(int width, int height, int row, int rows,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    SDL_ConvertPixels_Packed4_to_Packed4(width, rows, src_format, (const Uint8 *)src + row * src_pitch, src_pitch,
+                                         dst_format, (Uint8 *)dst + row * dst_pitch, dst_pitch);
+}
+
+static void
+SDL_ConvertPixels_Planar2x2_to_Packed4_Band(int width, int height, int row, int rows,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -1549,14 +2673,12 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dst_pitch_left;
 
-    if (src == dst) {
-        return SDL_SetError("Can't change YUV plane types in-place");
-    }
-
-    if (GetYUVPlanes(width, height, src_format, src, src_pitch,
-                     &srcY1, &srcU, &srcV, &srcY_pitch, &srcUV_pitch) < 0) {
-        return -1;
-    }
+    /* Checked by SDL_ConvertPixels_Planar2x2_to_Packed4() before starting */
+    GetYUVPlanes(width, height, src_format, src, src_pitch,
+                 &srcY1, &srcU, &srcV, &srcY_pitch, &srcUV_pitch);
+    srcY1 += row * srcY_pitch;
+    srcU += (row / 2) * srcUV_pitch;
+    srcV += (row / 2) * srcUV_pitch;
     srcY2 = srcY1 + srcY_pitch;
     srcY_pitch_left = (srcY_pitch - width);
 
@@ -1568,18 +2690,19 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
         srcUV_pitch_left = (srcUV_pitch - ((width + 1)/2));
     }
 
-    if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                     (const Uint8 **)&dstY1, (const Uint8 **)&dstU1, (const Uint8 **)&dstV1,
-                     &dstY_pitch, &dstUV_pitch) < 0) {
-        return -1;
-    }
+    GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                 (const Uint8 **)&dstY1, (const Uint8 **)&dstU1, (const Uint8 **)&dstV1,
+                 &dstY_pitch, &dstUV_pitch);
+    dstY1 += row * dstY_pitch;
+    dstU1 += row * dstUV_pitch;
+    dstV1 += row * dstUV_pitch;
     dstY2 = dstY1 + dstY_pitch;
     dstU2 = dstU1 + dstUV_pitch;
     dstV2 = dstV1 + dstUV_pitch;
     dst_pitch_left = (dstY_pitch - 4*((width + 1)/2));
 
     /* Copy 2x2 blocks of pixels at a time */
-    for (y = 0; y < (height - 1); y += 2) {
+    for (y = 0; y < (rows - 1); y += 2) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
@@ -1644,7 +2767,7 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     }
 
     /* Last row */
-    if (y == (height - 1)) {
+    if (y == (rows - 1)) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
@@ -1676,11 +2799,31 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
             dstV1 += 4;
         }
     }
-    return 0;
 }
 
 static int
-SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
+SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+
+    if (src == dst) {
+        return SDL_SetError("Can't change YUV plane types in-place");
+    }
+
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0 ||
+        GetYUVPlanes(width, height, dst_format, dst, dst_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+        return -1;
+    }
+
+    SDL_RunYUVBands(SDL_ConvertPixels_Planar2x2_to_Packed4_Band, width, height, 0, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    return 0;
+}
+
+static void
+SDL_ConvertPixels_Packed4_to_Planar2x2_Band(int width, int height, int row, int rows,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -1692,24 +2835,23 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dstY_pitch_left, dstUV_pitch_left, dstUV_pixel_stride;
 
-    if (src == dst) {
-        return SDL_SetError("Can't change YUV plane types in-place");
-    }
-
-    if (GetYUVPlanes(width, height, src_format, src, src_pitch,
-                     &srcY1, &srcU1, &srcV1, &srcY_pitch, &srcUV_pitch) < 0) {
-        return -1;
-    }
+    /* Checked by SDL_ConvertPixels_Packed4_to_Planar2x2() before starting */
+    GetYUVPlanes(width, height, src_format, src, src_pitch,
+                 &srcY1, &srcU1, &srcV1, &srcY_pitch, &srcUV_pitch);
+    srcY1 += row * srcY_pitch;
+    srcU1 += row * srcUV_pitch;
+    srcV1 += row * srcUV_pitch;
     srcY2 = srcY1 + srcY_pitch;
     srcU2 = srcU1 + srcUV_pitch;
     srcV2 = srcV1 + srcUV_pitch;
     src_pitch_left = (srcY_pitch - 4*((width + 1)/2));
 
-    if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                     (const Uint8 **)&dstY1, (const Uint8 **)&dstU, (const Uint8 **)&dstV,
-                     &dstY_pitch, &dstUV_pitch) < 0) {
-        return -1;
-    }
+    GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                 (const Uint8 **)&dstY1, (const Uint8 **)&dstU, (const Uint8 **)&dstV,
+                 &dstY_pitch, &dstUV_pitch);
+    dstY1 += row * dstY_pitch;
+    dstU += (row / 2) * dstUV_pitch;
+    dstV += (row / 2) * dstUV_pitch;
     dstY2 = dstY1 + dstY_pitch;
     dstY_pitch_left = (dstY_pitch - width);
 
@@ -1722,7 +2864,7 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     }
 
     /* Copy 2x2 blocks of pixels at a time */
-    for (y = 0; y < (height - 1); y += 2) {
+    for (y = 0; y < (rows - 1); y += 2) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1++ = *srcY1;
@@ -1785,7 +2927,7 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     }
 
     /* Last row */
-    if (y == (height - 1)) {
+    if (y == (rows - 1)) {
         for (x = 0; x < (width - 1); x += 2) {
             *dstY1++ = *srcY1;
             srcY1 += 2;
@@ -1808,6 +2950,26 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
             *dstV = *srcV1;
         }
     }
+}
+
+static int
+SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+
+    if (src == dst) {
+        return SDL_SetError("Can't change YUV plane types in-place");
+    }
+
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0 ||
+        GetYUVPlanes(width, height, dst_format, dst, dst_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+        return -1;
+    }
+
+    SDL_RunYUVBands(SDL_ConvertPixels_Packed4_to_Planar2x2_Band, width, height, 0, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     return 0;
 }
 
@@ -1830,7 +2992,9 @@ SDL_ConvertPixels_YUV_to_YUV(int width, int height,
     if (IsPlanar2x2Format(src_format) && IsPlanar2x2Format(dst_format)) {
         return SDL_ConvertPixels_Planar2x2_to_Planar2x2(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     } else if (IsPacked4Format(src_format) && IsPacked4Format(dst_format)) {
-        return SDL_ConvertPixels_Packed4_to_Packed4(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        /* Every pair of packed formats is handled, and rows are converted independently even in-place */
+        SDL_RunYUVBands(SDL_ConvertPixels_Packed4_to_Packed4_Band, width, height, 0, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        return 0;
     } else if (IsPlanar2x2Format(src_format) && IsPacked4Format(dst_format)) {
         return SDL_ConvertPixels_Planar2x2_to_Packed4(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     } else if (IsPacked4Format(src_format) && IsPlanar2x2Format(dst_format)) {
@@ -27,10 +27,14 @@
 
 
 #define DUMMY_SURFACE   "_SDL_DummySurface"
+/* What the window shows: only the rects passed to UpdateWindowFramebuffer are
+   copied into it, so tests can check that partial updates cover what changed */
+#define DUMMY_DISPLAY   "_SDL_DummyDisplay"
 
 int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format, void ** pixels, int *pitch)
 {
     SDL_Surface *surface;
+    SDL_Surface *display;
     const Uint32 surface_format = SDL_PIXELFORMAT_RGB888;
     int w, h;
     int bpp;
@@ -39,17 +43,24 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * forma
     /* Free the old framebuffer surface */
     surface = (SDL_Surface *) SDL_GetWindowData(window, DUMMY_SURFACE);
     SDL_FreeSurface(surface);
+    display = (SDL_Surface *) SDL_SetWindowData(window, DUMMY_DISPLAY, NULL);
+    SDL_FreeSurface(display);
 
     /* Create a new one */
     SDL_PixelFormatEnumToMasks(surface_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
     SDL_GetWindowSize(window, &w, &h);
     surface = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
-    if (!surface) {
+    display = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+    if (!surface || !display) {
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(display);
+        SDL_SetWindowData(window, DUMMY_SURFACE, NULL);
         return -1;
     }
 
     /* Save the info and return! */
     SDL_SetWindowData(window, DUMMY_SURFACE, surface);
+    SDL_SetWindowData(window, DUMMY_DISPLAY, display);
     *format = surface_format;
     *pixels = surface->pixels;
     *pitch = surface->pitch;
@@ -59,19 +70,26 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * forma
 int SDL_DUMMY_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects, int numrects)
 {
     static int frame_number;
-    SDL_Surface *surface;
+    SDL_Surface *surface, *display;
+    SDL_Rect rect;
+    int i;
 
     surface = (SDL_Surface *) SDL_GetWindowData(window, DUMMY_SURFACE);
-    if (!surface) {
+    display = (SDL_Surface *) SDL_GetWindowData(window, DUMMY_DISPLAY);
+    if (!surface || !display) {
         return SDL_SetError("Couldn't find dummy surface for window");
     }
 
     /* Send the data to the display */
+    for (i = 0; i < numrects; ++i) {
+        rect = rects[i];
+        SDL_BlitSurface(surface, &rect, display, &rect);
+    }
     if (SDL_getenv("SDL_VIDEO_DUMMY_SAVE_FRAMES")) {
         char file[128];
         SDL_snprintf(file, sizeof(file), "SDL_window%d-%8.8d.bmp",
                      SDL_GetWindowID(window), ++frame_number);
-        SDL_SaveBMP(surface, file);
+        SDL_SaveBMP(display, file);
     }
     return 0;
 }
@@ -82,6 +100,8 @@ void SDL_DUMMY_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
 
     surface = (SDL_Surface *) SDL_SetWindowData(window, DUMMY_SURFACE, NULL);
     SDL_FreeSurface(surface);
+    surface = (SDL_Surface *) SDL_SetWindowData(window, DUMMY_DISPLAY, NULL);
+    SDL_FreeSurface(surface);
 }
 
 #endif /* SDL_VIDEO_DRIVER_DUMMY */
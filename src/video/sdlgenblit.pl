@@ -76,6 +76,24 @@ my %get_rgba_string = (
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " _A = (Uint8)_pixel;",
 );
 
+# Bit positions of the R, G, B and A channels, -1 if there is no alpha
+my %format_shifts = (
+    "RGB888" => "16, 8, 0, -1",
+    "BGR888" => "0, 8, 16, -1",
+    "ARGB8888" => "16, 8, 0, 24",
+    "RGBA8888" => "24, 16, 8, 0",
+    "ABGR8888" => "0, 8, 16, 24",
+    "BGRA8888" => "8, 16, 24, 0",
+);
+
+# The SIMD variants of the unscaled modulate and blend blitters, the
+# condition they're compiled under and the CPU feature they need
+my @simd_variants = (
+    [ "AVX2", "#if SDL_AVX2_INTRINSICS", "SDL_CPU_AVX2" ],
+    [ "SSE2", "#ifdef __SSE2__", "SDL_CPU_SSE2" ],
+    [ "NEON", "#if SDL_BLIT_AUTO_NEON", "SDL_CPU_NEON" ],
+);
+
 my %set_rgba_string = (
     "RGB888" => "_pixel = (_R << 16) | (_G << 8) | _B;",
     "BGR888" => "_pixel = (_B << 16) | (_G << 8) | _R;",
@@ -518,6 +536,456 @@ __EOF__
 __EOF__
 }
 
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    foreach my $variant (@simd_variants) {
+        my ($isa, $condition, $cpu) = @$variant;
+        print FILE "$condition\n";
+        output_copyfuncname("static void", $src, $dst, $modulate, $blend, 0, 0, "_${isa}(SDL_BlitInfo *info)\n");
+        print FILE <<__EOF__;
+{
+    if (!SDL_BlitAuto_${isa}(info, &SDL_BlitAutoFormat_${src}, &SDL_BlitAutoFormat_${dst}, ${\($modulate ? "SDL_TRUE" : "SDL_FALSE")}, ${\($blend ? "SDL_TRUE" : "SDL_FALSE")})) {
+__EOF__
+        output_copyfuncname("       ", $src, $dst, $modulate, $blend, 0, 0, "(info);\n");
+        print FILE <<__EOF__;
+    }
+}
+#endif
+
+__EOF__
+    }
+}
+
+sub output_simdkernels
+{
+    print FILE <<'__EOF__';
+/* The SIMD variants of the unscaled modulate and blend blitters unpack the
+   channels of several pixels into separate vectors of 16-bit lanes and give
+   the same results as the scalar blitters, bit for bit. They only do the
+   blend, add and mod blend modes and fall back to the scalar blitter for mul.
+ */
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define SDL_BLIT_AUTO_NEON 1
+#else
+#define SDL_BLIT_AUTO_NEON 0
+#endif
+
+#if defined(__SSE2__) || SDL_AVX2_INTRINSICS || SDL_BLIT_AUTO_NEON
+
+typedef struct
+{
+    int r, g, b, a;     /* bit positions of the channels, a is -1 without alpha */
+} SDL_BlitAutoFormat;
+
+__EOF__
+    foreach my $format (@src_formats) {
+        print FILE "static const SDL_BlitAutoFormat SDL_BlitAutoFormat_${format} = { $format_shifts{$format} };\n";
+    }
+    print FILE <<'__EOF__';
+
+#define SDL_BLIT_AUTO_MODES (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)
+
+static SDL_bool
+SDL_BlitAuto_CanBlend(int flags)
+{
+    switch (flags & SDL_BLIT_AUTO_MODES) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_ADD:
+    case SDL_COPY_MOD:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+#endif
+
+#ifdef __SSE2__
+/* (x * y) / 255 for 16-bit lanes holding values up to 255 */
+static SDL_INLINE __m128i
+SDL_BlitAuto_MulDiv255_SSE2(__m128i x, __m128i y)
+{
+    const __m128i t = _mm_mullo_epi16(x, y);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+
+/* One channel of 8 pixels */
+static SDL_INLINE __m128i
+SDL_BlitAuto_Unpack_SSE2(__m128i p0, __m128i p1, __m128i shift)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(p0, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(p1, shift), mask));
+}
+
+static SDL_bool
+SDL_BlitAuto_SSE2(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i srcR = _mm_cvtsi32_si128(srcfmt->r);
+    const __m128i srcG = _mm_cvtsi32_si128(srcfmt->g);
+    const __m128i srcB = _mm_cvtsi32_si128(srcfmt->b);
+    const __m128i srcA = _mm_cvtsi32_si128(srcfmt->a);
+    const __m128i dstR = _mm_cvtsi32_si128(dstfmt->r);
+    const __m128i dstG = _mm_cvtsi32_si128(dstfmt->g);
+    const __m128i dstB = _mm_cvtsi32_si128(dstfmt->b);
+    const __m128i dstA = _mm_cvtsi32_si128(dstfmt->a);
+    const __m128i modR = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const __m128i modG = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const __m128i modB = _mm_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const __m128i modA = _mm_set1_epi16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[8], dstbuf[8];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m128i p0, p1, sR, sG, sB, sA;
+
+            if (count < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            p0 = _mm_loadu_si128((const __m128i *)s);
+            p1 = _mm_loadu_si128((const __m128i *)(s + 4));
+            sR = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcR);
+            sG = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcG);
+            sB = SDL_BlitAuto_Unpack_SSE2(p0, p1, srcB);
+            sA = (srcfmt->a >= 0) ? SDL_BlitAuto_Unpack_SSE2(p0, p1, srcA) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_SSE2(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_SSE2(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_SSE2(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_SSE2(sA, modA);
+            }
+            if (blend) {
+                __m128i dR, dG, dB, dA;
+                p0 = _mm_loadu_si128((const __m128i *)d);
+                p1 = _mm_loadu_si128((const __m128i *)(d + 4));
+                dR = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstR);
+                dG = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstG);
+                dB = SDL_BlitAuto_Unpack_SSE2(p0, p1, dstB);
+                dA = (dstfmt->a >= 0) ? SDL_BlitAuto_Unpack_SSE2(p0, p1, dstA) : zero;
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_SSE2(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_SSE2(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_SSE2(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const __m128i inv = _mm_sub_epi16(full, sA);
+                    sR = _mm_add_epi16(sR, SDL_BlitAuto_MulDiv255_SSE2(dR, inv));
+                    sG = _mm_add_epi16(sG, SDL_BlitAuto_MulDiv255_SSE2(dG, inv));
+                    sB = _mm_add_epi16(sB, SDL_BlitAuto_MulDiv255_SSE2(dB, inv));
+                    sA = _mm_add_epi16(sA, SDL_BlitAuto_MulDiv255_SSE2(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = _mm_min_epi16(_mm_add_epi16(sR, dR), full);
+                    sG = _mm_min_epi16(_mm_add_epi16(sG, dG), full);
+                    sB = _mm_min_epi16(_mm_add_epi16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_SSE2(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_SSE2(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_SSE2(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            p0 = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(sR, zero), dstR),
+                                           _mm_sll_epi32(_mm_unpacklo_epi16(sG, zero), dstG)),
+                              _mm_sll_epi32(_mm_unpacklo_epi16(sB, zero), dstB));
+            p1 = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(sR, zero), dstR),
+                                           _mm_sll_epi32(_mm_unpackhi_epi16(sG, zero), dstG)),
+                              _mm_sll_epi32(_mm_unpackhi_epi16(sB, zero), dstB));
+            if (dstfmt->a >= 0) {
+                p0 = _mm_or_si128(p0, _mm_sll_epi32(_mm_unpacklo_epi16(sA, zero), dstA));
+                p1 = _mm_or_si128(p1, _mm_sll_epi32(_mm_unpackhi_epi16(sA, zero), dstA));
+            }
+            _mm_storeu_si128((__m128i *)d, p0);
+            _mm_storeu_si128((__m128i *)(d + 4), p1);
+
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* __SSE2__ */
+
+#if SDL_AVX2_INTRINSICS
+static SDL_TARGETING("avx2") __m256i
+SDL_BlitAuto_MulDiv255_AVX2(__m256i x, __m256i y)
+{
+    const __m256i t = _mm256_mullo_epi16(x, y);
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(1)), _mm256_srli_epi16(t, 8)), 8);
+}
+
+/* One channel of 16 pixels, in the lane order _mm256_unpacklo/hi_epi16() undo */
+static SDL_TARGETING("avx2") __m256i
+SDL_BlitAuto_Unpack_AVX2(__m256i p0, __m256i p1, __m128i shift)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    return _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(p0, shift), mask),
+                              _mm256_and_si256(_mm256_srl_epi32(p1, shift), mask));
+}
+
+static SDL_TARGETING("avx2") SDL_bool
+SDL_BlitAuto_AVX2(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i full = _mm256_set1_epi16(255);
+    const __m128i srcR = _mm_cvtsi32_si128(srcfmt->r);
+    const __m128i srcG = _mm_cvtsi32_si128(srcfmt->g);
+    const __m128i srcB = _mm_cvtsi32_si128(srcfmt->b);
+    const __m128i srcA = _mm_cvtsi32_si128(srcfmt->a);
+    const __m128i dstR = _mm_cvtsi32_si128(dstfmt->r);
+    const __m128i dstG = _mm_cvtsi32_si128(dstfmt->g);
+    const __m128i dstB = _mm_cvtsi32_si128(dstfmt->b);
+    const __m128i dstA = _mm_cvtsi32_si128(dstfmt->a);
+    const __m256i modR = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const __m256i modG = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const __m256i modB = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const __m256i modA = _mm256_set1_epi16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[16], dstbuf[16];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 16);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m256i p0, p1, sR, sG, sB, sA;
+
+            if (count < 16) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            p0 = _mm256_loadu_si256((const __m256i *)s);
+            p1 = _mm256_loadu_si256((const __m256i *)(s + 8));
+            sR = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcR);
+            sG = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcG);
+            sB = SDL_BlitAuto_Unpack_AVX2(p0, p1, srcB);
+            sA = (srcfmt->a >= 0) ? SDL_BlitAuto_Unpack_AVX2(p0, p1, srcA) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_AVX2(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_AVX2(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_AVX2(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_AVX2(sA, modA);
+            }
+            if (blend) {
+                __m256i dR, dG, dB, dA;
+                p0 = _mm256_loadu_si256((const __m256i *)d);
+                p1 = _mm256_loadu_si256((const __m256i *)(d + 8));
+                dR = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstR);
+                dG = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstG);
+                dB = SDL_BlitAuto_Unpack_AVX2(p0, p1, dstB);
+                dA = (dstfmt->a >= 0) ? SDL_BlitAuto_Unpack_AVX2(p0, p1, dstA) : zero;
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_AVX2(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_AVX2(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_AVX2(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const __m256i inv = _mm256_sub_epi16(full, sA);
+                    sR = _mm256_add_epi16(sR, SDL_BlitAuto_MulDiv255_AVX2(dR, inv));
+                    sG = _mm256_add_epi16(sG, SDL_BlitAuto_MulDiv255_AVX2(dG, inv));
+                    sB = _mm256_add_epi16(sB, SDL_BlitAuto_MulDiv255_AVX2(dB, inv));
+                    sA = _mm256_add_epi16(sA, SDL_BlitAuto_MulDiv255_AVX2(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = _mm256_min_epi16(_mm256_add_epi16(sR, dR), full);
+                    sG = _mm256_min_epi16(_mm256_add_epi16(sG, dG), full);
+                    sB = _mm256_min_epi16(_mm256_add_epi16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_AVX2(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_AVX2(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_AVX2(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            p0 = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpacklo_epi16(sR, zero), dstR),
+                                                 _mm256_sll_epi32(_mm256_unpacklo_epi16(sG, zero), dstG)),
+                                 _mm256_sll_epi32(_mm256_unpacklo_epi16(sB, zero), dstB));
+            p1 = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpackhi_epi16(sR, zero), dstR),
+                                                 _mm256_sll_epi32(_mm256_unpackhi_epi16(sG, zero), dstG)),
+                                 _mm256_sll_epi32(_mm256_unpackhi_epi16(sB, zero), dstB));
+            if (dstfmt->a >= 0) {
+                p0 = _mm256_or_si256(p0, _mm256_sll_epi32(_mm256_unpacklo_epi16(sA, zero), dstA));
+                p1 = _mm256_or_si256(p1, _mm256_sll_epi32(_mm256_unpackhi_epi16(sA, zero), dstA));
+            }
+            _mm256_storeu_si256((__m256i *)d, p0);
+            _mm256_storeu_si256((__m256i *)(d + 8), p1);
+
+            if (count < 16) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_BLIT_AUTO_NEON
+static SDL_INLINE uint16x8_t
+SDL_BlitAuto_MulDiv255_NEON(uint16x8_t x, uint16x8_t y)
+{
+    const uint16x8_t t = vmulq_u16(x, y);
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+}
+
+/* The channels are the planes vld4_u8() splits the pixels into, by byte */
+static SDL_bool
+SDL_BlitAuto_NEON(SDL_BlitInfo *info, const SDL_BlitAutoFormat *srcfmt, const SDL_BlitAutoFormat *dstfmt,
+                  SDL_bool modulate, SDL_bool blend)
+{
+    const int flags = info->flags;
+    const int mode = flags & SDL_BLIT_AUTO_MODES;
+    const uint16x8_t full = vdupq_n_u16(255);
+    const uint16x8_t modR = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255);
+    const uint16x8_t modG = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255);
+    const uint16x8_t modB = vdupq_n_u16((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255);
+    const uint16x8_t modA = vdupq_n_u16((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255);
+    Uint32 srcbuf[8], dstbuf[8];
+
+    if (blend && !SDL_BlitAuto_CanBlend(flags)) {
+        return SDL_FALSE;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            uint8x8x4_t pixels;
+            uint16x8_t sR, sG, sB, sA;
+
+            if (count < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            sR = vmovl_u8(pixels.val[srcfmt->r / 8]);
+            sG = vmovl_u8(pixels.val[srcfmt->g / 8]);
+            sB = vmovl_u8(pixels.val[srcfmt->b / 8]);
+            sA = (srcfmt->a >= 0) ? vmovl_u8(pixels.val[srcfmt->a / 8]) : full;
+            if (modulate) {
+                sR = SDL_BlitAuto_MulDiv255_NEON(sR, modR);
+                sG = SDL_BlitAuto_MulDiv255_NEON(sG, modG);
+                sB = SDL_BlitAuto_MulDiv255_NEON(sB, modB);
+                sA = SDL_BlitAuto_MulDiv255_NEON(sA, modA);
+            }
+            if (blend) {
+                uint16x8_t dR, dG, dB, dA;
+                pixels = vld4_u8((const Uint8 *)d);
+                dR = vmovl_u8(pixels.val[dstfmt->r / 8]);
+                dG = vmovl_u8(pixels.val[dstfmt->g / 8]);
+                dB = vmovl_u8(pixels.val[dstfmt->b / 8]);
+                dA = (dstfmt->a >= 0) ? vmovl_u8(pixels.val[dstfmt->a / 8]) : vdupq_n_u16(0);
+                if (mode != SDL_COPY_MOD) {
+                    sR = SDL_BlitAuto_MulDiv255_NEON(sR, sA);
+                    sG = SDL_BlitAuto_MulDiv255_NEON(sG, sA);
+                    sB = SDL_BlitAuto_MulDiv255_NEON(sB, sA);
+                }
+                if (mode == SDL_COPY_BLEND) {
+                    const uint16x8_t inv = vsubq_u16(full, sA);
+                    sR = vaddq_u16(sR, SDL_BlitAuto_MulDiv255_NEON(dR, inv));
+                    sG = vaddq_u16(sG, SDL_BlitAuto_MulDiv255_NEON(dG, inv));
+                    sB = vaddq_u16(sB, SDL_BlitAuto_MulDiv255_NEON(dB, inv));
+                    sA = vaddq_u16(sA, SDL_BlitAuto_MulDiv255_NEON(dA, inv));
+                } else if (mode == SDL_COPY_ADD) {
+                    sR = vminq_u16(vaddq_u16(sR, dR), full);
+                    sG = vminq_u16(vaddq_u16(sG, dG), full);
+                    sB = vminq_u16(vaddq_u16(sB, dB), full);
+                    sA = dA;
+                } else {
+                    sR = SDL_BlitAuto_MulDiv255_NEON(sR, dR);
+                    sG = SDL_BlitAuto_MulDiv255_NEON(sG, dG);
+                    sB = SDL_BlitAuto_MulDiv255_NEON(sB, dB);
+                    sA = dA;
+                }
+            }
+
+            pixels.val[0] = pixels.val[1] = pixels.val[2] = pixels.val[3] = vdup_n_u8(0);
+            pixels.val[dstfmt->r / 8] = vmovn_u16(sR);
+            pixels.val[dstfmt->g / 8] = vmovn_u16(sG);
+            pixels.val[dstfmt->b / 8] = vmovn_u16(sB);
+            if (dstfmt->a >= 0) {
+                pixels.val[dstfmt->a / 8] = vmovn_u16(sA);
+            }
+            vst4_u8((Uint8 *)d, pixels);
+
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return SDL_TRUE;
+}
+#endif /* SDL_BLIT_AUTO_NEON */
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -545,7 +1013,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -575,7 +1042,16 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
+                            if ( !$scale ) {
+                                foreach my $variant (@simd_variants) {
+                                    my ($isa, $condition, $cpu) = @$variant;
+                                    print FILE "$condition\n";
+                                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $cpu,";
+                                    output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, 0, 0, "_${isa} },\n");
+                                    print FILE "#endif\n";
+                                }
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
@@ -601,6 +1077,9 @@ sub output_copyfunc_c
                 if ( $modulate || $blend || $scale ) {
                     output_copyfunc($src, $dst, $modulate, $blend, $scale);
                 }
+                if ( ($modulate || $blend) && !$scale ) {
+                    output_simdfunc($src, $dst, $modulate, $blend);
+                }
             }
         }
     }
@@ -618,6 +1097,7 @@ close_file("SDL_blit_auto.h");
 
 open_file("SDL_blit_auto.c");
 output_copyinc();
+output_simdkernels();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
     for (my $j = 0; $j <= $#dst_formats; ++$j) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
@@ -0,0 +1,349 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* AVX2 version of yuv_rgb_sse_func.h, with the same arithmetic so both give
+   the same result. Each iteration converts 32 pixels of each line, with the
+   16 bit values of 16 pixels in a vector. The unpacks work within 128 bit
+   lanes, so those vectors hold pixels 0-7 and 16-23, or 8-15 and 24-31,
+   which packing back to 8 bits puts in order again.
+*/
+
+#define LOAD_SI256(p) _mm256_loadu_si256((const __m256i*)(p))
+#define SAVE_SI256(p, x) _mm256_storeu_si256((__m256i*)(p), x)
+
+#define UV2RGB_32(U,V,R1,G1,B1,R2,G2,B2) \
+	r_tmp = _mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_b_factor)); \
+	R1 = _mm256_unpacklo_epi16(r_tmp, r_tmp); \
+	G1 = _mm256_unpacklo_epi16(g_tmp, g_tmp); \
+	B1 = _mm256_unpacklo_epi16(b_tmp, b_tmp); \
+	R2 = _mm256_unpackhi_epi16(r_tmp, r_tmp); \
+	G2 = _mm256_unpackhi_epi16(g_tmp, g_tmp); \
+	B2 = _mm256_unpackhi_epi16(b_tmp, b_tmp); \
+
+#define ADD_Y2RGB_32(Y1,Y2,R1,G1,B1,R2,G2,B2) \
+	Y1 = _mm256_mullo_epi16(_mm256_sub_epi16(Y1, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	Y2 = _mm256_mullo_epi16(_mm256_sub_epi16(Y2, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	\
+	R1 = _mm256_srai_epi16(_mm256_add_epi16(R1, Y1), PRECISION); \
+	G1 = _mm256_srai_epi16(_mm256_add_epi16(G1, Y1), PRECISION); \
+	B1 = _mm256_srai_epi16(_mm256_add_epi16(B1, Y1), PRECISION); \
+	R2 = _mm256_srai_epi16(_mm256_add_epi16(R2, Y2), PRECISION); \
+	G2 = _mm256_srai_epi16(_mm256_add_epi16(G2, Y2), PRECISION); \
+	B2 = _mm256_srai_epi16(_mm256_add_epi16(B2, Y2), PRECISION); \
+
+/* The 16 bit pixels come out as 0-7 and 16-23 in lo, 8-15 and 24-31 in hi */
+#define PACK_RGB565_32(R, G, B, RGB1, RGB2) \
+{ \
+	__m256i red_mask, lo, hi; \
+\
+	red_mask = _mm256_set1_epi16((short)0xF800); \
+	lo = _mm256_and_si256(_mm256_unpacklo_epi8(_mm256_setzero_si256(), R), red_mask); \
+	hi = _mm256_and_si256(_mm256_unpackhi_epi8(_mm256_setzero_si256(), R), red_mask); \
+	lo = _mm256_or_si256(lo, _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi8(G, _mm256_setzero_si256()), 2), 5)); \
+	hi = _mm256_or_si256(hi, _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpackhi_epi8(G, _mm256_setzero_si256()), 2), 5)); \
+	lo = _mm256_or_si256(lo, _mm256_srli_epi16(_mm256_unpacklo_epi8(B, _mm256_setzero_si256()), 3)); \
+	hi = _mm256_or_si256(hi, _mm256_srli_epi16(_mm256_unpackhi_epi8(B, _mm256_setzero_si256()), 3)); \
+	RGB1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	RGB2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+}
+
+/* Each lane shuffles its 16 pixels into 48 bytes, the lanes are then
+   rearranged into pixels 0-31 */
+#define SHUFFLE_RGB24_16(R, G, B, r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, \
+	g0, g1, g2, g3, g4, g5, g6, g7, g8, g9, g10, g11, g12, g13, g14, g15, \
+	b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15) \
+	_mm256_or_si256(_mm256_or_si256( \
+		_mm256_shuffle_epi8(R, _mm256_broadcastsi128_si256(_mm_setr_epi8(r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15))), \
+		_mm256_shuffle_epi8(G, _mm256_broadcastsi128_si256(_mm_setr_epi8(g0, g1, g2, g3, g4, g5, g6, g7, g8, g9, g10, g11, g12, g13, g14, g15)))), \
+		_mm256_shuffle_epi8(B, _mm256_broadcastsi128_si256(_mm_setr_epi8(b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15))))
+
+#define PACK_RGB24_32(R, G, B, RGB1, RGB2, RGB3) \
+{ \
+	__m256i out1, out2, out3; \
+\
+	out1 = SHUFFLE_RGB24_16(R, G, B, \
+		0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5, \
+		-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, \
+		-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1); \
+	out2 = SHUFFLE_RGB24_16(R, G, B, \
+		-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1, \
+		5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, \
+		-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1); \
+	out3 = SHUFFLE_RGB24_16(R, G, B, \
+		-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1, \
+		-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, \
+		10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15); \
+	RGB1 = _mm256_permute2x128_si256(out1, out2, 0x20); \
+	RGB2 = _mm256_permute2x128_si256(out3, out1, 0x30); \
+	RGB3 = _mm256_permute2x128_si256(out2, out3, 0x31); \
+}
+
+/* The 32 bit pixels come out as 0-3 and 16-19, 4-7 and 20-23, and so on */
+#define PACK_RGBA_32(R, G, B, A, RGB1, RGB2, RGB3, RGB4) \
+{ \
+	__m256i lo_ab, hi_ab, lo_gr, hi_gr, p1, p2, p3, p4; \
+\
+	lo_ab = _mm256_unpacklo_epi8( A, B ); \
+	hi_ab = _mm256_unpackhi_epi8( A, B ); \
+	lo_gr = _mm256_unpacklo_epi8( G, R ); \
+	hi_gr = _mm256_unpackhi_epi8( G, R ); \
+	p1 = _mm256_unpacklo_epi16( lo_ab, lo_gr ); \
+	p2 = _mm256_unpackhi_epi16( lo_ab, lo_gr ); \
+	p3 = _mm256_unpacklo_epi16( hi_ab, hi_gr ); \
+	p4 = _mm256_unpackhi_epi16( hi_ab, hi_gr ); \
+	RGB1 = _mm256_permute2x128_si256(p1, p2, 0x20); \
+	RGB2 = _mm256_permute2x128_si256(p3, p4, 0x20); \
+	RGB3 = _mm256_permute2x128_si256(p1, p2, 0x31); \
+	RGB4 = _mm256_permute2x128_si256(p3, p4, 0x31); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_LINE(rgb_ptr, R, G, B) \
+{ \
+	__m256i rgb_1, rgb_2; \
+	PACK_RGB565_32(R, G, B, rgb_1, rgb_2) \
+	SAVE_SI256(rgb_ptr, rgb_1); \
+	SAVE_SI256(rgb_ptr+32, rgb_2); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_LINE(rgb_ptr, R, G, B) \
+{ \
+	__m256i rgb_1, rgb_2, rgb_3; \
+	PACK_RGB24_32(R, G, B, rgb_1, rgb_2, rgb_3) \
+	SAVE_SI256(rgb_ptr, rgb_1); \
+	SAVE_SI256(rgb_ptr+32, rgb_2); \
+	SAVE_SI256(rgb_ptr+64, rgb_3); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_LINE(R, G, B, A) PACK_RGBA_32(R, G, B, A, rgb_1, rgb_2, rgb_3, rgb_4)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_LINE(R, G, B, A) PACK_RGBA_32(B, G, R, A, rgb_1, rgb_2, rgb_3, rgb_4)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_LINE(R, G, B, A) PACK_RGBA_32(A, R, G, B, rgb_1, rgb_2, rgb_3, rgb_4)
+#else
+#define PACK_LINE(R, G, B, A) PACK_RGBA_32(A, B, G, R, rgb_1, rgb_2, rgb_3, rgb_4)
+#endif
+
+#define SAVE_LINE(rgb_ptr, R, G, B) \
+{ \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4; \
+	__m256i a = _mm256_set1_epi8((char)0xFF); \
+	PACK_LINE(R, G, B, a) \
+	SAVE_SI256(rgb_ptr, rgb_1); \
+	SAVE_SI256(rgb_ptr+32, rgb_2); \
+	SAVE_SI256(rgb_ptr+64, rgb_3); \
+	SAVE_SI256(rgb_ptr+96, rgb_4); \
+}
+
+#else
+#error SAVE_LINE unimplemented
+#endif
+
+/* READ_UV gives the 16 u and v values of 32 pixels, already as 16 bit */
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256(y_ptr); \
+
+#define READ_UV	\
+	u_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	v_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr) \
+{ \
+	__m256i y1, y2; \
+	y1 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256(y_ptr), 8), 8); \
+	y2 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256(y_ptr+32), 8), 8); \
+	y = _mm256_permute4x64_epi64(_mm256_packus_epi16(y1, y2), 0xD8); \
+}
+
+#define READ_UV	\
+{ \
+	__m256i u1, u2, v1, v2; \
+	u1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256(u_ptr), 24), 24); \
+	u2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256(u_ptr+32), 24), 24); \
+	u_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(u1, u2), 0xD8); \
+	v1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256(v_ptr), 24), 24); \
+	v2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256(v_ptr+32), 24), 24); \
+	v_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(v1, v2), 0xD8); \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256(y_ptr); \
+
+#define READ_UV	\
+	u_16 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256(u_ptr), 8), 8); \
+	v_16 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256(v_ptr), 8), 8); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define YUV2RGB_LINE(y_ptr, rgb_ptr) \
+{ \
+	__m256i y, y_16_1, y_16_2; \
+	__m256i r_16_1=r_uv_16_1, g_16_1=g_uv_16_1, b_16_1=b_uv_16_1; \
+	__m256i r_16_2=r_uv_16_2, g_16_2=g_uv_16_2, b_16_2=b_uv_16_2; \
+	__m256i r_8, g_8, b_8; \
+	\
+	READ_Y(y_ptr) \
+	y_16_1 = _mm256_unpacklo_epi8(y, _mm256_setzero_si256()); \
+	y_16_2 = _mm256_unpackhi_epi8(y, _mm256_setzero_si256()); \
+	\
+	ADD_Y2RGB_32(y_16_1, y_16_2, r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2) \
+	\
+	r_8 = _mm256_packus_epi16(r_16_1, r_16_2); \
+	g_8 = _mm256_packus_epi16(g_16_1, g_16_2); \
+	b_8 = _mm256_packus_epi16(b_16_1, b_16_2); \
+	\
+	SAVE_LINE(rgb_ptr, r_8, g_8, b_8) \
+}
+
+#define YUV2RGB_32 \
+{ \
+	__m256i r_tmp, g_tmp, b_tmp; \
+	__m256i r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2; \
+	__m256i u_16, v_16; \
+	\
+	READ_UV \
+	u_16 = _mm256_add_epi16(u_16, _mm256_set1_epi16(-128)); \
+	v_16 = _mm256_add_epi16(v_16, _mm256_set1_epi16(-128)); \
+	\
+	UV2RGB_32(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2) \
+	\
+	YUV2RGB_LINE(y_ptr1, rgb_ptr1) \
+	if (uv_y_sample_interval > 1) \
+	{ \
+		YUV2RGB_LINE(y_ptr2, rgb_ptr2) \
+	} \
+}
+
+
+SDL_TARGETING("avx2") void AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			/* The second line is only read and written with vertical subsampling */
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+uv_y_sample_interval-1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+uv_y_sample_interval-1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31); xpos+=32)
+			{
+				YUV2RGB_32
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~31);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef LOAD_SI256
+#undef SAVE_SI256
+#undef UV2RGB_32
+#undef ADD_Y2RGB_32
+#undef PACK_RGB565_32
+#undef SHUFFLE_RGB24_16
+#undef PACK_RGB24_32
+#undef PACK_RGBA_32
+#undef PACK_LINE
+#undef SAVE_LINE
+#undef READ_Y
+#undef READ_UV
+#undef YUV2RGB_LINE
+#undef YUV2RGB_32
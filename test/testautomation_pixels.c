@@ -81,7 +81,7 @@ char* _RGBPixelFormatsVerbose[] =
   };
 
 /* Definition of all Non-RGB formats used to test pixel conversions */
-const int _numNonRGBPixelFormats = 7;
+const int _numNonRGBPixelFormats = 9;
 Uint32 _nonRGBPixelFormats[] =
   {
     SDL_PIXELFORMAT_YV12,
@@ -90,7 +90,9 @@ Uint32 _nonRGBPixelFormats[] =
     SDL_PIXELFORMAT_UYVY,
     SDL_PIXELFORMAT_YVYU,
     SDL_PIXELFORMAT_NV12,
-    SDL_PIXELFORMAT_NV21
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_P010,
+    SDL_PIXELFORMAT_P016
   };
 char* _nonRGBPixelFormatsVerbose[] =
   {
@@ -100,7 +102,9 @@ char* _nonRGBPixelFormatsVerbose[] =
     "SDL_PIXELFORMAT_UYVY",
     "SDL_PIXELFORMAT_YVYU",
     "SDL_PIXELFORMAT_NV12",
-    "SDL_PIXELFORMAT_NV21"
+    "SDL_PIXELFORMAT_NV21",
+    "SDL_PIXELFORMAT_P010",
+    "SDL_PIXELFORMAT_P016"
   };
 
 /* Definition of some invalid formats for negative tests */
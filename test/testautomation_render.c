@@ -420,6 +420,245 @@ render_testBlit(void *arg)
 }
 
 
+/**
+ * @brief Tests recording the blit test and replaying it.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderBeginRecording
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderEndRecording
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderReplay
+ * http://wiki.libsdl.org/moin.cgi/SDL_DestroyRenderCommandList
+ */
+int
+render_testRecordReplay(void *arg)
+{
+   int ret;
+   SDL_Rect rect;
+   SDL_Texture *tface;
+   SDL_Surface *referenceSurface = NULL;
+   SDL_RenderCommandList *list;
+   Uint32 tformat;
+   int taccess, tw, th;
+   int i, j, ni, nj;
+   int checkFailCount1;
+
+   /* Clear surface. */
+   _clearScreen();
+
+   /* Create face surface. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL,  "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* Constant values. */
+   ret = SDL_QueryTexture(tface, &tformat, &taccess, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+   rect.w = tw;
+   rect.h = th;
+   ni     = TESTRENDER_SCREEN_W - tw;
+   nj     = TESTRENDER_SCREEN_H - th;
+
+   /* Record the blit loop. */
+   ret = SDL_RenderBeginRecording(renderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderBeginRecording, expected: 0, got: %i", ret);
+   checkFailCount1 = 0;
+   for (j=0; j <= nj; j+=4) {
+      for (i=0; i <= ni; i+=4) {
+         rect.x = i;
+         rect.y = j;
+         ret = SDL_RenderCopy(renderer, tface, NULL, &rect );
+         if (ret != 0) checkFailCount1++;
+      }
+   }
+   SDLTest_AssertCheck(checkFailCount1 == 0, "Validate results from calls to SDL_RenderCopy, expected: 0, got: %i", checkFailCount1);
+   list = SDL_RenderEndRecording(renderer);
+   SDLTest_AssertCheck(list != NULL, "Verify result from SDL_RenderEndRecording is not NULL");
+   if (list == NULL) {
+       SDL_DestroyTexture( tface );
+       return TEST_ABORTED;
+   }
+
+   /* Nothing was drawn while recording, replaying twice draws the same. */
+   _clearScreen();
+   for (i=0; i < 2; i++) {
+      ret = SDL_RenderReplay(renderer, list);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReplay, expected: 0, got: %i", ret);
+   }
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   referenceSurface = SDLTest_ImageBlit();
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE );
+
+   /* Destroying the texture invalidates the list. */
+   SDL_DestroyTexture( tface );
+   ret = SDL_RenderReplay(renderer, list);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderReplay after SDL_DestroyTexture, expected: -1, got: %i", ret);
+
+   /* Clean up. */
+   SDL_DestroyRenderCommandList(list);
+   SDL_FreeSurface(referenceSurface);
+   referenceSurface = NULL;
+
+   /* Destroying the render target ends the recording without a list. */
+   if (SDL_RenderTargetSupported(renderer)) {
+      SDL_Texture *target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 16, 16);
+      SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateTexture is not NULL");
+      if (target != NULL) {
+         ret = SDL_SetRenderTarget(renderer, target);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderTarget, expected: 0, got: %i", ret);
+         ret = SDL_RenderBeginRecording(renderer);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderBeginRecording, expected: 0, got: %i", ret);
+         ret = SDL_RenderFillRect(renderer, NULL);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+         SDL_DestroyTexture(target);
+         SDLTest_AssertCheck(SDL_GetRenderTarget(renderer) == NULL, "Verify the render target was reset");
+         list = SDL_RenderEndRecording(renderer);
+         SDLTest_AssertCheck(list == NULL, "Verify result from SDL_RenderEndRecording after destroying the target is NULL");
+         SDL_DestroyRenderCommandList(list);
+
+         /* The next recording isn't affected. */
+         ret = SDL_RenderBeginRecording(renderer);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderBeginRecording, expected: 0, got: %i", ret);
+         list = SDL_RenderEndRecording(renderer);
+         SDLTest_AssertCheck(list != NULL, "Verify result from SDL_RenderEndRecording is not NULL");
+         SDL_DestroyRenderCommandList(list);
+      }
+   }
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests copying a texture to many places in one call.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopies
+ */
+int
+render_testRenderCopies(void *arg)
+{
+   int ret;
+   SDL_Rect *rects;
+   SDL_Texture *tface;
+   SDL_Surface *referenceSurface = NULL;
+   Uint32 tformat;
+   int taccess, tw, th;
+   int i, j, ni, nj, n;
+
+   /* Clear surface. */
+   _clearScreen();
+
+   /* Create face surface. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL,  "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* Constant values. */
+   ret = SDL_QueryTexture(tface, &tformat, &taccess, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+   ni     = TESTRENDER_SCREEN_W - tw;
+   nj     = TESTRENDER_SCREEN_H - th;
+
+   /* Same placement as the blit loop of render_testBlit. */
+   rects = (SDL_Rect *)SDL_malloc(((ni / 4) + 1) * ((nj / 4) + 1) * sizeof(SDL_Rect));
+   SDLTest_AssertCheck(rects != NULL, "Verify SDL_malloc result");
+   if (rects == NULL) {
+       SDL_DestroyTexture( tface );
+       return TEST_ABORTED;
+   }
+   n = 0;
+   for (j=0; j <= nj; j+=4) {
+      for (i=0; i <= ni; i+=4) {
+         rects[n].x = i;
+         rects[n].y = j;
+         rects[n].w = tw;
+         rects[n].h = th;
+         n++;
+      }
+   }
+   ret = SDL_RenderCopies(renderer, tface, NULL, rects, n);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopies, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   referenceSurface = SDLTest_ImageBlit();
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE );
+
+   ret = SDL_RenderCopies(renderer, tface, NULL, NULL, n);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopies with NULL dstrects, expected: -1, got: %i", ret);
+
+   /* Clean up. */
+   SDL_free(rects);
+   SDL_DestroyTexture( tface );
+   SDL_FreeSurface(referenceSurface);
+   referenceSurface = NULL;
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the rendering work counters.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetStats
+ */
+int
+render_testStats(void *arg)
+{
+   int ret;
+   SDL_Rect rect;
+   SDL_Texture *tface;
+   SDL_RenderStats frame, total;
+   int tw, th;
+
+   /* Clear surface, this presents a frame with a clear in it. */
+   _clearScreen();
+   ret = SDL_RenderGetStats(renderer, &frame, &total);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(frame.clear_commands == 1, "Validate clear_commands, expected: 1, got: %u", (unsigned int) frame.clear_commands);
+   SDLTest_AssertCheck(frame.flushes >= 1, "Validate flushes, expected: >= 1, got: %u", (unsigned int) frame.flushes);
+   SDLTest_AssertCheck(total.clear_commands >= frame.clear_commands, "Validate total clear_commands include the frame");
+
+   /* Upload a texture and copy it in the next frame. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL,  "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+   ret = SDL_QueryTexture(tface, NULL, NULL, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = tw;
+   rect.h = th;
+   ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+
+   ret = SDL_RenderGetStats(renderer, &frame, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(frame.clear_commands == 0, "Validate clear_commands, expected: 0, got: %u", (unsigned int) frame.clear_commands);
+   SDLTest_AssertCheck(frame.copy_commands == 1, "Validate copy_commands, expected: 1, got: %u", (unsigned int) frame.copy_commands);
+   SDLTest_AssertCheck(frame.vertex_bytes > 0, "Validate vertex_bytes is not 0");
+   SDLTest_AssertCheck(frame.texture_uploads >= 1, "Validate texture_uploads, expected: >= 1, got: %u", (unsigned int) frame.texture_uploads);
+   SDLTest_AssertCheck(frame.texture_upload_bytes >= (Uint64) tw * th, "Validate texture_upload_bytes covers the texture");
+
+   ret = SDL_RenderGetStats(renderer, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats with no outputs, expected: 0, got: %i", ret);
+
+   /* Clean up. */
+   SDL_DestroyTexture( tface );
+
+   return TEST_COMPLETED;
+}
+
+
 /**
  * @brief Blits doing color tests.
  *
@@ -766,6 +1005,1359 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Copies a rect of YUV data into a whole frame like SDL_UpdateTexture() does. Helper function.
+ */
+static void
+_copyYUVRect(Uint32 format, int w, int h, Uint8 *frame, const SDL_Rect *rect, const Uint8 *pixels, int pitch)
+{
+   const int cw = (w + 1) / 2;
+   const int ch = (h + 1) / 2;
+   int i;
+
+   if (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU) {
+      for (i = 0; i < rect->h; ++i) {
+         SDL_memcpy(frame + (rect->y + i) * 4 * cw + rect->x * 2, pixels + i * pitch, 4 * ((rect->w + 1) / 2));
+      }
+      return;
+   }
+
+   for (i = 0; i < rect->h; ++i) {
+      SDL_memcpy(frame + (rect->y + i) * w + rect->x, pixels + i * pitch, rect->w);
+   }
+   pixels += rect->h * pitch;
+   frame += w * h;
+   if (format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21) {
+      for (i = 0; i < (rect->h + 1) / 2; ++i) {
+         SDL_memcpy(frame + (rect->y / 2 + i) * 2 * cw + 2 * (rect->x / 2), pixels + i * 2 * ((pitch + 1) / 2), 2 * ((rect->w + 1) / 2));
+      }
+   } else {
+      for (i = 0; i < (rect->h + 1) / 2; ++i) {
+         SDL_memcpy(frame + (rect->y / 2 + i) * cw + rect->x / 2, pixels + i * ((pitch + 1) / 2), (rect->w + 1) / 2);
+         SDL_memcpy(frame + cw * ch + (rect->y / 2 + i) * cw + rect->x / 2, pixels + ((rect->h + 1) / 2 + i) * ((pitch + 1) / 2), (rect->w + 1) / 2);
+      }
+   }
+}
+
+/**
+ * @brief Draws a YUV texture and compares it with the conversion of the whole frame. Helper function.
+ */
+static int
+_compareYUVTexture(SDL_Texture *texture, Uint32 format, int w, int h, const Uint8 *frame)
+{
+   Uint32 *expected, *actual;
+   SDL_Rect rect;
+   int i, ret, errors = 0;
+
+   expected = (Uint32 *)SDL_malloc(w * h * sizeof(Uint32));
+   actual = (Uint32 *)SDL_malloc(w * h * sizeof(Uint32));
+   if (!expected || !actual) {
+      SDL_free(expected);
+      SDL_free(actual);
+      return -1;
+   }
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = w;
+   rect.h = h;
+   ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, actual, w * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+   ret = SDL_ConvertPixels(w, h, format, frame, (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU) ? 4 * ((w + 1) / 2) : w,
+                           RENDER_COMPARE_FORMAT, expected, w * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+
+   for (i = 0; i < w * h; ++i) {
+      if ((expected[i] & ~RENDER_COMPARE_AMASK) != (actual[i] & ~RENDER_COMPARE_AMASK)) {
+         ++errors;
+      }
+   }
+   SDL_free(expected);
+   SDL_free(actual);
+   return errors;
+}
+
+/**
+ * @brief Tests partial updates and locks of YUV textures converted in software.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_UpdateTexture
+ * http://wiki.libsdl.org/moin.cgi/SDL_UpdateYUVTexture
+ * http://wiki.libsdl.org/moin.cgi/SDL_LockTexture
+ */
+int
+render_testYUVTextureUpdates(void *arg)
+{
+   static const Uint32 formats[] = {
+      SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+      SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+   };
+   static const int accesses[] = { SDL_TEXTUREACCESS_STATIC, SDL_TEXTUREACCESS_STREAMING };
+   /* Even starts, odd sizes and the last odd row of the frame */
+   static const SDL_Rect rects[] = {
+      { 4, 6, 12, 9 }, { 0, 26, 37, 1 }, { 20, 0, 17, 1 }, { 10, 12, 1, 3 }
+   };
+   const int w = 37, h = 27;
+   const int len = 4 * ((w + 1) / 2) * h + 2 * ((w + 1) / 2) * ((h + 1) / 2);
+   SDL_RendererInfo info;
+   SDL_Texture *texture;
+   Uint8 *frame, *pixels;
+   SDL_Rect rect;
+   void *locked;
+   int pitch, f, a, r, i, j, ret, errors;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   frame = (Uint8 *)SDL_malloc(len);
+   pixels = (Uint8 *)SDL_malloc(len);
+   if (!frame || !pixels) {
+      SDL_free(frame);
+      SDL_free(pixels);
+      return TEST_ABORTED;
+   }
+
+   for (f = 0; f < SDL_arraysize(formats); ++f) {
+      const SDL_bool packed = (formats[f] == SDL_PIXELFORMAT_YUY2 || formats[f] == SDL_PIXELFORMAT_UYVY || formats[f] == SDL_PIXELFORMAT_YVYU);
+      const int frame_pitch = packed ? 4 * ((w + 1) / 2) : w;
+
+      /* Only textures without native support are converted in software */
+      for (i = 0; i < (int)info.num_texture_formats; ++i) {
+         if (info.texture_formats[i] == formats[f]) {
+            break;
+         }
+      }
+      if (i < (int)info.num_texture_formats) {
+         continue;
+      }
+
+      for (a = 0; a < SDL_arraysize(accesses); ++a) {
+         texture = SDL_CreateTexture(renderer, formats[f], accesses[a], w, h);
+         SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture of %s is not NULL", SDL_GetPixelFormatName(formats[f]));
+         if (texture == NULL) {
+            continue;
+         }
+
+         for (i = 0; i < len; ++i) {
+            frame[i] = SDLTest_RandomUint8();
+         }
+         ret = SDL_UpdateTexture(texture, NULL, frame, frame_pitch);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+         errors = _compareYUVTexture(texture, formats[f], w, h, frame);
+         SDLTest_AssertCheck(errors == 0, "Validate %s after a full update, expected: 0 errors, got: %i", SDL_GetPixelFormatName(formats[f]), errors);
+
+         /* Update rects, once with new data and once with the data already there */
+         for (r = 0; r < SDL_arraysize(rects); ++r) {
+            const int rect_pitch = packed ? 4 * ((rects[r].w + 1) / 2) : rects[r].w;
+            for (i = 0; i < len; ++i) {
+               pixels[i] = SDLTest_RandomUint8();
+            }
+            for (j = 0; j < 2; ++j) {
+               ret = SDL_UpdateTexture(texture, &rects[r], pixels, rect_pitch);
+               SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+               _copyYUVRect(formats[f], w, h, frame, &rects[r], pixels, rect_pitch);
+               errors = _compareYUVTexture(texture, formats[f], w, h, frame);
+               SDLTest_AssertCheck(errors == 0, "Validate %s after updating %d,%d %dx%d, expected: 0 errors, got: %i",
+                                   SDL_GetPixelFormatName(formats[f]), rects[r].x, rects[r].y, rects[r].w, rects[r].h, errors);
+            }
+         }
+
+         /* Update rects of separate planes */
+         if (formats[f] == SDL_PIXELFORMAT_IYUV || formats[f] == SDL_PIXELFORMAT_YV12) {
+            for (r = 0; r < SDL_arraysize(rects); ++r) {
+               const int rect_pitch = rects[r].w;
+               const int chroma_len = ((rect_pitch + 1) / 2) * ((rects[r].h + 1) / 2);
+               /* The chroma planes follow Y in the order of the format, YV12 has V first */
+               const Uint8 *first = pixels + rect_pitch * rects[r].h;
+               const Uint8 *second = first + chroma_len;
+               const Uint8 *u = (formats[f] == SDL_PIXELFORMAT_YV12) ? second : first;
+               const Uint8 *v = (formats[f] == SDL_PIXELFORMAT_YV12) ? first : second;
+               for (i = 0; i < len; ++i) {
+                  pixels[i] = SDLTest_RandomUint8();
+               }
+               ret = SDL_UpdateYUVTexture(texture, &rects[r], pixels, rect_pitch, u, (rect_pitch + 1) / 2, v, (rect_pitch + 1) / 2);
+               SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateYUVTexture, expected: 0, got: %i", ret);
+               _copyYUVRect(formats[f], w, h, frame, &rects[r], pixels, rect_pitch);
+               errors = _compareYUVTexture(texture, formats[f], w, h, frame);
+               SDLTest_AssertCheck(errors == 0, "Validate %s after updating the planes of %d,%d %dx%d, expected: 0 errors, got: %i",
+                                   SDL_GetPixelFormatName(formats[f]), rects[r].x, rects[r].y, rects[r].w, rects[r].h, errors);
+            }
+         }
+
+         /* Lock rects, only packed formats can lock less than the whole texture */
+         if (accesses[a] == SDL_TEXTUREACCESS_STREAMING) {
+            for (r = 0; r < SDL_arraysize(rects); ++r) {
+               if (packed) {
+                  rect = rects[r];
+               } else {
+                  rect.x = 0;
+                  rect.y = 0;
+                  rect.w = w;
+                  rect.h = h;
+               }
+               ret = SDL_LockTexture(texture, &rect, &locked, &pitch);
+               SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+               if (ret != 0) {
+                  continue;
+               }
+               /* Change the Y samples of rects[r] only */
+               for (j = 0; j < rects[r].h; ++j) {
+                  for (i = 0; i < rects[r].w; ++i) {
+                     const Uint8 value = SDLTest_RandomUint8();
+                     if (packed) {
+                        const int offset = (formats[f] == SDL_PIXELFORMAT_UYVY) ? 1 : 0;
+                        ((Uint8 *)locked)[j * pitch + i * 2 + offset] = value;
+                        frame[(rects[r].y + j) * frame_pitch + (rects[r].x + i) * 2 + offset] = value;
+                     } else {
+                        ((Uint8 *)locked)[(rects[r].y + j) * pitch + rects[r].x + i] = value;
+                        frame[(rects[r].y + j) * frame_pitch + rects[r].x + i] = value;
+                     }
+                  }
+               }
+               SDL_UnlockTexture(texture);
+               errors = _compareYUVTexture(texture, formats[f], w, h, frame);
+               SDLTest_AssertCheck(errors == 0, "Validate %s after locking %d,%d %dx%d, expected: 0 errors, got: %i",
+                                   SDL_GetPixelFormatName(formats[f]), rects[r].x, rects[r].y, rects[r].w, rects[r].h, errors);
+            }
+         }
+
+         SDL_DestroyTexture(texture);
+      }
+   }
+
+   SDL_free(frame);
+   SDL_free(pixels);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws the test face rotated and flipped with every blend mode and reads the screen back. Helper function.
+ */
+static int
+_renderRotozoomed(SDL_ScaleMode scaleMode, Uint32 *pixels)
+{
+   static const double angles[] = { 7.0, 45.0, 90.0, 133.3, 251.0 };
+   static const SDL_RendererFlip flips[] = { SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL, SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL };
+   static const SDL_BlendMode modes[] = { SDL_BLENDMODE_BLEND, SDL_BLENDMODE_NONE };
+   SDL_Texture *tface;
+   SDL_Rect rect;
+   int i, j, k, ret, failures = 0;
+
+   /* A new texture has no cached transforms, so everything is rotated again */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL, "Verify _loadTestFace() result");
+   if (tface == NULL) {
+      return -1;
+   }
+   ret = SDL_SetTextureScaleMode(tface, scaleMode);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureScaleMode, expected: 0, got: %i", ret);
+
+   _clearScreen();
+   for (k = 0; k < SDL_arraysize(modes); ++k) {
+      SDL_SetTextureBlendMode(tface, modes[k]);
+      for (i = 0; i < SDL_arraysize(angles); ++i) {
+         for (j = 0; j < SDL_arraysize(flips); ++j) {
+            /* Odd sizes and offsets, partly outside the screen */
+            rect.x = i * 17 - 9;
+            rect.y = j * 15 + k * 7 - 5;
+            rect.w = 23 + i * 4;
+            rect.h = 19 + j * 3;
+            ret = SDL_RenderCopyEx(renderer, tface, NULL, &rect, angles[i], NULL, flips[j]);
+            if (ret != 0) {
+               ++failures;
+            }
+         }
+      }
+   }
+   SDLTest_AssertCheck(failures == 0, "Validate results from calls to SDL_RenderCopyEx, expected: 0, got: %i", failures);
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = TESTRENDER_SCREEN_W;
+   rect.h = TESTRENDER_SCREEN_H;
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, pixels, TESTRENDER_SCREEN_W * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   SDL_DestroyTexture(tface);
+   return ret;
+}
+
+/**
+ * @brief Tests that the SIMD rotozoom kernels of the software renderer match the scalar ones.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ * http://wiki.libsdl.org/moin.cgi/SDL_SetTextureScaleMode
+ */
+int
+render_testRotozoomSIMD(void *arg)
+{
+   static const SDL_ScaleMode scaleModes[] = { SDL_ScaleModeNearest, SDL_ScaleModeLinear };
+   const size_t len = TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * sizeof(Uint32);
+   SDL_RendererInfo info;
+   Uint32 *simd, *scalar;
+   char *saved_override;
+   const char *override;
+   int i, ret;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0) {
+      SDLTest_Log("Skipping, the rotozoomer is only used by the software renderer");
+      return TEST_SKIPPED;
+   }
+
+   simd = (Uint32 *)SDL_malloc(len);
+   scalar = (Uint32 *)SDL_malloc(len);
+   override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+   saved_override = SDL_strdup(override ? override : "");
+   if (!simd || !scalar || !saved_override) {
+      SDL_free(simd);
+      SDL_free(scalar);
+      SDL_free(saved_override);
+      return TEST_ABORTED;
+   }
+
+   for (i = 0; i < SDL_arraysize(scaleModes); ++i) {
+      /* SDL_BLIT_CPU_FEATURES=0 makes the rotozoomer use the scalar code */
+      SDL_setenv("SDL_BLIT_CPU_FEATURES", saved_override, 1);
+      ret = _renderRotozoomed(scaleModes[i], simd);
+      SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+      ret |= _renderRotozoomed(scaleModes[i], scalar);
+      if (ret == 0) {
+         SDLTest_AssertCheck(SDL_memcmp(simd, scalar, len) == 0, "Validate %s rotozoom with SIMD matches the scalar code",
+                             scaleModes[i] == SDL_ScaleModeNearest ? "nearest" : "linear");
+      }
+   }
+
+   SDL_setenv("SDL_BLIT_CPU_FEATURES", saved_override, 1);
+   SDL_free(saved_override);
+   SDL_free(simd);
+   SDL_free(scalar);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests drawing at the logical size and scaling it into the window when presenting.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderSetLogicalSize
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ */
+int
+render_testSoftwareLogicalPresent(void *arg)
+{
+   static const char *qualities[] = { "nearest", "linear" };
+   /* Opaque rects, so filtering only makes new colors at their edges */
+   static const SDL_Rect rects[] = { { 3, 2, 17, 11 }, { 30, 5, 1, 40 }, { 41, 20, 25, 25 }, { 70, 44, 10, 6 } };
+   static const SDL_Color colors[] = { { 255, 0, 0, 255 }, { 0, 255, 0, 255 }, { 0, 0, 255, 255 }, { 255, 255, 255, 255 } };
+   /* Scaled 4x into the 320x240 window, with bars above and below */
+   const int lw = 80, lh = 50, scale = 4;
+   SDL_RendererInfo info;
+   SDL_Surface *window_surface, *logical, *converted, *expected;
+   SDL_Rect viewport;
+   Uint32 *pixels;
+   Uint32 actual, want;
+   int q, i, x, y, ww, wh, ret, errors, filtered;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0) {
+      SDLTest_Log("Skipping, only the software renderer draws at the logical size");
+      return TEST_SKIPPED;
+   }
+
+   SDL_GetWindowSize(window, &ww, &wh);
+   viewport.w = lw * scale;
+   viewport.h = lh * scale;
+   viewport.x = (ww - viewport.w) / 2;
+   viewport.y = (wh - viewport.h) / 2;
+   SDLTest_AssertCheck(viewport.x == 0 && viewport.y > 0, "Verify the logical size only has bars above and below in a %dx%d window", ww, wh);
+
+   pixels = (Uint32 *)SDL_malloc(lw * lh * sizeof(Uint32));
+   if (pixels == NULL) {
+      return TEST_ABORTED;
+   }
+
+   for (q = 0; q < SDL_arraysize(qualities); ++q) {
+      /* The hint is checked when creating the renderer, the filter when setting the logical size */
+      SDL_DestroyRenderer(renderer);
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_LOGICAL_PRESENT, "1");
+      SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, qualities[q]);
+      renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+      SDLTest_AssertCheck(renderer != NULL, "Check SDL_CreateRenderer result");
+      if (renderer == NULL) {
+         break;
+      }
+      ret = SDL_RenderSetLogicalSize(renderer, lw, lh);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderSetLogicalSize, expected: 0, got: %i", ret);
+
+      _clearScreen();
+      for (i = 0; i < SDL_arraysize(rects); ++i) {
+         SDL_SetRenderDrawColor(renderer, colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+         ret = SDL_RenderFillRect(renderer, &rects[i]);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+      }
+
+      /* SDL_RenderReadPixels() reads the logical output */
+      ret = SDL_RenderReadPixels(renderer, NULL, RENDER_COMPARE_FORMAT, pixels, lw * sizeof(Uint32));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+      SDL_RenderPresent(renderer);
+
+      window_surface = SDL_GetWindowSurface(window);
+      SDLTest_AssertCheck(window_surface != NULL && window_surface->format->BytesPerPixel == 4, "Verify the window surface has 32-bit pixels");
+      if (window_surface == NULL || window_surface->format->BytesPerPixel != 4) {
+         break;
+      }
+
+      /* The expected window contents are the logical output stretched into the viewport */
+      logical = SDL_CreateRGBSurfaceWithFormatFrom(pixels, lw, lh, 32, lw * sizeof(Uint32), RENDER_COMPARE_FORMAT);
+      converted = logical ? SDL_ConvertSurface(logical, window_surface->format, 0) : NULL;
+      expected = SDL_CreateRGBSurfaceWithFormat(0, viewport.w, viewport.h, 32, window_surface->format->format);
+      SDLTest_AssertCheck(converted != NULL && expected != NULL, "Verify the comparison surfaces are not NULL");
+      if (converted == NULL || expected == NULL) {
+         SDL_FreeSurface(logical);
+         SDL_FreeSurface(converted);
+         SDL_FreeSurface(expected);
+         break;
+      }
+      if (q == 0) {
+         ret = SDL_SoftStretch(converted, NULL, expected, NULL);
+      } else {
+         ret = SDL_SoftStretchLinear(converted, NULL, expected, NULL);
+      }
+      SDLTest_AssertCheck(ret == 0, "Validate result from stretching the logical output, expected: 0, got: %i", ret);
+
+      errors = 0;
+      filtered = 0;
+      for (y = 0; y < wh; ++y) {
+         for (x = 0; x < ww; ++x) {
+            actual = *(Uint32 *)((Uint8 *)window_surface->pixels + y * window_surface->pitch + x * 4) & ~window_surface->format->Amask;
+            if (x < viewport.x || x >= viewport.x + viewport.w || y < viewport.y || y >= viewport.y + viewport.h) {
+               /* The bars stay black */
+               if (actual != 0) {
+                  ++errors;
+               }
+               continue;
+            }
+            want = *(Uint32 *)((Uint8 *)expected->pixels + (y - viewport.y) * expected->pitch + (x - viewport.x) * 4) & ~window_surface->format->Amask;
+            if (actual != want) {
+               ++errors;
+            }
+            /* Count the window pixels that aren't the logical pixel they are scaled from */
+            want = *(Uint32 *)((Uint8 *)converted->pixels + ((y - viewport.y) / scale) * converted->pitch + ((x - viewport.x) / scale) * 4) & ~window_surface->format->Amask;
+            if (actual != want) {
+               ++filtered;
+            }
+         }
+      }
+      SDLTest_AssertCheck(errors == 0, "Validate the %s scaled window matches the logical output, expected: 0 errors, got: %i", qualities[q], errors);
+      if (q == 0) {
+         SDLTest_AssertCheck(filtered == 0, "Validate nearest scaling repeats every logical pixel, expected: 0 other pixels, got: %i", filtered);
+      } else {
+         SDLTest_AssertCheck(filtered > 0, "Validate linear scaling blends the edges of the rects, got: %i blended pixels", filtered);
+      }
+
+      SDL_FreeSurface(logical);
+      SDL_FreeSurface(converted);
+      SDL_FreeSurface(expected);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_LOGICAL_PRESENT, "");
+   SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "");
+   SDL_free(pixels);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws a scene mixing every kind of command across the tile edges and reads the window back. Helper function.
+ */
+static int
+_renderThreadedScene(Uint32 *pixels, int w, int h)
+{
+   static const double angles[] = { 30.0, 45.0, 200.0 };
+   /* With 4 threads the 240 rows are split into 8 tiles of 30 rows */
+   static const SDL_Rect fills[] = { { 10, 20, 100, 25 }, { 200, 55, 90, 70 }, { 0, 88, 320, 5 }, { 150, 118, 3, 130 } };
+   static const SDL_Point points[] = { { 5, 29 }, { 6, 30 }, { 7, 31 }, { 300, 59 }, { 301, 60 }, { 302, 61 }, { 160, 119 }, { 161, 120 } };
+   SDL_Texture *tface, *rle;
+   SDL_Surface *pattern;
+   SDL_Rect rect, clip, viewport;
+   Uint32 format;
+   int i, ret, failures = 0;
+
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL, "Verify _loadTestFace() result");
+   if (tface == NULL) {
+      return -1;
+   }
+
+   /* Static textures without alpha in the window format are RLE encoded when copied with blending */
+   format = SDL_GetWindowPixelFormat(window);
+   pattern = SDLTest_ImageFace();
+   pattern = pattern ? SDL_ConvertSurfaceFormat(pattern, format, 0) : NULL;
+   rle = pattern ? SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC, pattern->w, pattern->h) : NULL;
+   SDLTest_AssertCheck(rle != NULL, "Verify the RLE texture is not NULL");
+   if (rle == NULL) {
+      SDL_FreeSurface(pattern);
+      SDL_DestroyTexture(tface);
+      return -1;
+   }
+   SDL_UpdateTexture(rle, NULL, pattern->pixels, pattern->pitch);
+   SDL_SetTextureBlendMode(rle, SDL_BLENDMODE_BLEND);
+   SDL_FreeSurface(pattern);
+
+   SDL_RenderSetViewport(renderer, NULL);
+   SDL_RenderSetClipRect(renderer, NULL);
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(renderer, 40, 60, 80, 255);
+   SDL_RenderClear(renderer);
+
+   /* Fills, points and unscaled or rotated copies can be drawn in tiles */
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < SDL_arraysize(fills); ++i) {
+      SDL_SetRenderDrawColor(renderer, 255 - i * 50, i * 60, 128, 96 + i * 50);
+      ret = SDL_RenderFillRect(renderer, &fills[i]);
+      if (ret != 0) {
+         ++failures;
+      }
+   }
+   SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+   ret = SDL_RenderDrawPoints(renderer, points, SDL_arraysize(points));
+   if (ret != 0) {
+      ++failures;
+   }
+   for (i = 0; i < SDL_arraysize(angles); ++i) {
+      rect.x = 20 + i * 90;
+      rect.y = 45 + i * 30;
+      rect.w = 41 + i * 6;
+      rect.h = 37 + i * 4;
+      ret = SDL_RenderCopyEx(renderer, tface, NULL, &rect, angles[i], NULL, (SDL_RendererFlip)i);
+      if (ret != 0) {
+         ++failures;
+      }
+   }
+   rect.x = 250;
+   rect.y = 165;
+   SDL_QueryTexture(tface, NULL, NULL, &rect.w, &rect.h);
+   ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+   if (ret != 0) {
+      ++failures;
+   }
+   /* A clip rect and a viewport that start inside a tile */
+   clip.x = 100;
+   clip.y = 140;
+   clip.w = 120;
+   clip.h = 45;
+   SDL_RenderSetClipRect(renderer, &clip);
+   SDL_SetRenderDrawColor(renderer, 0, 255, 255, 200);
+   ret = SDL_RenderFillRect(renderer, NULL);
+   ret |= SDL_RenderCopyEx(renderer, tface, NULL, &clip, 75.0, NULL, SDL_FLIP_NONE);
+   if (ret != 0) {
+      ++failures;
+   }
+   SDL_RenderSetClipRect(renderer, NULL);
+   viewport.x = 10;
+   viewport.y = 195;
+   viewport.w = 200;
+   viewport.h = 40;
+   SDL_RenderSetViewport(renderer, &viewport);
+   rect.x = -10;
+   rect.y = 5;
+   ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+   if (ret != 0) {
+      ++failures;
+   }
+   SDL_RenderSetViewport(renderer, NULL);
+   /* The RLE texture isn't encoded before it is copied in one piece */
+   rect.x = 280;
+   rect.y = 100;
+   ret = SDL_RenderCopy(renderer, rle, NULL, &rect);
+   if (ret != 0) {
+      ++failures;
+   }
+   SDL_RenderFlush(renderer);
+
+   /* Lines and scaled copies are drawn in one piece */
+   SDL_SetRenderDrawColor(renderer, 255, 0, 255, 180);
+   ret = SDL_RenderDrawLine(renderer, 0, 0, w - 1, h - 1);
+   ret |= SDL_RenderDrawLine(renderer, 300, 10, 40, 230);
+   rect.x = 120;
+   rect.y = 20;
+   rect.w = 70;
+   rect.h = 50;
+   ret |= SDL_RenderCopy(renderer, tface, NULL, &rect);
+   SDL_QueryTexture(rle, NULL, NULL, &rect.w, &rect.h);
+   rect.x = 5;
+   rect.y = 205;
+   ret |= SDL_RenderCopy(renderer, rle, NULL, &rect);
+   if (ret != 0) {
+      ++failures;
+   }
+   SDL_RenderFlush(renderer);
+
+   /* So are copies of RLE encoded textures */
+   for (i = 0; i < 4; ++i) {
+      rect.x = 30 + i * 70;
+      rect.y = 75 + i * 30;
+      ret = SDL_RenderCopy(renderer, rle, NULL, &rect);
+      if (ret != 0) {
+         ++failures;
+      }
+   }
+   SDL_RenderFlush(renderer);
+
+   /* And tiled again after them */
+   SDL_SetRenderDrawColor(renderer, 255, 128, 0, 128);
+   for (i = 0; i < 6; ++i) {
+      rect.x = 5 + i * 50;
+      rect.y = 25 + i * 33;
+      rect.w = 30;
+      rect.h = 12;
+      ret = SDL_RenderFillRect(renderer, &rect);
+      ret |= SDL_RenderCopyEx(renderer, tface, NULL, &rect, i * 61.0, NULL, SDL_FLIP_HORIZONTAL);
+      if (ret != 0) {
+         ++failures;
+      }
+   }
+   SDLTest_AssertCheck(failures == 0, "Validate results from the drawing calls, expected: 0, got: %i", failures);
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = w;
+   rect.h = h;
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, pixels, w * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   SDL_DestroyTexture(rle);
+   SDL_DestroyTexture(tface);
+   return ret;
+}
+
+/**
+ * @brief Tests that drawing in tiles on several threads matches drawing on one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SOFTWARE_THREADS
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ */
+int
+render_testSoftwareThreads(void *arg)
+{
+   static const char *threads[] = { "1", "4" };
+   SDL_RendererInfo info;
+   Uint32 *pixels[SDL_arraysize(threads)];
+   size_t len;
+   int i, w, h, ret = 0;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0) {
+      SDLTest_Log("Skipping, only the software renderer draws on several threads");
+      return TEST_SKIPPED;
+   }
+
+   SDL_GetWindowSize(window, &w, &h);
+   len = w * h * sizeof(Uint32);
+   pixels[0] = (Uint32 *)SDL_malloc(len);
+   pixels[1] = (Uint32 *)SDL_malloc(len);
+   if (pixels[0] == NULL || pixels[1] == NULL) {
+      SDL_free(pixels[0]);
+      SDL_free(pixels[1]);
+      return TEST_ABORTED;
+   }
+
+   for (i = 0; i < SDL_arraysize(threads); ++i) {
+      /* The hints are checked when creating the renderer, batching puts many commands in each tile */
+      SDL_DestroyRenderer(renderer);
+      SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads[i]);
+      renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+      SDLTest_AssertCheck(renderer != NULL, "Check SDL_CreateRenderer result");
+      if (renderer == NULL) {
+         ret = -1;
+         break;
+      }
+      ret = _renderThreadedScene(pixels[i], w, h);
+      if (ret != 0) {
+         break;
+      }
+   }
+   if (ret == 0) {
+      SDLTest_AssertCheck(SDL_memcmp(pixels[0], pixels[1], len) == 0, "Validate drawing on %s threads matches drawing on %s", threads[1], threads[0]);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "");
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "");
+   SDL_free(pixels[0]);
+   SDL_free(pixels[1]);
+
+   return TEST_COMPLETED;
+}
+
+/* The steps of _renderTransformCacheSteps() and what each one should find in the cache */
+static const struct {
+   const char *what;
+   int hits;
+   int misses;
+} _transformCacheSteps[] = {
+   { "a first rotated copy", 0, 1 },
+   { "the same copy at another position", 1, 0 },
+   { "another angle", 0, 1 },
+   { "another flip", 0, 1 },
+   { "another size", 0, 1 },
+   { "the first copy again", 1, 0 },
+   { "the first copy after SDL_UpdateTexture()", 0, 1 },
+   { "the first copy after locking the texture", 0, 1 },
+   { "a copy of a target texture", 0, 1 },
+   { "the same copy of the target texture", 1, 0 },
+   { "the target texture copy after drawing to it", 0, 1 },
+   { "the target texture copy again", 1, 0 },
+};
+
+/**
+ * @brief Draws rotated copies that should hit or miss the transform cache and reads the window back. Helper function.
+ */
+static int
+_renderTransformCacheSteps(Uint32 *pixels, int w, int h, int *hits, int *misses)
+{
+   static const Uint32 red = 0xFFFF0000;
+   SDL_Texture *texture, *target;
+   SDL_Surface *face;
+   SDL_Rect rect;
+   Uint64 hits_before, misses_before, hits_after, misses_after;
+   Uint32 *locked;
+   int i, x, y, pitch, ret = 0, failures = 0;
+
+   face = SDLTest_ImageFace();
+   face = face ? SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+   texture = face ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, face->w, face->h) : NULL;
+   target = face ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, face->w, face->h) : NULL;
+   SDLTest_AssertCheck(texture != NULL && target != NULL, "Verify the textures are not NULL");
+   if (texture == NULL || target == NULL) {
+      SDL_DestroyTexture(texture);
+      SDL_DestroyTexture(target);
+      SDL_FreeSurface(face);
+      return -1;
+   }
+   SDL_UpdateTexture(texture, NULL, face->pixels, face->pitch);
+   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+   SDL_SetTextureBlendMode(target, SDL_BLENDMODE_BLEND);
+   SDL_SetRenderTarget(renderer, target);
+   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+   SDL_RenderClear(renderer);
+   SDL_RenderCopy(renderer, texture, NULL, NULL);
+   SDL_SetRenderTarget(renderer, NULL);
+   _clearScreen();
+
+   for (i = 0; i < SDL_arraysize(_transformCacheSteps); ++i) {
+      SDL_RenderFlush(renderer);
+      SDL_RenderGetCopyExCacheStats(renderer, &hits_before, &misses_before);
+
+      /* Each step draws in its own place, so the window shows every result */
+      rect.x = (i % 6) * 52 + 4;
+      rect.y = (i / 6) * 60 + 4;
+      rect.w = 37;
+      rect.h = 41;
+      switch (i) {
+      case 0:
+      case 1:
+      case 5:
+         ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 2:
+         ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 45.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 3:
+         ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+         break;
+      case 4:
+         rect.w = 44;
+         ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 6:
+         /* A red row through the middle */
+         locked = (Uint32 *)SDL_malloc(face->w * sizeof(Uint32));
+         if (locked == NULL) {
+            ret = -1;
+            break;
+         }
+         for (x = 0; x < face->w; ++x) {
+            locked[x] = red;
+         }
+         rect.x = 0;
+         rect.y = face->h / 2;
+         rect.w = face->w;
+         rect.h = 1;
+         ret = SDL_UpdateTexture(texture, &rect, locked, face->w * sizeof(Uint32));
+         SDL_free(locked);
+         rect.x = (i % 6) * 52 + 4;
+         rect.y = (i / 6) * 60 + 4;
+         rect.w = 37;
+         rect.h = 41;
+         ret |= SDL_RenderCopyEx(renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 7:
+         /* And a red column */
+         ret = SDL_LockTexture(texture, NULL, (void **)&locked, &pitch);
+         if (ret == 0) {
+            for (y = 0; y < face->h; ++y) {
+               *(Uint32 *)((Uint8 *)locked + y * pitch + (face->w / 3) * sizeof(Uint32)) = red;
+            }
+            SDL_UnlockTexture(texture);
+         }
+         ret |= SDL_RenderCopyEx(renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 10:
+         SDL_SetRenderTarget(renderer, target);
+         SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
+         ret = SDL_RenderDrawLine(renderer, 0, 0, face->w - 1, face->h - 1);
+         SDL_SetRenderTarget(renderer, NULL);
+         ret |= SDL_RenderCopyEx(renderer, target, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      default:
+         ret = SDL_RenderCopyEx(renderer, target, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+         break;
+      }
+      if (ret != 0) {
+         ++failures;
+      }
+
+      SDL_RenderFlush(renderer);
+      SDL_RenderGetCopyExCacheStats(renderer, &hits_after, &misses_after);
+      hits[i] = (int)(hits_after - hits_before);
+      misses[i] = (int)(misses_after - misses_before);
+   }
+   SDLTest_AssertCheck(failures == 0, "Validate results from the drawing calls, expected: 0, got: %i", failures);
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = w;
+   rect.h = h;
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, pixels, w * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   SDL_DestroyTexture(texture);
+   SDL_DestroyTexture(target);
+   SDL_FreeSurface(face);
+   return ret;
+}
+
+/**
+ * @brief Tests the software renderer's cache of rotated copies.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetCopyExCacheStats
+ */
+int
+render_testTransformCache(void *arg)
+{
+   static const char *budgets[] = { "", "0" };
+   int hits[SDL_arraysize(budgets)][SDL_arraysize(_transformCacheSteps)];
+   int misses[SDL_arraysize(budgets)][SDL_arraysize(_transformCacheSteps)];
+   SDL_RendererInfo info;
+   Uint32 *pixels[SDL_arraysize(budgets)];
+   size_t len;
+   int i, j, w, h, ret = 0;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0) {
+      SDLTest_Log("Skipping, only the software renderer caches rotated copies");
+      return TEST_SKIPPED;
+   }
+
+   SDL_GetWindowSize(window, &w, &h);
+   len = w * h * sizeof(Uint32);
+   pixels[0] = (Uint32 *)SDL_malloc(len);
+   pixels[1] = (Uint32 *)SDL_malloc(len);
+   if (pixels[0] == NULL || pixels[1] == NULL) {
+      SDL_free(pixels[0]);
+      SDL_free(pixels[1]);
+      return TEST_ABORTED;
+   }
+
+   for (i = 0; i < SDL_arraysize(budgets); ++i) {
+      /* The hint is checked when creating the renderer */
+      SDL_DestroyRenderer(renderer);
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE, budgets[i]);
+      renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+      SDLTest_AssertCheck(renderer != NULL, "Check SDL_CreateRenderer result");
+      if (renderer == NULL) {
+         ret = -1;
+         break;
+      }
+      ret = _renderTransformCacheSteps(pixels[i], w, h, hits[i], misses[i]);
+      if (ret != 0) {
+         break;
+      }
+   }
+   if (ret == 0) {
+      for (j = 0; j < SDL_arraysize(_transformCacheSteps); ++j) {
+         SDLTest_AssertCheck(hits[0][j] == _transformCacheSteps[j].hits && misses[0][j] == _transformCacheSteps[j].misses,
+                             "Validate cache hits and misses for %s, expected: %i and %i, got: %i and %i", _transformCacheSteps[j].what,
+                             _transformCacheSteps[j].hits, _transformCacheSteps[j].misses, hits[0][j], misses[0][j]);
+         SDLTest_AssertCheck(hits[1][j] == 0, "Validate a disabled cache has no hits for %s, got: %i", _transformCacheSteps[j].what, hits[1][j]);
+      }
+      SDLTest_AssertCheck(SDL_memcmp(pixels[0], pixels[1], len) == 0, "Validate the cached copies match the uncached ones");
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TRANSFORM_CACHE, "");
+   SDL_free(pixels[0]);
+   SDL_free(pixels[1]);
+
+   return TEST_COMPLETED;
+}
+
+/* The state changes _renderCoalescedCopies() makes before each run of copies */
+static const char *_coalescedCopyRuns[] = {
+   "the first run",
+   "another texture",
+   "a red mod",
+   "a green mod",
+   "a blue mod",
+   "an alpha mod",
+   "another blend mode",
+   "a clip rect",
+   "a render target",
+   "the window again",
+   "copies of the target",
+};
+
+/**
+ * @brief Draws runs of copies with state changes between them and reads the window back. Helper function.
+ */
+static int
+_renderCoalescedCopies(SDL_bool flush, Uint32 *pixels, int w, int h, int *copy_commands)
+{
+   SDL_Texture *tface, *other, *target, *texture;
+   SDL_Surface *primitives;
+   SDL_RenderStats before, after;
+   SDL_Rect rect, clip;
+   int i, j, tw, th, ret = 0, failures = 0;
+
+   tface = _loadTestFace();
+   primitives = SDLTest_ImagePrimitives();
+   other = primitives ? SDL_CreateTextureFromSurface(renderer, primitives) : NULL;
+   SDL_FreeSurface(primitives);
+   SDLTest_AssertCheck(tface != NULL && other != NULL, "Verify the textures are not NULL");
+   if (tface == NULL || other == NULL) {
+      SDL_DestroyTexture(tface);
+      SDL_DestroyTexture(other);
+      return -1;
+   }
+   SDL_SetTextureBlendMode(other, SDL_BLENDMODE_BLEND);
+   SDL_QueryTexture(tface, NULL, NULL, &tw, &th);
+   target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, tw * 4, th);
+   SDLTest_AssertCheck(target != NULL, "Verify the target texture is not NULL");
+   if (target == NULL) {
+      SDL_DestroyTexture(tface);
+      SDL_DestroyTexture(other);
+      return -1;
+   }
+   SDL_SetRenderTarget(renderer, target);
+   SDL_SetRenderDrawColor(renderer, 32, 64, 96, 255);
+   SDL_RenderClear(renderer);
+   SDL_SetRenderTarget(renderer, NULL);
+   /* The totals are added up when presenting */
+   _clearScreen();
+   SDL_RenderGetStats(renderer, NULL, &before);
+   /* Blending over black would hide some blend mode mixups */
+   SDL_SetRenderDrawColor(renderer, 90, 120, 150, 255);
+   SDL_RenderClear(renderer);
+
+   texture = tface;
+   for (i = 0; i < SDL_arraysize(_coalescedCopyRuns); ++i) {
+      switch (i) {
+      case 1:
+         texture = other;
+         break;
+      case 2:
+         SDL_SetTextureColorMod(texture, 128, 255, 255);
+         break;
+      case 3:
+         SDL_SetTextureColorMod(texture, 128, 200, 255);
+         break;
+      case 4:
+         SDL_SetTextureColorMod(texture, 128, 200, 64);
+         break;
+      case 5:
+         SDL_SetTextureAlphaMod(texture, 100);
+         break;
+      case 6:
+         SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_ADD);
+         break;
+      case 7:
+         clip.x = 10;
+         clip.y = i * 20 + 5;
+         clip.w = tw * 2;
+         clip.h = th / 2;
+         SDL_RenderSetClipRect(renderer, &clip);
+         break;
+      case 8:
+         SDL_RenderSetClipRect(renderer, NULL);
+         SDL_SetRenderTarget(renderer, target);
+         texture = tface;
+         break;
+      case 9:
+         SDL_SetRenderTarget(renderer, NULL);
+         break;
+      case 10:
+         texture = target;
+         break;
+      }
+
+      /* Overlapping unscaled and scaled copies */
+      for (j = 0; j < 4; ++j) {
+         rect.x = j * (tw - 7) + (i % 2) * 5;
+         rect.y = (i == 8) ? 0 : i * 20;
+         rect.w = (j % 2) ? tw : tw / 2 + j;
+         rect.h = (j % 2) ? th : th + 3;
+         if (i == 10) {
+            rect.x = j * 11;
+            rect.w = tw * 4;
+         }
+         ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+         if (ret != 0) {
+            ++failures;
+         }
+         if (flush) {
+            SDL_RenderFlush(renderer);
+         }
+      }
+   }
+   SDLTest_AssertCheck(failures == 0, "Validate results from calls to SDL_RenderCopy, expected: 0, got: %i", failures);
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = w;
+   rect.h = h;
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, pixels, w * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   SDL_RenderPresent(renderer);
+   SDL_RenderGetStats(renderer, NULL, &after);
+   *copy_commands = (int)(after.copy_commands - before.copy_commands);
+
+   SDL_DestroyTexture(tface);
+   SDL_DestroyTexture(other);
+   SDL_DestroyTexture(target);
+   return ret;
+}
+
+/**
+ * @brief Tests that merging consecutive copies of a texture draws what the separate copies draw.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopy
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetStats
+ */
+int
+render_testCopyCoalescing(void *arg)
+{
+   const int copies = SDL_arraysize(_coalescedCopyRuns) * 4;
+   SDL_RendererInfo info;
+   Uint32 *merged, *separate;
+   size_t len;
+   int w, h, merged_commands = 0, separate_commands = 0, ret;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0) {
+      SDLTest_Log("Skipping, only the software renderer can be checked for merged copies here");
+      return TEST_SKIPPED;
+   }
+
+   SDL_GetWindowSize(window, &w, &h);
+   len = w * h * sizeof(Uint32);
+   merged = (Uint32 *)SDL_malloc(len);
+   separate = (Uint32 *)SDL_malloc(len);
+   if (merged == NULL || separate == NULL) {
+      SDL_free(merged);
+      SDL_free(separate);
+      return TEST_ABORTED;
+   }
+
+   /* Copies are only merged in a batched queue, the hint is checked when creating the renderer */
+   SDL_DestroyRenderer(renderer);
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+   renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+   SDLTest_AssertCheck(renderer != NULL, "Check SDL_CreateRenderer result");
+   if (renderer != NULL) {
+      ret = _renderCoalescedCopies(SDL_FALSE, merged, w, h, &merged_commands);
+      ret |= _renderCoalescedCopies(SDL_TRUE, separate, w, h, &separate_commands);
+      if (ret == 0) {
+         SDLTest_AssertCheck(merged_commands == SDL_arraysize(_coalescedCopyRuns),
+                             "Validate each run of copies is one command, expected: %i, got: %i", (int)SDL_arraysize(_coalescedCopyRuns), merged_commands);
+         SDLTest_AssertCheck(separate_commands == copies,
+                             "Validate flushing keeps the copies apart, expected: %i, got: %i", copies, separate_commands);
+         SDLTest_AssertCheck(SDL_memcmp(merged, separate, len) == 0, "Validate the merged copies match the separate ones");
+      }
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "");
+   SDL_free(merged);
+   SDL_free(separate);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that presenting only the drawn areas shows what presenting the whole window would.
+ *
+ * The dummy video driver only copies the updated areas of the window surface
+ * to what it shows, so that has to match the window surface after each present.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ * http://wiki.libsdl.org/moin.cgi/SDL_UpdateWindowSurfaceRects
+ */
+int
+render_testDirtyPresent(void *arg)
+{
+   static const char *steps[] = {
+      "a clear",
+      "a small rect",
+      "points and a line",
+      "a viewport",
+      "a clip rect in a viewport",
+      "copies",
+      "a rotated copy",
+      "a render target",
+      "a clear with a clip rect",
+      "nothing",
+   };
+   SDL_RendererInfo info;
+   SDL_Surface *window_surface, *display;
+   SDL_Texture *tface, *target;
+   SDL_Rect rect, viewport;
+   SDL_Point points[3];
+   const char *driver;
+   int i, y, ret, errors;
+
+   ret = SDL_GetRendererInfo(renderer, &info);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+   driver = SDL_GetCurrentVideoDriver();
+   if (ret != 0 || SDL_strcmp(info.name, "software") != 0 || driver == NULL || SDL_strcmp(driver, "dummy") != 0) {
+      SDLTest_Log("Skipping, only the software renderer on the dummy video driver can be checked");
+      return TEST_SKIPPED;
+   }
+
+   tface = _loadTestFace();
+   target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 20, 20);
+   SDLTest_AssertCheck(tface != NULL && target != NULL, "Verify the textures are not NULL");
+   if (tface == NULL || target == NULL) {
+      SDL_DestroyTexture(tface);
+      SDL_DestroyTexture(target);
+      return TEST_ABORTED;
+   }
+
+   for (i = 0; i < SDL_arraysize(steps); ++i) {
+      SDL_SetRenderDrawColor(renderer, (i * 70) & 0xFF, 255 - i * 20, (i * 40) & 0xFF, 255);
+      rect.x = 20 + i * 25;
+      rect.y = 10 + i * 20;
+      rect.w = 15;
+      rect.h = 12;
+      switch (i) {
+      case 0:
+         ret = SDL_RenderClear(renderer);
+         break;
+      case 1:
+         ret = SDL_RenderFillRect(renderer, &rect);
+         break;
+      case 2:
+         points[0].x = 5;
+         points[0].y = 200;
+         points[1].x = 300;
+         points[1].y = 7;
+         points[2].x = 150;
+         points[2].y = 230;
+         ret = SDL_RenderDrawPoints(renderer, points, SDL_arraysize(points));
+         ret |= SDL_RenderDrawLine(renderer, 40, 100, 90, 140);
+         break;
+      case 3:
+         /* The rect is relative to the viewport */
+         viewport.x = 180;
+         viewport.y = 150;
+         viewport.w = 60;
+         viewport.h = 40;
+         SDL_RenderSetViewport(renderer, &viewport);
+         ret = SDL_RenderFillRect(renderer, NULL);
+         SDL_RenderSetViewport(renderer, NULL);
+         break;
+      case 4:
+         /* So is the clip rect */
+         viewport.x = 100;
+         viewport.y = 20;
+         viewport.w = 120;
+         viewport.h = 200;
+         rect.x = 10;
+         rect.y = 30;
+         SDL_RenderSetViewport(renderer, &viewport);
+         SDL_RenderSetClipRect(renderer, &rect);
+         ret = SDL_RenderFillRect(renderer, NULL);
+         SDL_RenderSetClipRect(renderer, NULL);
+         SDL_RenderSetViewport(renderer, NULL);
+         break;
+      case 5:
+         ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+         rect.x = 250;
+         rect.y = 190;
+         rect.w = 50;
+         rect.h = 40;
+         ret |= SDL_RenderCopy(renderer, tface, NULL, &rect);
+         break;
+      case 6:
+         rect.w = 40;
+         ret = SDL_RenderCopyEx(renderer, tface, NULL, &rect, 45.0, NULL, SDL_FLIP_NONE);
+         break;
+      case 7:
+         /* Drawing into the texture doesn't change the window, copying it does */
+         SDL_SetRenderTarget(renderer, target);
+         ret = SDL_RenderClear(renderer);
+         SDL_SetRenderTarget(renderer, NULL);
+         rect.x = 290;
+         rect.y = 30;
+         ret |= SDL_RenderCopy(renderer, target, NULL, &rect);
+         break;
+      case 8:
+         /* A clear ignores the clip rect */
+         SDL_RenderSetClipRect(renderer, &rect);
+         ret = SDL_RenderClear(renderer);
+         SDL_RenderSetClipRect(renderer, NULL);
+         break;
+      default:
+         ret = 0;
+         break;
+      }
+      SDLTest_AssertCheck(ret == 0, "Validate results from drawing %s, expected: 0, got: %i", steps[i], ret);
+      SDL_RenderPresent(renderer);
+
+      window_surface = SDL_GetWindowSurface(window);
+      display = (SDL_Surface *)SDL_GetWindowData(window, "_SDL_DummyDisplay");
+      SDLTest_AssertCheck(window_surface != NULL && display != NULL, "Verify the window surface and the dummy display are not NULL");
+      if (window_surface == NULL || display == NULL) {
+         break;
+      }
+      errors = 0;
+      for (y = 0; y < window_surface->h; ++y) {
+         if (SDL_memcmp((Uint8 *)window_surface->pixels + y * window_surface->pitch,
+                        (Uint8 *)display->pixels + y * display->pitch,
+                        window_surface->w * window_surface->format->BytesPerPixel) != 0) {
+            ++errors;
+         }
+      }
+      SDLTest_AssertCheck(errors == 0, "Validate the window shows %s after presenting, expected: 0 different rows, got: %i", steps[i], errors);
+   }
+
+   SDL_DestroyTexture(tface);
+   SDL_DestroyTexture(target);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests drawing and copying premultiplied colors brighter than their alpha.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_SetRenderDrawBlendMode
+ * http://wiki.libsdl.org/moin.cgi/SDL_SetTextureBlendMode
+ */
+int
+render_testPremultipliedBlend(void *arg)
+{
+   static const char *what[] = { "filled rect", "line", "points", "copy", "rotated copy" };
+   /* The center of each one */
+   static const SDL_Point checks[] = { { 10, 10 }, { 10, 20 }, { 10, 25 }, { 30, 10 }, { 30, 30 } };
+   /* Brighter than its alpha, so blending saturates */
+   const Uint8 bg = 200, r = 200, g = 100, b = 50, a = 100;
+   SDL_Texture *texture;
+   SDL_Point points[11];
+   SDL_Rect rect;
+   Uint32 *pixels, pixel, *texels;
+   int i, ret, er, eg, eb, pr, pg, pb;
+
+   ret = SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 10, 10);
+   if (ret != 0 || texture == NULL || SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED) != 0) {
+      SDL_DestroyTexture(texture);
+      SDLTest_Log("Skipping, the renderer doesn't support premultiplied alpha");
+      return TEST_SKIPPED;
+   }
+
+   pixels = (Uint32 *)SDL_malloc(TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * sizeof(Uint32));
+   texels = (Uint32 *)SDL_malloc(10 * 10 * sizeof(Uint32));
+   if (pixels == NULL || texels == NULL) {
+      SDL_free(pixels);
+      SDL_free(texels);
+      SDL_DestroyTexture(texture);
+      return TEST_ABORTED;
+   }
+   for (i = 0; i < 10 * 10; ++i) {
+      texels[i] = ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+   }
+   SDL_UpdateTexture(texture, NULL, texels, 10 * sizeof(Uint32));
+
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(renderer, bg, bg, bg, 255);
+   SDL_RenderClear(renderer);
+
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+   SDL_SetRenderDrawColor(renderer, r, g, b, a);
+   rect.x = 5;
+   rect.y = 5;
+   rect.w = 10;
+   rect.h = 10;
+   ret = SDL_RenderFillRect(renderer, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+   ret = SDL_RenderDrawLine(renderer, 5, 20, 15, 20);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawLine, expected: 0, got: %i", ret);
+   for (i = 0; i < SDL_arraysize(points); ++i) {
+      points[i].x = 5 + i;
+      points[i].y = 25;
+   }
+   ret = SDL_RenderDrawPoints(renderer, points, SDL_arraysize(points));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+   rect.x = 25;
+   ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   rect.y = 25;
+   ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 90.0, NULL, SDL_FLIP_NONE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = TESTRENDER_SCREEN_W;
+   rect.h = TESTRENDER_SCREEN_H;
+   ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, pixels, TESTRENDER_SCREEN_W * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   /* src + dst * (1 - alpha), clamped to white */
+   er = SDL_min(255, r + (bg * (255 - a)) / 255);
+   eg = SDL_min(255, g + (bg * (255 - a)) / 255);
+   eb = SDL_min(255, b + (bg * (255 - a)) / 255);
+   for (i = 0; ret == 0 && i < SDL_arraysize(checks); ++i) {
+      pixel = pixels[checks[i].y * TESTRENDER_SCREEN_W + checks[i].x];
+      pr = (pixel >> 16) & 0xFF;
+      pg = (pixel >> 8) & 0xFF;
+      pb = pixel & 0xFF;
+      SDLTest_AssertCheck(SDL_abs(pr - er) <= 1 && SDL_abs(pg - eg) <= 1 && SDL_abs(pb - eb) <= 1,
+                          "Validate premultiplied %s, expected: %i,%i,%i, got: %i,%i,%i", what[i], er, eg, eb, pr, pg, pb);
+   }
+
+   SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+   SDL_free(pixels);
+   SDL_free(texels);
+   SDL_DestroyTexture(texture);
+
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1085,9 +2677,42 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testRecordReplay, "render_testRecordReplay", "Tests recording and replaying render calls", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testStats, "render_testStats", "Tests the rendering work counters", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testRenderCopies, "render_testRenderCopies", "Tests copying a texture to many places in one call", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest11 =
+        { (SDLTest_TestCaseFp)render_testYUVTextureUpdates, "render_testYUVTextureUpdates", "Tests partial updates and locks of YUV textures", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest12 =
+        { (SDLTest_TestCaseFp)render_testRotozoomSIMD, "render_testRotozoomSIMD", "Tests the SIMD rotozoom of the software renderer against the scalar code", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest13 =
+        { (SDLTest_TestCaseFp)render_testSoftwareLogicalPresent, "render_testSoftwareLogicalPresent", "Tests drawing at the logical size and scaling it when presenting", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest14 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests drawing in tiles on several threads against drawing on one", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest15 =
+        { (SDLTest_TestCaseFp)render_testTransformCache, "render_testTransformCache", "Tests the software renderer's cache of rotated copies", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest16 =
+        { (SDLTest_TestCaseFp)render_testCopyCoalescing, "render_testCopyCoalescing", "Tests merging consecutive copies against drawing them separately", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest17 =
+        { (SDLTest_TestCaseFp)render_testDirtyPresent, "render_testDirtyPresent", "Tests presenting only the drawn areas against presenting the whole window", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest18 =
+        { (SDLTest_TestCaseFp)render_testPremultipliedBlend, "render_testPremultipliedBlend", "Tests drawing and copying premultiplied colors brighter than their alpha", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, &renderTest13, &renderTest14, &renderTest15, &renderTest16, &renderTest17, &renderTest18, NULL
 };
 
 /* Render test suite (global) */
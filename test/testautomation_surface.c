@@ -589,6 +589,1042 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests bilinear scaling with SDL_SoftStretchLinear
+ */
+int
+surface_testSoftStretchLinear(void *arg)
+{
+    const Uint32 expected[4] = { 0xFF000000, 0xFF404040, 0xFFBFBFBF, 0xFFFFFFFF };
+    SDL_Surface *src, *dst;
+    Uint32 *pixels;
+    int ret, x, y, mismatches;
+
+    /* A two pixel gradient stretched to four pixels samples at the pixel centers */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 2, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 4, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (src == NULL || dst == NULL) {
+        return TEST_ABORTED;
+    }
+    ((Uint32 *)src->pixels)[0] = 0xFF000000;
+    ((Uint32 *)src->pixels)[1] = 0xFFFFFFFF;
+    ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+    SDLTest_AssertPass("Call to SDL_SoftStretchLinear()");
+    SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+    pixels = (Uint32 *)dst->pixels;
+    for (x = 0; x < 4; ++x) {
+        SDLTest_AssertCheck(pixels[x] == expected[x], "Verify pixel %d; expected: 0x%08x, got: 0x%08x", x, expected[x], pixels[x]);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+
+    /* Stretching to the same size is an exact copy, also in the vectorized paths */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 37, 5, 32, SDL_PIXELFORMAT_RGBA8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 37, 5, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (src == NULL || dst == NULL) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < src->h; ++y) {
+        for (x = 0; x < src->w; ++x) {
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = (Uint32)SDLTest_RandomUint32();
+        }
+    }
+    ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+    ret = SDLTest_CompareSurfaces(dst, src, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    SDL_FreeSurface(dst);
+
+    /* A flat color stays flat at any size */
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 83, 29, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+    if (dst == NULL) {
+        SDL_FreeSurface(src);
+        return TEST_ABORTED;
+    }
+    SDL_FillRect(src, NULL, 0x12345678);
+    ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+    mismatches = 0;
+    for (y = 0; y < dst->h; ++y) {
+        for (x = 0; x < dst->w; ++x) {
+            if (((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x] != 0x12345678) {
+                ++mismatches;
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify all pixels keep the fill color; got %d mismatches", mismatches);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+
+    /* Only 32-bit formats can be filtered */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 4, 4, 16, SDL_PIXELFORMAT_RGB565);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 16, SDL_PIXELFORMAT_RGB565);
+    ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == -1, "Verify result value for 16-bit surfaces; expected: -1, got: %i", ret);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that each set of vectorized generic blitters the CPU can run matches the scalar ones exactly
+ */
+int
+surface_testBlitAutoSIMD(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888
+    };
+    static const SDL_BlendMode modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    /* SDL_CPU_SSE2, SDL_CPU_AVX2 | SDL_CPU_SSE2 and SDL_CPU_NEON from SDL_blit.h */
+    static const char *features[] = { "8", "72", "128" };
+    SDL_bool available[SDL_arraysize(features)];
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    char *saved = override ? SDL_strdup(override) : NULL;
+    SDL_Surface *src, *dst, *expected, *actual;
+    int i, j, m, f, x, y, ret, failures = 0;
+
+    /* Forcing features the CPU doesn't have would run instructions it can't */
+    available[0] = SDL_HasSSE2();
+    available[1] = SDL_HasSSE2() && SDL_HasAVX2();
+    available[2] = SDL_HasNEON();
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            for (m = 0; m < SDL_arraysize(modes); ++m) {
+                /* An odd width exercises the partial vectors at the end of each row */
+                const int w = 37, h = 3;
+
+                src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[i]);
+                dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+                expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+                SDLTest_AssertCheck(src && dst && expected, "Verify surfaces are not NULL");
+                if (!src || !dst || !expected) {
+                    failures = -1;
+                    break;
+                }
+                for (y = 0; y < h; ++y) {
+                    for (x = 0; x < w; ++x) {
+                        ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = (Uint32)SDLTest_RandomUint32();
+                        ((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x] = (Uint32)SDLTest_RandomUint32();
+                    }
+                }
+                SDL_SetSurfaceBlendMode(src, modes[m]);
+                SDL_SetSurfaceColorMod(src, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8());
+                SDL_SetSurfaceAlphaMod(src, SDLTest_RandomUint8());
+
+                /* The blit function is chosen again for each new destination,
+                   with the CPU features in SDL_BLIT_CPU_FEATURES at the time */
+                SDL_BlitSurface(dst, NULL, expected, NULL);
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+                ret = SDL_BlitSurface(src, NULL, expected, NULL);
+                SDLTest_AssertCheck(ret == 0, "Verify scalar blit, expected: 0, got: %i", ret);
+                for (f = 0; f < SDL_arraysize(features); ++f) {
+                    if (!available[f]) {
+                        continue;
+                    }
+                    actual = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+                    SDLTest_AssertCheck(actual != NULL, "Verify surface is not NULL");
+                    if (!actual) {
+                        ++failures;
+                        continue;
+                    }
+                    SDL_BlitSurface(dst, NULL, actual, NULL);
+                    SDL_setenv("SDL_BLIT_CPU_FEATURES", features[f], 1);
+                    ret = SDL_BlitSurface(src, NULL, actual, NULL);
+                    SDLTest_AssertCheck(ret == 0, "Verify blit with features %s, expected: 0, got: %i", features[f], ret);
+
+                    if (SDL_memcmp(expected->pixels, actual->pixels, expected->pitch * h) != 0) {
+                        SDLTest_LogError("Blit from %s to %s with blend mode %d and features %s differs from the scalar blit",
+                                         SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), (int)modes[m], features[f]);
+                        ++failures;
+                    }
+                    SDL_FreeSurface(actual);
+                }
+                if (saved) {
+                    SDL_setenv("SDL_BLIT_CPU_FEATURES", saved, 1);
+                } else {
+                    SDL_setenv("SDL_BLIT_CPU_FEATURES", "", 1);
+                }
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(expected);
+            }
+        }
+    }
+    SDL_free(saved);
+    SDLTest_AssertCheck(failures == 0, "Verify all blits match the scalar blits, got %d mismatches", failures);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that blits, conversions and fills split across threads match the single threaded results
+ */
+int
+surface_testBlitThreads(void *arg)
+{
+    const int w = 123, h = 77;
+    SDL_Surface *src, *expected, *actual;
+    SDL_Rect rect;
+    Uint32 *converted;
+    int x, y, ret, pass;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 24, SDL_PIXELFORMAT_BGR24);
+    actual = SDL_CreateRGBSurfaceWithFormat(0, w, h, 24, SDL_PIXELFORMAT_BGR24);
+    converted = (Uint32 *) SDL_malloc(2 * w * h * sizeof (Uint32));
+    SDLTest_AssertCheck(src && expected && actual && converted, "Verify surfaces are not NULL");
+    if (!src || !expected || !actual || !converted) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = (Uint32)SDLTest_RandomUint32();
+        }
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    rect.x = 5;
+    rect.y = 3;
+    rect.w = w - 17;
+    rect.h = h - 9;
+
+    /* Run everything once on the calling thread and once split into bands */
+    for (pass = 0; pass < 2; ++pass) {
+        SDL_Surface *dst = pass ? actual : expected;
+        Uint32 *pixels = converted + pass * w * h;
+
+        if (pass) {
+            SDL_SetHint(SDL_HINT_BLIT_THREADS, "4");
+            SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "1");
+        }
+        SDL_FillRect(dst, NULL, SDL_MapRGB(dst->format, 10, 20, 30));
+        ret = SDL_FillRect(dst, &rect, SDL_MapRGB(dst->format, 200, 100, 50));
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect, expected: 0, got: %i", ret);
+        ret = SDL_BlitSurface(src, &rect, dst, &rect);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, src->pixels, src->pitch,
+                                SDL_PIXELFORMAT_ABGR8888, pixels, w * sizeof (Uint32));
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+        ret = SDL_ConvertPixels(w, h / 2, SDL_PIXELFORMAT_ABGR8888, pixels, 2 * w * sizeof (Uint32),
+                                SDL_PIXELFORMAT_ABGR8888, pixels + w, 2 * w * sizeof (Uint32));
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+    }
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "");
+
+    ret = SDLTest_CompareSurfaces(actual, expected, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    ret = SDL_memcmp(converted, converted + w * h, w * h * sizeof (Uint32));
+    SDLTest_AssertCheck(ret == 0, "Validate converted pixels match, got: %i", ret);
+
+    SDL_free(converted);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(actual);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests conversions between the 24 and 32-bit formats with whole byte channels
+ */
+int
+surface_testByteShuffleConversion(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGRX8888, SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_BGR24
+    };
+    SDL_Surface *src, *dst;
+    int i, j, x, y, failures = 0;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            /* An odd width exercises the pixels after the last full vector */
+            const int w = 37, h = 3;
+
+            src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[i]);
+            SDLTest_AssertCheck(src != NULL, "Verify surface is not NULL");
+            if (src == NULL) {
+                return TEST_ABORTED;
+            }
+            for (x = 0; x < src->pitch * h; ++x) {
+                ((Uint8 *)src->pixels)[x] = SDLTest_RandomUint8();
+            }
+            dst = SDL_ConvertSurfaceFormat(src, formats[j], 0);
+            SDLTest_AssertCheck(dst != NULL, "Verify converted surface is not NULL");
+            if (dst == NULL) {
+                SDL_FreeSurface(src);
+                return TEST_ABORTED;
+            }
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    Uint32 srcpixel = 0, dstpixel = 0;
+                    Uint8 r1, g1, b1, a1, r2, g2, b2, a2;
+
+                    SDL_memcpy(&srcpixel, (Uint8 *)src->pixels + y * src->pitch + x * src->format->BytesPerPixel, src->format->BytesPerPixel);
+                    SDL_memcpy(&dstpixel, (Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel, dst->format->BytesPerPixel);
+                    SDL_GetRGBA(srcpixel, src->format, &r1, &g1, &b1, &a1);
+                    SDL_GetRGBA(dstpixel, dst->format, &r2, &g2, &b2, &a2);
+                    if (r1 != r2 || g1 != g2 || b1 != b2 || (dst->format->Amask && a1 != a2)) {
+                        ++failures;
+                    }
+                }
+            }
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Verify converted pixels keep their color, got %d mismatches", failures);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that blitting one source to many destinations reuses the blit function choice
+ */
+int
+surface_testBlitCache(void *arg)
+{
+    SDL_Surface *src, *dst;
+    Uint64 hits1, misses1, hits2, misses2;
+    int i, ret;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify surface is not NULL");
+    if (src == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_ADD);
+
+    SDL_GetBlitCacheStats(&hits1, &misses1);
+    SDLTest_AssertPass("Call to SDL_GetBlitCacheStats()");
+    for (i = 0; i < 4; ++i) {
+        dst = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 16, SDL_PIXELFORMAT_RGB565);
+        SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+        if (dst == NULL) {
+            SDL_FreeSurface(src);
+            return TEST_ABORTED;
+        }
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        SDL_FreeSurface(dst);
+    }
+    SDL_GetBlitCacheStats(&hits2, &misses2);
+
+    /* The first blit may have been chosen before, the others must be cached */
+    SDLTest_AssertCheck(misses2 - misses1 <= 1, "Verify at most one cache miss, got %d", (int)(misses2 - misses1));
+    SDLTest_AssertCheck(hits2 - hits1 >= 3, "Verify at least three cache hits, got %d", (int)(hits2 - hits1));
+
+    SDL_GetBlitCacheStats(NULL, NULL);
+    SDLTest_AssertPass("Call to SDL_GetBlitCacheStats() with NULL pointers");
+
+    SDL_FreeSurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests recycling of surface pixels through the surface pool
+ */
+int
+surface_testSurfacePool(void *arg)
+{
+    SDL_Surface *surface, *other1, *other2;
+    void *pixels;
+    size_t size;
+
+    SDL_SetSurfacePoolLimit(1024 * 1024);
+    SDLTest_AssertPass("Call to SDL_SetSurfacePoolLimit(1048576)");
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (surface == NULL) {
+        SDL_SetSurfacePoolLimit(0);
+        return TEST_ABORTED;
+    }
+    pixels = surface->pixels;
+    SDL_memset(surface->pixels, 0xAB, surface->h * surface->pitch);
+    SDL_FreeSurface(surface);
+
+    size = SDL_GetSurfacePoolSize();
+    SDLTest_AssertCheck(size == 64 * 32 * 4, "Verify pool size, expected: %d, got: %d", 64 * 32 * 4, (int)size);
+
+    /* A different size or format must not pick up the pooled pixels */
+    other1 = SDL_CreateRGBSurfaceWithFormat(0, 32, 64, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(other1 != NULL && other1->pixels != pixels, "Verify pixels of a different size are not reused");
+    other2 = SDL_CreateRGBSurfaceWithFormat(0, 64, 32, 32, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(other2 != NULL && other2->pixels != pixels, "Verify pixels of a different format are not reused");
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (surface != NULL) {
+        const Uint8 *p = (const Uint8 *)surface->pixels;
+        int i, cleared = 1;
+
+        SDLTest_AssertCheck(surface->pixels == pixels, "Verify pooled pixels are reused");
+        SDLTest_AssertCheck(surface->format->format == SDL_PIXELFORMAT_ARGB8888, "Verify surface format");
+        for (i = 0; i < surface->h * surface->pitch; ++i) {
+            if (p[i] != 0) {
+                cleared = 0;
+                break;
+            }
+        }
+        SDLTest_AssertCheck(cleared, "Verify reused pixels are cleared");
+        SDL_FreeSurface(surface);
+    }
+    SDL_FreeSurface(other1);
+    SDL_FreeSurface(other2);
+
+    /* Indexed surfaces get a fresh palette */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 8, SDL_PIXELFORMAT_INDEX8);
+    SDL_FreeSurface(surface);
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 8, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (surface != NULL) {
+        SDLTest_AssertCheck(surface->format->palette != NULL && surface->format->palette->ncolors == 256, "Verify surface has a palette");
+        SDL_FreeSurface(surface);
+    }
+
+    SDL_TrimSurfacePool(0);
+    size = SDL_GetSurfacePoolSize();
+    SDLTest_AssertCheck(size == 0, "Verify pool is empty after trimming, got: %d", (int)size);
+
+    /* Surfaces larger than the limit are never pooled */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 1024, 512, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_FreeSurface(surface);
+    size = SDL_GetSurfacePoolSize();
+    SDLTest_AssertCheck(size == 0, "Verify large surface is not pooled, got: %d", (int)size);
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_FreeSurface(surface);
+    SDL_SetSurfacePoolLimit(0);
+    SDLTest_AssertPass("Call to SDL_SetSurfacePoolLimit(0)");
+    size = SDL_GetSurfacePoolSize();
+    SDLTest_AssertCheck(size == 0, "Verify pool is empty after disabling, got: %d", (int)size);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests saving and loading pre-encoded RLE surfaces
+ */
+int
+surface_testRLESerialization(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 }
+    };
+    Uint8 buffer[32768];
+    int i, x, y, ret;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *src, *loaded, *dst1, *dst2;
+        SDL_RWops *rw;
+        Sint64 size;
+
+        src = SDL_CreateRGBSurfaceWithFormat(0, 40, 30, 0, formats[i][0]);
+        dst1 = SDL_CreateRGBSurfaceWithFormat(0, 48, 36, 0, formats[i][1]);
+        dst2 = SDL_CreateRGBSurfaceWithFormat(0, 48, 36, 0, formats[i][1]);
+        SDLTest_AssertCheck(src && dst1 && dst2, "Verify surfaces are not NULL");
+        if (!src || !dst1 || !dst2) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst1);
+            SDL_FreeSurface(dst2);
+            return TEST_ABORTED;
+        }
+
+        /* Transparent, translucent and opaque runs */
+        for (y = 0; y < src->h; ++y) {
+            for (x = 0; x < src->w; ++x) {
+                Uint8 a = (x + y) % 5 == 0 ? 0 : ((x * 7 + y) % 3 == 0 ? 128 : 255);
+                Uint32 pixel = SDL_MapRGBA(src->format, x * 6, y * 8, 255 - x * 6, a);
+                if (src->format->BytesPerPixel == 2) {
+                    if (a == 0) {
+                        pixel = 0;
+                    }
+                    *((Uint16 *)((Uint8 *)src->pixels + y * src->pitch) + x) = (Uint16)pixel;
+                } else {
+                    *((Uint32 *)((Uint8 *)src->pixels + y * src->pitch) + x) = pixel;
+                }
+            }
+        }
+        if (!src->format->Amask) {
+            SDL_SetColorKey(src, SDL_TRUE, 0);
+        }
+        SDL_FillRect(dst1, NULL, SDL_MapRGB(dst1->format, 10, 20, 30));
+        SDL_FillRect(dst2, NULL, SDL_MapRGB(dst2->format, 10, 20, 30));
+
+        ret = SDL_PrepareSurfaceRLE(src, formats[i][1]);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PrepareSurfaceRLE, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck((src->flags & SDL_RLEACCEL) != 0, "Verify surface is RLE encoded");
+        ret = SDL_BlitSurface(src, NULL, dst1, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        rw = SDL_RWFromMem(buffer, sizeof(buffer));
+        ret = SDL_SaveRLE_RW(src, rw, 0);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveRLE_RW, expected: 0, got: %i", ret);
+        size = SDL_RWtell(rw);
+        SDL_RWclose(rw);
+
+        loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size), 1);
+        SDLTest_AssertCheck(loaded != NULL, "Verify result from SDL_LoadRLE_RW is not NULL");
+        if (loaded) {
+            SDLTest_AssertCheck(loaded->w == src->w && loaded->h == src->h &&
+                                loaded->format->format == src->format->format,
+                                "Verify loaded surface size and format");
+            ret = SDL_BlitSurface(loaded, NULL, dst2, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+            SDLTest_AssertCheck((loaded->flags & SDL_RLEACCEL) && loaded->pixels == NULL,
+                                "Verify loaded surface was blitted without encoding it again");
+            ret = SDLTest_CompareSurfaces(dst2, dst1, 0);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+            SDL_FreeSurface(loaded);
+        }
+
+        /* Damaged data is rejected */
+        buffer[0] ^= 0xFF;
+        loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size), 1);
+        SDLTest_AssertCheck(loaded == NULL, "Verify a bad header is rejected");
+        buffer[0] ^= 0xFF;
+        loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size - 8), 1);
+        SDLTest_AssertCheck(loaded == NULL, "Verify truncated data is rejected");
+        {
+            /* A packed 32-bit format with a 5551 layout isn't a real format */
+            static const Uint8 unknown[4] = { 0x04, 0x18, 0x14, 0x16 };
+            Uint8 saved[4];
+
+            SDL_memcpy(saved, &buffer[12], 4);
+            SDL_memcpy(&buffer[12], unknown, 4);
+            loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size), 1);
+            SDLTest_AssertCheck(loaded == NULL, "Verify an unknown pixel format is rejected");
+            if (loaded) {
+                SDL_BlitSurface(loaded, NULL, dst2, NULL);
+                SDL_FreeSurface(loaded);
+            }
+            SDL_memcpy(&buffer[12], saved, 4);
+        }
+        if (src->format->Amask) {
+            Uint8 saved = buffer[14];
+
+            /* The pixel format is the fourth header field, changing it gives
+               a packed format with channels wider than 8 bits */
+            buffer[14] = 0x17;
+            loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size), 1);
+            SDLTest_AssertCheck(loaded == NULL, "Verify a pixel format the encoder can't take is rejected");
+            SDL_FreeSurface(loaded);
+            buffer[14] = saved;
+
+            /* The encoding follows the 11 header fields and its size, and
+               starts with the destination format: bytes per pixel, padding,
+               then the red mask */
+            buffer[55] ^= 0x01;
+            loaded = SDL_LoadRLE_RW(SDL_RWFromConstMem(buffer, (int)size), 1);
+            SDLTest_AssertCheck(loaded == NULL, "Verify a bad destination format mask is rejected");
+            SDL_FreeSurface(loaded);
+            buffer[55] ^= 0x01;
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst1);
+        SDL_FreeSurface(dst2);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests filling batches of rects with regular and non-temporal stores
+ */
+int
+surface_testFillRects(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888
+    };
+    /* Unsorted and overlapping, partly outside the surface */
+    static const SDL_Rect rects[] = {
+        { 50, 40, 200, 9 }, { 3, 1, 77, 20 }, { -10, 30, 30, 50 },
+        { 1, 1, 300, 3 }, { 250, 60, 100, 10 }, { 17, 5, 1, 70 }
+    };
+    const char *thresholds[] = { "0", "" };
+    int f, t, i, x, y, ret;
+
+    for (t = 0; t < SDL_arraysize(thresholds); ++t) {
+        SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, thresholds[t]);
+        for (f = 0; f < SDL_arraysize(formats); ++f) {
+            SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 283, 71, 0, formats[f]);
+            const int bpp = SDL_BYTESPERPIXEL(formats[f]);
+            const Uint32 color = 0x00A1B2C3 & (bpp == 4 ? 0xFFFFFFFF : ((1u << (bpp * 8)) - 1));
+            int errors = 0;
+
+            SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+            if (surface == NULL) {
+                SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, "");
+                return TEST_ABORTED;
+            }
+            ret = SDL_FillRects(surface, rects, SDL_arraysize(rects), color);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRects, expected: 0, got: %i", ret);
+
+            for (y = 0; y < surface->h; ++y) {
+                for (x = 0; x < surface->w; ++x) {
+                    const Uint8 *p = (const Uint8 *)surface->pixels + y * surface->pitch + x * bpp;
+                    Uint32 expected = 0, pixel = 0;
+                    for (i = 0; i < SDL_arraysize(rects); ++i) {
+                        if (x >= rects[i].x && x < rects[i].x + rects[i].w &&
+                            y >= rects[i].y && y < rects[i].y + rects[i].h) {
+                            expected = color;
+                        }
+                    }
+                    switch (bpp) {
+                    case 1:
+                        pixel = *p;
+                        break;
+                    case 2:
+                        pixel = *(const Uint16 *)p;
+                        break;
+                    case 3:
+                        if (SDL_BYTEORDER == SDL_LIL_ENDIAN) {
+                            pixel = p[0] | (p[1] << 8) | (p[2] << 16);
+                        } else {
+                            pixel = (p[0] << 16) | (p[1] << 8) | p[2];
+                        }
+                        break;
+                    default:
+                        pixel = *(const Uint32 *)p;
+                        break;
+                    }
+                    if (pixel != expected) {
+                        ++errors;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify filled pixels of %s with threshold '%s', expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(formats[f]), thresholds[t], errors);
+            SDL_FreeSurface(surface);
+        }
+    }
+    SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, "");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that fills of 8 and 16-bit surfaces ignore the unused high bits of the color
+ */
+int
+surface_testFillRectHighBits(void *arg)
+{
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565 };
+    static const Uint32 colors[] = { 0x12345678, 0x9abcdef0 };
+    const char *thresholds[] = { "0", "" };
+    int f, c, t, x, y, ret;
+
+    for (t = 0; t < SDL_arraysize(thresholds); ++t) {
+        SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, thresholds[t]);
+        for (f = 0; f < SDL_arraysize(formats); ++f) {
+            for (c = 0; c < SDL_arraysize(colors); ++c) {
+                SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 133, 17, 0, formats[f]);
+                const int bpp = SDL_BYTESPERPIXEL(formats[f]);
+                const Uint32 expected = colors[c] & ((1u << (bpp * 8)) - 1);
+                int errors = 0;
+
+                SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+                if (surface == NULL) {
+                    SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, "");
+                    return TEST_ABORTED;
+                }
+                ret = SDL_FillRect(surface, NULL, colors[c]);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect, expected: 0, got: %i", ret);
+
+                for (y = 0; y < surface->h; ++y) {
+                    for (x = 0; x < surface->w; ++x) {
+                        const Uint8 *p = (const Uint8 *)surface->pixels + y * surface->pitch + x * bpp;
+                        const Uint32 pixel = (bpp == 1) ? *p : *(const Uint16 *)p;
+                        if (pixel != expected) {
+                            ++errors;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(errors == 0, "Verify fill of %s with 0x%.8x and threshold '%s', expected: 0 errors, got: %i",
+                                    SDL_GetPixelFormatName(formats[f]), colors[c], thresholds[t], errors);
+                SDL_FreeSurface(surface);
+            }
+        }
+    }
+    SDL_SetHint(SDL_HINT_FILL_STREAM_THRESHOLD, "");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests colorkey blits against per-pixel expected values
+ */
+int
+surface_testBlitColorKey(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGRA8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565 }
+    };
+    const int w = 45, h = 7;
+    int f, x, y, ret;
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f][0]);
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f][1]);
+        SDL_Surface *orig = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f][1]);
+        Uint32 key;
+        int errors = 0;
+
+        SDLTest_AssertCheck(src && dst && orig, "Verify surfaces are not NULL");
+        if (!src || !dst || !orig) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+            return TEST_ABORTED;
+        }
+        key = SDL_MapRGBA(src->format, 0x10, 0xE0, 0x30, 0xFF);
+
+        /* Runs of keyed pixels of different lengths, some with a different alpha */
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                const int i = y * w + x;
+                Uint8 *sp = (Uint8 *)src->pixels + y * src->pitch + x * src->format->BytesPerPixel;
+                Uint8 *dp = (Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel;
+                Uint32 s, d;
+                if ((i % 13) < (y + 1) || (i % 29) == 0) {
+                    s = SDL_MapRGBA(src->format, 0x10, 0xE0, 0x30, (Uint8)(i * 7));
+                } else {
+                    s = SDL_MapRGBA(src->format, (Uint8)(i * 3), (Uint8)(i * 5 + 1), (Uint8)(255 - i), (Uint8)(i * 11));
+                }
+                d = SDL_MapRGBA(dst->format, (Uint8)(i * 17), (Uint8)(i + 9), (Uint8)(i * 2), (Uint8)(200 - i));
+                if (src->format->BytesPerPixel == 2) {
+                    *(Uint16 *)sp = (Uint16)s;
+                    *(Uint16 *)dp = (Uint16)d;
+                } else {
+                    *(Uint32 *)sp = s;
+                    *(Uint32 *)dp = d;
+                }
+            }
+        }
+        SDL_memcpy(orig->pixels, dst->pixels, dst->h * dst->pitch);
+
+        ret = SDL_SetColorKey(src, SDL_TRUE, key);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetColorKey, expected: 0, got: %i", ret);
+        ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                const Uint8 *sp = (const Uint8 *)src->pixels + y * src->pitch + x * src->format->BytesPerPixel;
+                const Uint8 *dp = (const Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel;
+                const Uint8 *op = (const Uint8 *)orig->pixels + y * orig->pitch + x * orig->format->BytesPerPixel;
+                Uint32 s, d, expected;
+                Uint8 r, g, b, a;
+                if (src->format->BytesPerPixel == 2) {
+                    s = *(const Uint16 *)sp;
+                    d = *(const Uint16 *)dp;
+                    expected = *(const Uint16 *)op;
+                } else {
+                    s = *(const Uint32 *)sp;
+                    d = *(const Uint32 *)dp;
+                    expected = *(const Uint32 *)op;
+                }
+                if ((s & ~src->format->Amask) != (key & ~src->format->Amask)) {
+                    SDL_GetRGBA(s, src->format, &r, &g, &b, &a);
+                    expected = SDL_MapRGBA(dst->format, r, g, b, a);
+                }
+                if (d != expected) {
+                    ++errors;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Verify colorkey blit from %s to %s, expected: 0 errors, got: %i",
+                            SDL_GetPixelFormatName(formats[f][0]), SDL_GetPixelFormatName(formats[f][1]), errors);
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(orig);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests blits from 8-bit paletted surfaces, including palette changes between blits
+ */
+int
+surface_testBlitPalette(void *arg)
+{
+    static const int ncolors[] = { 4, 16, 256 };
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888 };
+    const int w = 77, h = 5;
+    SDL_Color colors[256];
+    int c, f, k, frame, x, y, i, ret;
+
+    for (c = 0; c < SDL_arraysize(ncolors); ++c) {
+        for (f = 0; f < SDL_arraysize(formats); ++f) {
+            for (k = 0; k < 2; ++k) {
+                SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 8, SDL_PIXELFORMAT_INDEX8);
+                SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+                SDL_Palette *palette = SDL_AllocPalette(ncolors[c]);
+                SDL_Palette *big = SDL_AllocPalette(256);
+                const Uint32 key = 1;
+                int errors = 0;
+
+                SDLTest_AssertCheck(src && dst && palette && big, "Verify surfaces and palettes are not NULL");
+                if (!src || !dst || !palette || !big) {
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    SDL_FreePalette(palette);
+                    SDL_FreePalette(big);
+                    return TEST_ABORTED;
+                }
+                SDL_SetSurfacePalette(src, palette);
+                if (k) {
+                    SDL_SetColorKey(src, SDL_TRUE, key);
+                }
+
+                /* The second frame changes the colors after the map was set up,
+                   the third swaps in a bigger palette behind the map's back */
+                for (frame = 0; frame < 3; ++frame) {
+                    SDL_Palette *current = palette;
+                    if (frame == 2) {
+                        ret = SDL_SetPixelFormatPalette(src->format, big);
+                        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetPixelFormatPalette, expected: 0, got: %i", ret);
+                        current = big;
+                    }
+                    for (y = 0; y < h; ++y) {
+                        for (x = 0; x < w; ++x) {
+                            ((Uint8 *)src->pixels)[y * src->pitch + x] = (Uint8)(((x * 7 + y * 3) / (y + 1)) % current->ncolors);
+                        }
+                    }
+                    for (i = 0; i < current->ncolors; ++i) {
+                        colors[i].r = (Uint8)(i * 37 + frame * 101);
+                        colors[i].g = (Uint8)(i * 11 + 50);
+                        colors[i].b = (Uint8)(255 - i * 3 - frame);
+                        colors[i].a = (Uint8)(128 + i);
+                    }
+                    SDL_SetPaletteColors(current, colors, 0, current->ncolors);
+                    SDL_FillRect(dst, NULL, SDL_MapRGBA(dst->format, 1, 2, 3, 4));
+                    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+                    for (y = 0; y < h; ++y) {
+                        for (x = 0; x < w; ++x) {
+                            const Uint8 index = ((const Uint8 *)src->pixels)[y * src->pitch + x];
+                            const Uint8 *p = (const Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel;
+                            const Uint32 pixel = (dst->format->BytesPerPixel == 2) ? *(const Uint16 *)p : *(const Uint32 *)p;
+                            Uint32 expected;
+                            if (k && index == key) {
+                                expected = SDL_MapRGBA(dst->format, 1, 2, 3, 4);
+                            } else {
+                                expected = SDL_MapRGBA(dst->format, colors[index].r, colors[index].g, colors[index].b, colors[index].a);
+                            }
+                            if (pixel != expected) {
+                                ++errors;
+                            }
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(errors == 0, "Verify %d color %s blit to %s, expected: 0 errors, got: %i",
+                                    ncolors[c], k ? "colorkey" : "copy", SDL_GetPixelFormatName(formats[f]), errors);
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreePalette(palette);
+                SDL_FreePalette(big);
+            }
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests premultiplied alpha blits against the blend formula
+ */
+int
+surface_testBlitPremultiplied(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888,
+        SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565
+    };
+    static const Uint8 alphamods[] = { 255, 160 };
+    const int w = 45, h = 7;
+    SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Surface *straight = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_BlendMode blendMode;
+    Uint16 premultiplied4444[45 * 7];
+    Uint16 expected4444[45 * 7];
+    int f, m, x, y, ret;
+
+    SDLTest_AssertCheck(src && straight, "Verify source surfaces are not NULL");
+    if (!src || !straight) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(straight);
+        return TEST_ABORTED;
+    }
+
+    /* Opaque and transparent rows for the shortcuts, and some colors
+       brighter than their alpha that have to saturate */
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            Uint32 a = (Uint32)(x * 29 + y * 53) & 0xFF;
+            Uint32 r = (Uint32)(x * 37 + y * 11) & 0xFF;
+            Uint32 g = (Uint32)(x * 5 + y * 71) & 0xFF;
+            Uint32 b = (Uint32)(255 - x * 3 - y) & 0xFF;
+            if (y == 1 || (y > 1 && x % 9 == 0)) {
+                a = 0;
+            } else if (y == 0 || x % 9 == 1) {
+                a = 255;
+            }
+            ((Uint32 *)((Uint8 *)straight->pixels + y * straight->pitch))[x] = (a << 24) | (r << 16) | (g << 8) | b;
+            if (x % 5) {
+                r = (r * a) / 255;
+                g = (g * a) / 255;
+                b = (b * a) / 255;
+            }
+            if (y == 1) {
+                r = g = b = 0;
+            }
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+    ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+    ret = SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDLTest_AssertCheck(ret == 0 && blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+                        "Verify SDL_GetSurfaceBlendMode returns the premultiplied blend mode, got: %i", (int)blendMode);
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        for (m = 0; m < SDL_arraysize(alphamods); ++m) {
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+            SDL_Surface *orig = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+            const Uint32 mod = alphamods[m];
+            int errors = 0;
+
+            SDLTest_AssertCheck(dst && orig, "Verify destination surfaces are not NULL");
+            if (!dst || !orig) {
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(orig);
+                continue;
+            }
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    SDL_Rect rect;
+                    rect.x = x;
+                    rect.y = y;
+                    rect.w = rect.h = 1;
+                    SDL_FillRect(orig, &rect, SDL_MapRGBA(orig->format, (Uint8)(x * 13 + y), (Uint8)(200 - x), (Uint8)(y * 40), (Uint8)(x * 7)));
+                }
+            }
+            SDL_SetSurfaceBlendMode(orig, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(orig, NULL, dst, NULL);
+            SDL_SetSurfaceAlphaMod(src, (Uint8)mod);
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    const Uint32 s = ((const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch))[x];
+                    const int bpp = dst->format->BytesPerPixel;
+                    const Uint8 *p = (const Uint8 *)orig->pixels + y * orig->pitch + x * bpp;
+                    const Uint8 *q = (const Uint8 *)dst->pixels + y * dst->pitch + x * bpp;
+                    Uint32 sc[4], dc[4];
+                    Uint8 r, g, b, a;
+                    int i;
+
+                    SDL_GetRGBA((bpp == 2) ? *(const Uint16 *)p : *(const Uint32 *)p, orig->format, &r, &g, &b, &a);
+                    dc[0] = r;
+                    dc[1] = g;
+                    dc[2] = b;
+                    dc[3] = a;
+                    sc[0] = (s >> 16) & 0xFF;
+                    sc[1] = (s >> 8) & 0xFF;
+                    sc[2] = s & 0xFF;
+                    sc[3] = s >> 24;
+                    for (i = 0; i < 4; ++i) {
+                        if (mod != 255) {
+                            sc[i] = (sc[i] * mod) / 255;
+                        }
+                    }
+                    for (i = 0; i < 4; ++i) {
+                        dc[i] = SDL_min(255, sc[i] + ((255 - sc[3]) * dc[i]) / 255);
+                    }
+                    if ((bpp == 2 ? *(const Uint16 *)q : *(const Uint32 *)q) !=
+                        SDL_MapRGBA(dst->format, (Uint8)dc[0], (Uint8)dc[1], (Uint8)dc[2], (Uint8)dc[3])) {
+                        ++errors;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify premultiplied blit to %s with alpha mod %d, expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(formats[f]), (int)mod, errors);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+        }
+    }
+
+    /* Premultiplying at load time, in place and through a conversion */
+    ret = SDL_PremultiplyAlpha(w, h, SDL_PIXELFORMAT_ARGB8888, straight->pixels, straight->pitch,
+                               SDL_PIXELFORMAT_ARGB4444, premultiplied4444, w * 2);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplyAlpha, expected: 0, got: %i", ret);
+    ret = SDL_PremultiplySurfaceAlpha(straight);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplySurfaceAlpha, expected: 0, got: %i", ret);
+    ret = SDL_GetSurfaceBlendMode(straight, &blendMode);
+    SDLTest_AssertCheck(ret == 0 && blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+                        "Verify SDL_PremultiplySurfaceAlpha sets the premultiplied blend mode, got: %i", (int)blendMode);
+    ret = 0;
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            const Uint32 s = ((const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch))[x];
+            const Uint32 p = ((const Uint32 *)((const Uint8 *)straight->pixels + y * straight->pitch))[x];
+            if (x % 5 && p != s) {
+                ++ret;
+            }
+        }
+    }
+    SDLTest_AssertCheck(ret == 0, "Verify premultiplied pixels, expected: 0 errors, got: %i", ret);
+    SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, straight->pixels, straight->pitch,
+                      SDL_PIXELFORMAT_ARGB4444, expected4444, w * 2);
+    SDLTest_AssertCheck(SDL_memcmp(premultiplied4444, expected4444, sizeof(expected4444)) == 0,
+                        "Verify SDL_PremultiplyAlpha converts the premultiplied pixels");
+
+    /* Converting in place would read pixels it already wrote */
+    ret = SDL_PremultiplyAlpha(w, h, SDL_PIXELFORMAT_ARGB8888, straight->pixels, straight->pitch,
+                               SDL_PIXELFORMAT_ABGR8888, straight->pixels, straight->pitch);
+    SDLTest_AssertCheck(ret == -1, "Verify SDL_PremultiplyAlpha in place with another format fails, expected: -1, got: %i", ret);
+    ret = SDL_PremultiplyAlpha(w, h / 2, SDL_PIXELFORMAT_ARGB8888, straight->pixels, straight->pitch,
+                               SDL_PIXELFORMAT_ARGB8888, straight->pixels, straight->pitch * 2);
+    SDLTest_AssertCheck(ret == -1, "Verify SDL_PremultiplyAlpha in place with another pitch fails, expected: -1, got: %i", ret);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(straight);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -631,11 +1667,50 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testSoftStretchLinear, "surface_testSoftStretchLinear", "Tests bilinear scaling with SDL_SoftStretchLinear", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testBlitAutoSIMD, "surface_testBlitAutoSIMD", "Tests that vectorized blits match the scalar blits", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testBlitThreads, "surface_testBlitThreads", "Tests blits, conversions and fills split across threads", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testByteShuffleConversion, "surface_testByteShuffleConversion", "Tests conversions between 24 and 32-bit formats", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testBlitCache, "surface_testBlitCache", "Tests the blit function cache", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testSurfacePool, "surface_testSurfacePool", "Tests recycling of surface pixels", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testRLESerialization, "surface_testRLESerialization", "Tests saving and loading pre-encoded RLE surfaces", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests filling batches of rects", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest21 =
+        { (SDLTest_TestCaseFp)surface_testBlitColorKey, "surface_testBlitColorKey", "Tests colorkey blits between 16 and 32-bit formats", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest22 =
+        { (SDLTest_TestCaseFp)surface_testBlitPalette, "surface_testBlitPalette", "Tests blits from paletted surfaces", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest23 =
+        { (SDLTest_TestCaseFp)surface_testBlitPremultiplied, "surface_testBlitPremultiplied", "Tests premultiplied alpha blits", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest24 =
+        { (SDLTest_TestCaseFp)surface_testFillRectHighBits, "surface_testFillRectHighBits", "Tests 8 and 16-bit fills with high bits set in the color", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, &surfaceTest16, &surfaceTest17, &surfaceTest18,
+    &surfaceTest19, &surfaceTest20, &surfaceTest21, &surfaceTest22,
+    &surfaceTest23, &surfaceTest24, NULL
 };
 
 /* Surface test suite (global) */
@@ -42,7 +42,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
 
         /* R, G, B in alternating horizontal bands */
         for (y = 0; y < pattern->h; y += thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (y + i) < pattern->h; ++i) {
                 p = (Uint8 *)pattern->pixels + (y + i) * pattern->pitch + ((y/thickness) % 3);
                 for (x = 0; x < pattern->w; ++x) {
                     *p = 0xFF;
@@ -111,6 +111,275 @@ static SDL_bool verify_yuv_data(Uint32 format, const Uint8 *yuv, int yuv_pitch,
     return result;
 }
 
+/* Puts the samples of an NV12 image in the high bits of a P010 image */
+static void widen_nv12_to_p010(int w, int h, const Uint8 *nv12, int nv12_pitch, Uint8 *p010, int p010_pitch)
+{
+    const int uv_w = 2 * ((w + 1) / 2);
+    const int uv_h = (h + 1) / 2;
+    const Uint8 *nv12_uv = nv12 + h * nv12_pitch;
+    Uint8 *p010_uv = p010 + h * p010_pitch;
+    int x, y;
+
+    for (y = 0; y < h; ++y) {
+        Uint16 *dst = (Uint16 *)(p010 + y * p010_pitch);
+        for (x = 0; x < w; ++x) {
+            dst[x] = SDL_SwapLE16(nv12[y * nv12_pitch + x] << 8);
+        }
+    }
+    nv12_pitch = 2 * ((nv12_pitch + 1) / 2);
+    p010_pitch = 4 * ((p010_pitch + 3) / 4);
+    for (y = 0; y < uv_h; ++y) {
+        Uint16 *dst = (Uint16 *)(p010_uv + y * p010_pitch);
+        for (x = 0; x < uv_w; ++x) {
+            dst[x] = SDL_SwapLE16(nv12_uv[y * nv12_pitch + x] << 8);
+        }
+    }
+}
+
+/* Converts random ARGB8888 pixels to each YUV format with and without SIMD,
+   SDL_BLIT_CPU_FEATURES=0 forces the scalar code, and checks the bytes match */
+static SDL_bool verify_simd_rgb_to_yuv(const Uint32 *formats, int num_formats, int w, int h, int extra_pitch)
+{
+    const SDL_YUV_CONVERSION_MODE modes[] = {
+        SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+    };
+    const SDL_YUV_CONVERSION_MODE saved_mode = SDL_GetYUVConversionMode();
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    char *saved_override = override ? SDL_strdup(override) : NULL;
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(w, h, extra_pitch);
+    const int rgb_pitch = w * 4;
+    Uint32 *rgb = (Uint32 *)SDL_malloc(rgb_pitch * h);
+    Uint8 *scalar = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *simd = (Uint8 *)SDL_malloc(yuv_len);
+    Uint32 seed = 0x12345678;
+    SDL_bool result = SDL_FALSE;
+    int i, m;
+
+    if (!rgb || !scalar || !simd) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        goto done;
+    }
+    for (i = 0; i < w * h; ++i) {
+        seed = seed * 1103515245 + 12345;
+        rgb[i] = seed;
+    }
+
+    for (m = 0; m < SDL_arraysize(modes); ++m) {
+        SDL_SetYUVConversionMode(modes[m]);
+        for (i = 0; i < num_formats; ++i) {
+            const int yuv_pitch = CalculateYUVPitch(formats[i], w) + extra_pitch;
+
+            SDL_memset(scalar, 0xAA, yuv_len);
+            SDL_memset(simd, 0xAA, yuv_len);
+            SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+            if (SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, rgb, rgb_pitch, formats[i], scalar, yuv_pitch) < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetError());
+                goto done;
+            }
+            SDL_setenv("SDL_BLIT_CPU_FEATURES", saved_override ? saved_override : "", 1);
+            if (SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, rgb, rgb_pitch, formats[i], simd, yuv_pitch) < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetError());
+                goto done;
+            }
+            if (SDL_memcmp(scalar, simd, yuv_len) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SIMD conversion to %s with mode %d differs from the scalar conversion\n", SDL_GetPixelFormatName(formats[i]), (int)modes[m]);
+                goto done;
+            }
+        }
+    }
+    result = SDL_TRUE;
+
+done:
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", saved_override ? saved_override : "", 1);
+    SDL_SetYUVConversionMode(saved_mode);
+    SDL_free(saved_override);
+    SDL_free(rgb);
+    SDL_free(scalar);
+    SDL_free(simd);
+    return result;
+}
+
+/* Returns the pitch of a tightly packed row of width pixels */
+static int calculate_pitch(Uint32 format, int width)
+{
+    if (format == SDL_PIXELFORMAT_P010 || format == SDL_PIXELFORMAT_P016) {
+        return 2 * width;
+    }
+    if (SDL_ISPIXELFORMAT_FOURCC(format)) {
+        return CalculateYUVPitch(format, width);
+    }
+    return SDL_BYTESPERPIXEL(format) * width;
+}
+
+/* Converts random frames from each YUV format with AVX2 and with SSE2 only,
+   forced with SDL_BLIT_CPU_FEATURES, and checks the bytes match. The SSE2
+   conversions are the scalar ones on CPUs without SSE2 and round differently
+   from them otherwise, so AVX2 has to match SSE2 exactly. */
+static SDL_bool verify_simd_yuv_to_rgb(const Uint32 *formats, int num_formats, int w, int h, int extra_pitch)
+{
+    const Uint32 rgb_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_ARGB2101010
+    };
+    const SDL_YUV_CONVERSION_MODE modes[] = {
+        SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+    };
+    const SDL_YUV_CONVERSION_MODE saved_mode = SDL_GetYUVConversionMode();
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    char *saved_override = override ? SDL_strdup(override) : NULL;
+    const int yuv_len = 2 * MAX_YUV_SURFACE_SIZE(w, h, extra_pitch); /* big enough for P010 */
+    const int rgb_pitch = w * 4 + extra_pitch;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *sse2 = (Uint8 *)SDL_malloc(rgb_pitch * h);
+    Uint8 *avx2 = (Uint8 *)SDL_malloc(rgb_pitch * h);
+    Uint32 seed = 0x87654321;
+    SDL_bool result = SDL_FALSE;
+    int i, j, m;
+
+    if (!yuv || !sse2 || !avx2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        goto done;
+    }
+    for (i = 0; i < yuv_len; ++i) {
+        seed = seed * 1103515245 + 12345;
+        yuv[i] = (Uint8)(seed >> 24);
+    }
+
+    for (m = 0; m < SDL_arraysize(modes); ++m) {
+        SDL_SetYUVConversionMode(modes[m]);
+        for (i = 0; i < num_formats; ++i) {
+            const int yuv_pitch = calculate_pitch(formats[i], w) + extra_pitch;
+
+            for (j = 0; j < SDL_arraysize(rgb_formats); ++j) {
+                if (rgb_formats[j] == SDL_PIXELFORMAT_ARGB2101010 && formats[i] != SDL_PIXELFORMAT_P010) {
+                    /* Only converted from the 10 bit formats */
+                    continue;
+                }
+
+                SDL_memset(sse2, 0xAA, rgb_pitch * h);
+                SDL_memset(avx2, 0xAA, rgb_pitch * h);
+                /* SDL_CPU_SSE2 from SDL_blit.h */
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", "8", 1);
+                if (SDL_ConvertPixels(w, h, formats[i], yuv, yuv_pitch, rgb_formats[j], sse2, rgb_pitch) < 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), SDL_GetError());
+                    goto done;
+                }
+                /* SDL_CPU_AVX2 | SDL_CPU_SSE2 from SDL_blit.h */
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", "72", 1);
+                if (SDL_ConvertPixels(w, h, formats[i], yuv, yuv_pitch, rgb_formats[j], avx2, rgb_pitch) < 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), SDL_GetError());
+                    goto done;
+                }
+                if (SDL_memcmp(sse2, avx2, rgb_pitch * h) != 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "AVX2 conversion from %s to %s with mode %d differs from the SSE2 conversion\n",
+                                 SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), (int)modes[m]);
+                    goto done;
+                }
+            }
+        }
+    }
+    result = SDL_TRUE;
+
+done:
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", saved_override ? saved_override : "", 1);
+    SDL_SetYUVConversionMode(saved_mode);
+    SDL_free(saved_override);
+    SDL_free(yuv);
+    SDL_free(sse2);
+    SDL_free(avx2);
+    return result;
+}
+
+/* Converts random frames between YUV and RGB formats on several threads and
+   checks the bytes match the single threaded conversion. The odd sizes and
+   thread counts put band boundaries on odd rows where the format allows it,
+   and leave a last band with an odd row for vertically subsampled chroma. */
+static SDL_bool verify_threaded_conversions(void)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU,
+        SDL_PIXELFORMAT_P010,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_ARGB2101010
+    };
+    const struct { int w, h; } sizes[] = { { 1, 1 }, { 3, 3 }, { 7, 2 }, { 34, 7 }, { 67, 37 }, { 99, 101 } };
+    const char *threads[] = { "2", "3", "7" };
+    const int len = 4 * (99 + 1) * (101 + 1);
+    Uint8 *src = (Uint8 *)SDL_malloc(len);
+    Uint8 *expected = (Uint8 *)SDL_malloc(len);
+    Uint8 *actual = (Uint8 *)SDL_malloc(len);
+    Uint32 seed = 0x9e3779b9;
+    SDL_bool result = SDL_FALSE;
+    int i, j, k, t;
+
+    if (!src || !expected || !actual) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        goto done;
+    }
+    for (i = 0; i < len; ++i) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = (Uint8)(seed >> 24);
+    }
+
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "1");
+    for (k = 0; k < SDL_arraysize(sizes); ++k) {
+        const int w = sizes[k].w, h = sizes[k].h;
+        for (i = 0; i < SDL_arraysize(formats); ++i) {
+            for (j = 0; j < SDL_arraysize(formats); ++j) {
+                const int src_pitch = calculate_pitch(formats[i], w);
+                const int dst_pitch = calculate_pitch(formats[j], w);
+                int ret1, ret2;
+
+                if (!SDL_ISPIXELFORMAT_FOURCC(formats[i]) && !SDL_ISPIXELFORMAT_FOURCC(formats[j])) {
+                    continue;
+                }
+
+                SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+                SDL_memset(expected, 0xAA, len);
+                ret1 = SDL_ConvertPixels(w, h, formats[i], src, src_pitch, formats[j], expected, dst_pitch);
+                for (t = 0; t < SDL_arraysize(threads); ++t) {
+                    SDL_SetHint(SDL_HINT_BLIT_THREADS, threads[t]);
+                    SDL_memset(actual, 0xAA, len);
+                    ret2 = SDL_ConvertPixels(w, h, formats[i], src, src_pitch, formats[j], actual, dst_pitch);
+                    if (ret1 != ret2) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Converting %dx%d %s to %s returned %d on %s threads, %d on one\n",
+                                     w, h, SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), ret2, threads[t], ret1);
+                        goto done;
+                    }
+                    if (ret1 == 0 && SDL_memcmp(expected, actual, len) != 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Converting %dx%d %s to %s on %s threads differs from one thread\n",
+                                     w, h, SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), threads[t]);
+                        goto done;
+                    }
+                }
+            }
+        }
+    }
+    result = SDL_TRUE;
+
+done:
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, NULL);
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, NULL);
+    SDL_free(src);
+    SDL_free(expected);
+    SDL_free(actual);
+    return result;
+}
+
 static int run_automated_tests(int pattern_size, int extra_pitch)
 {
     const Uint32 formats[] = {
@@ -122,11 +391,12 @@ static int run_automated_tests(int pattern_size, int extra_pitch)
         SDL_PIXELFORMAT_UYVY,
         SDL_PIXELFORMAT_YVYU
     };
+    const Uint32 p010 = SDL_PIXELFORMAT_P010;
     int i, j;
     SDL_Surface *pattern = generate_test_pattern(pattern_size);
     const int yuv_len = MAX_YUV_SURFACE_SIZE(pattern->w, pattern->h, extra_pitch);
     Uint8 *yuv1 = (Uint8 *)SDL_malloc(yuv_len);
-    Uint8 *yuv2 = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *yuv2 = (Uint8 *)SDL_malloc(2 * yuv_len); /* big enough for P010 */
     int yuv1_pitch, yuv2_pitch;
     int result = -1;
     
@@ -148,6 +418,19 @@ static int run_automated_tests(int pattern_size, int extra_pitch)
         }
     }
 
+    /* Verify conversion from P010 */
+    yuv1_pitch = CalculateYUVPitch(SDL_PIXELFORMAT_NV12, pattern->w) + extra_pitch;
+    yuv2_pitch = 2 * (pattern->w + extra_pitch);
+    if (SDL_ConvertPixels(pattern->w, pattern->h, pattern->format->format, pattern->pixels, pattern->pitch, SDL_PIXELFORMAT_NV12, yuv1, yuv1_pitch) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(pattern->format->format), SDL_GetPixelFormatName(SDL_PIXELFORMAT_NV12), SDL_GetError());
+        goto done;
+    }
+    widen_nv12_to_p010(pattern->w, pattern->h, yuv1, yuv1_pitch, yuv2, yuv2_pitch);
+    if (!verify_yuv_data(SDL_PIXELFORMAT_P010, yuv2, yuv2_pitch, pattern)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed conversion from %s to RGB\n", SDL_GetPixelFormatName(SDL_PIXELFORMAT_P010));
+        goto done;
+    }
+
     /* Verify conversion to YUV formats */
     for (i = 0; i < SDL_arraysize(formats); ++i) {
         yuv1_pitch = CalculateYUVPitch(formats[i], pattern->w) + extra_pitch;
@@ -161,6 +444,17 @@ static int run_automated_tests(int pattern_size, int extra_pitch)
         }
     }
 
+    /* Verify the SIMD conversion to YUV formats matches the scalar one exactly */
+    if (!verify_simd_rgb_to_yuv(formats, SDL_arraysize(formats), pattern->w, pattern->h, extra_pitch)) {
+        goto done;
+    }
+
+    /* Verify the AVX2 conversions from YUV formats match the SSE2 ones exactly */
+    if (!verify_simd_yuv_to_rgb(formats, SDL_arraysize(formats), pattern->w, pattern->h, extra_pitch) ||
+        !verify_simd_yuv_to_rgb(&p010, 1, pattern->w, pattern->h, extra_pitch)) {
+        goto done;
+    }
+
     /* Verify conversion between YUV formats */
     for (i = 0; i < SDL_arraysize(formats); ++i) {
         for (j = 0; j < SDL_arraysize(formats); ++j) {
@@ -246,6 +540,9 @@ main(int argc, char **argv)
         /* Test: odd width and height with intrinsics, extra pitch */
         { SDL_TRUE, 33, 3 },
         { SDL_TRUE, 37, 3 },
+        /* Test: more than one row of 32 pixel blocks with intrinsics */
+        { SDL_TRUE, 64, 0 },
+        { SDL_TRUE, 67, 3 },
     };
     int arg = 1;
     const char *filename;
@@ -323,6 +620,10 @@ main(int argc, char **argv)
                 return 2;
             }
         }
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Running automated test, conversions on several threads\n");
+        if (!verify_threaded_conversions()) {
+            return 2;
+        }
         return 0;
     }
 